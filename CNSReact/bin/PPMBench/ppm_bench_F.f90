@@ -0,0 +1,155 @@
+module ppm_bench_module
+
+  implicit none
+
+  integer, parameter :: ng = 3
+
+  integer, save :: n
+  double precision, save :: dx, dt
+  double precision, allocatable, save :: s(:,:,:), u(:,:,:,:), cspd(:,:,:)
+  double precision, allocatable, save :: Ip(:,:,:,:,:), Im(:,:,:,:,:)
+  double precision, allocatable, save :: Ip0(:,:,:,:,:), Im0(:,:,:,:,:)
+
+end module ppm_bench_module
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+! Fill a box of ncell^3 cells and its ng ghost cells with random data: s
+! smooth plus noise, so that the limiters take every branch, velocities up
+! to the sound speed, and dt at a CFL number of 0.8.
+subroutine ppm_bench_init(ncell)
+
+  use meth_params_module, only : ppm_type
+  use ppm_bench_module
+
+  implicit none
+
+  integer, intent(in) :: ncell
+
+  integer :: i, j, k, nseed
+  integer, allocatable :: seed(:)
+  double precision :: r(5)
+
+  ppm_type = 1
+
+  n  = ncell
+  dx = 1.d0 / n
+
+  ! the same data on every run
+  call random_seed(size=nseed)
+  allocate(seed(nseed))
+  seed = 12345
+  call random_seed(put=seed)
+  deallocate(seed)
+
+  allocate(s   (1-ng:n+ng,1-ng:n+ng,1-ng:n+ng))
+  allocate(u   (1-ng:n+ng,1-ng:n+ng,1-ng:n+ng,3))
+  allocate(cspd(1-ng:n+ng,1-ng:n+ng,1-ng:n+ng))
+
+  do k=1-ng,n+ng
+     do j=1-ng,n+ng
+        do i=1-ng,n+ng
+           call random_number(r)
+           s(i,j,k) = sin(6.d0*dx*(i+2*j+3*k)) + 0.2d0*(r(1)-0.5d0)
+           u(i,j,k,:) = r(2:4) - 0.5d0
+           cspd(i,j,k) = 0.5d0 + 0.5d0*r(5)
+        end do
+     end do
+  end do
+
+  dt = 0.8d0 * dx / (maxval(abs(u)) + maxval(cspd))
+
+  allocate(Ip (0:n+1,0:n+1,1:2,1:3,1:3), Im (0:n+1,0:n+1,1:2,1:3,1:3))
+  allocate(Ip0(0:n+1,0:n+1,1:2,1:3,1:3), Im0(0:n+1,0:n+1,1:2,1:3,1:3))
+
+end subroutine ppm_bench_init
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+! Reconstruct every plane nrep times with the current ppm (ref = 0) or
+! the old, unvectorized ppm_type1 (ref = 1).  As in the advection sweep
+! of CNSReact_advection_3d.f90, the planes k3d = 0..n+1 are done in
+! order and alternate between the two kc slots of Ip and Im.  checksum is
+! the sum of the edge values, to compare runs.
+subroutine ppm_bench_run(ref, nrep, checksum)
+
+  use ppm_module, only : ppm
+  use ppm_ref_module, only : ppm_ref_type1
+  use ppm_bench_module
+
+  implicit none
+
+  integer, intent(in) :: ref, nrep
+  double precision, intent(out) :: checksum
+
+  integer :: irep, k3d, kc
+
+  checksum = 0.d0
+
+  do irep=1,nrep
+     do k3d=0,n+1
+        kc = 1 + mod(k3d,2)
+        if (ref .eq. 0) then
+           call ppm(s,1-ng,1-ng,1-ng,n+ng,n+ng,n+ng,u,cspd,Ip,Im, &
+                    1,1,n,n,dx,dx,dx,dt,k3d,kc,1)
+        else
+           call ppm_ref_type1(s,1-ng,1-ng,1-ng,n+ng,n+ng,n+ng,u,cspd,Ip,Im, &
+                              1,1,n,n,dx,dx,dx,dt,k3d,kc,1)
+        end if
+        checksum = checksum + sum(Ip(:,:,kc,:,:)) + sum(Im(:,:,kc,:,:))
+     end do
+  end do
+
+end subroutine ppm_bench_run
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+! The largest difference between the Ip and Im of the two kernels, in all
+! three directions, over the planes and kc slots that ppm_bench_run
+! visits.  After each plane the slot of the previous plane, which the
+! kernels must leave alone, is compared too.
+subroutine ppm_bench_compare(maxdiff)
+
+  use ppm_module, only : ppm
+  use ppm_ref_module, only : ppm_ref_type1
+  use ppm_bench_module
+
+  implicit none
+
+  double precision, intent(out) :: maxdiff
+
+  integer :: k3d, kc
+
+  maxdiff = 0.d0
+
+  Ip  = 0.d0
+  Im  = 0.d0
+  Ip0 = 0.d0
+  Im0 = 0.d0
+
+  do k3d=0,n+1
+     kc = 1 + mod(k3d,2)
+     call ppm(s,1-ng,1-ng,1-ng,n+ng,n+ng,n+ng,u,cspd,Ip,Im, &
+              1,1,n,n,dx,dx,dx,dt,k3d,kc,1)
+     call ppm_ref_type1(s,1-ng,1-ng,1-ng,n+ng,n+ng,n+ng,u,cspd,Ip0,Im0, &
+                        1,1,n,n,dx,dx,dx,dt,k3d,kc,1)
+     maxdiff = max(maxdiff, maxval(abs(Ip-Ip0)), maxval(abs(Im-Im0)))
+  end do
+
+end subroutine ppm_bench_compare
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+subroutine ppm_bench_finalize()
+  use ppm_bench_module
+  implicit none
+  deallocate(s, u, cspd, Ip, Im, Ip0, Im0)
+end subroutine ppm_bench_finalize
@@ -0,0 +1,307 @@
+! The ppm_type1 of ppm_3d.f90 before it was vectorized over rows, kept
+! only so that PPMBench can time the two and check that they agree.
+
+module ppm_ref_module
+
+  implicit none
+
+  private
+
+  public ppm_ref_type1
+
+contains
+
+  subroutine ppm_ref_type1(s,qd_l1,qd_l2,qd_l3,qd_h1,qd_h2,qd_h3,u,cspd,Ip,Im, &
+                       ilo1,ilo2,ihi1,ihi2,dx,dy,dz,dt,k3d,kc,ivar)
+
+    use meth_params_module, only : ppm_type
+
+    implicit none
+
+    integer,intent(in):: qd_l1,qd_l2,qd_l3,qd_h1,qd_h2,qd_h3
+    integer,intent(in):: ilo1,ilo2,ihi1,ihi2
+
+    double precision,intent(in)::    s(qd_l1:qd_h1,qd_l2:qd_h2,qd_l3:qd_h3)
+    double precision,intent(in)::    u(qd_l1:qd_h1,qd_l2:qd_h2,qd_l3:qd_h3,3)
+    double precision,intent(in):: cspd(qd_l1:qd_h1,qd_l2:qd_h2,qd_l3:qd_h3)
+
+    double precision,intent(out):: Ip(ilo1-1:ihi1+1,ilo2-1:ihi2+1,1:2,1:3,1:3)
+    double precision,intent(out):: Im(ilo1-1:ihi1+1,ilo2-1:ihi2+1,1:2,1:3,1:3)
+
+    double precision,intent(in) :: dx,dy,dz,dt
+    integer         ,intent(in) :: k3d,kc,ivar
+
+    ! local
+    integer i,j,k
+
+    double precision dsl, dsr, dsc
+    double precision sigma, s6
+
+    ! s_{\ib,+}, s_{\ib,-}
+    double precision, allocatable :: sp(:,:)
+    double precision, allocatable :: sm(:,:)
+
+    ! \delta s_{\ib}^{vL}
+    double precision, allocatable :: dsvl(:,:)
+    double precision, allocatable :: dsvlm(:,:)
+    double precision, allocatable :: dsvlp(:,:)
+
+    ! s_{i+\half}^{H.O.}
+    double precision, allocatable :: sedge(:,:)
+    double precision, allocatable :: sedgez(:,:,:)
+
+    ! cell-centered indexing
+    allocate(sp(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+    allocate(sm(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+
+    if (ppm_type .ne. 1) &
+         call bl_error("Should have ppm_type = 1 in ppm_type1")
+
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    ! x-direction
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+    ! cell-centered indexing w/extra x-ghost cell
+    allocate(dsvl(ilo1-2:ihi1+2,ilo2-1:ihi2+1))
+
+    ! edge-centered indexing for x-faces -- ppm_type = 1 only
+    allocate(sedge(ilo1-1:ihi1+2,ilo2-1:ihi2+1))
+
+    ! compute s at x-edges
+
+    ! compute van Leer slopes in x-direction
+    dsvl = 0.d0
+    do j=ilo2-1,ihi2+1
+       do i=ilo1-2,ihi1+2
+          dsc = 0.5d0 * (s(i+1,j,k3d) - s(i-1,j,k3d))
+          dsl = 2.d0  * (s(i  ,j,k3d) - s(i-1,j,k3d))
+          dsr = 2.d0  * (s(i+1,j,k3d) - s(i  ,j,k3d))
+          if (dsl*dsr .gt. 0.d0) &
+               dsvl(i,j) = sign(1.d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
+       end do
+    end do
+
+    ! interpolate s to x-edges
+    do j=ilo2-1,ihi2+1
+       do i=ilo1-1,ihi1+2
+          sedge(i,j) = 0.5d0*(s(i,j,k3d)+s(i-1,j,k3d)) &
+               - (1.d0/6.d0)*(dsvl(i,j)-dsvl(i-1,j))
+          ! make sure sedge lies in between adjacent cell-centered values
+          sedge(i,j) = max(sedge(i,j),min(s(i,j,k3d),s(i-1,j,k3d)))
+          sedge(i,j) = min(sedge(i,j),max(s(i,j,k3d),s(i-1,j,k3d)))
+       end do
+    end do
+
+    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
+    do j=ilo2-1,ihi2+1
+       do i=ilo1-1,ihi1+1
+
+          ! copy sedge into sp and sm
+          sp(i,j) = sedge(i+1,j)
+          sm(i,j) = sedge(i  ,j)
+
+          ! modify using quadratic limiters
+          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.d0) then
+             sp(i,j) = s(i,j,k3d)
+             sm(i,j) = s(i,j,k3d)
+          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sm(i,j)-s(i,j,k3d))) then
+             sp(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sm(i,j)
+          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sp(i,j)-s(i,j,k3d))) then
+             sm(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sp(i,j)
+          end if
+
+          ! compute x-component of Ip and Im
+          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
+          sigma = abs(u(i,j,k3d,1)-cspd(i,j,k3d))*dt/dx
+          Ip(i,j,kc,1,1) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,1,1) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,1))*dt/dx
+          Ip(i,j,kc,1,2) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,1,2) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,1)+cspd(i,j,k3d))*dt/dx
+          Ip(i,j,kc,1,3) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,1,3) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       end do
+    end do
+    !$OMP END PARALLEL DO
+
+    deallocate(sedge,dsvl)
+
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    ! y-direction
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+    ! cell-centered indexing w/extra y-ghost cell
+    allocate( dsvl(ilo1-1:ihi1+1,ilo2-2:ihi2+2))
+
+    ! edge-centered indexing for y-faces
+    allocate(sedge(ilo1-1:ihi1+1,ilo2-1:ihi2+2))
+
+    ! compute s at y-edges
+
+    ! compute van Leer slopes in y-direction
+    dsvl = 0.d0
+    do j=ilo2-2,ihi2+2
+       do i=ilo1-1,ihi1+1
+          dsc = 0.5d0 * (s(i,j+1,k3d) - s(i,j-1,k3d))
+          dsl = 2.d0  * (s(i,j  ,k3d) - s(i,j-1,k3d))
+          dsr = 2.d0  * (s(i,j+1,k3d) - s(i,j  ,k3d))
+          if (dsl*dsr .gt. 0.d0) &
+               dsvl(i,j) = sign(1.d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
+       end do
+    end do
+
+    ! interpolate s to y-edges
+    do j=ilo2-1,ihi2+2
+       do i=ilo1-1,ihi1+1
+          sedge(i,j) = 0.5d0*(s(i,j,k3d)+s(i,j-1,k3d)) &
+               - (1.d0/6.d0)*(dsvl(i,j)-dsvl(i,j-1))
+          ! make sure sedge lies in between adjacent cell-centered values
+          sedge(i,j) = max(sedge(i,j),min(s(i,j,k3d),s(i,j-1,k3d)))
+          sedge(i,j) = min(sedge(i,j),max(s(i,j,k3d),s(i,j-1,k3d)))
+       end do
+    end do
+
+    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
+    do j=ilo2-1,ihi2+1
+       do i=ilo1-1,ihi1+1
+
+          ! copy sedge into sp and sm
+          sp(i,j) = sedge(i,j+1)
+          sm(i,j) = sedge(i,j  )
+
+          ! modify using quadratic limiters
+          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.d0) then
+             sp(i,j) = s(i,j,k3d)
+             sm(i,j) = s(i,j,k3d)
+          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sm(i,j)-s(i,j,k3d))) then
+             sp(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sm(i,j)
+          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sp(i,j)-s(i,j,k3d))) then
+             sm(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sp(i,j)
+          end if
+
+          ! compute y-component of Ip and Im
+          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
+          sigma = abs(u(i,j,k3d,2)-cspd(i,j,k3d))*dt/dy
+          Ip(i,j,kc,2,1) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,2,1) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,2))*dt/dy
+          Ip(i,j,kc,2,2) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,2,2) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,2)+cspd(i,j,k3d))*dt/dy
+          Ip(i,j,kc,2,3) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,2,3) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       end do
+    end do
+    !$OMP END PARALLEL DO
+
+    deallocate(dsvl,sedge)
+
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    ! z-direction
+    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+    ! cell-centered indexing
+    allocate( dsvl(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+    allocate(dsvlm(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+    allocate(dsvlp(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+
+    allocate(sedgez(ilo1-1:ihi1+1,ilo2-2:ihi2+3,k3d-1:k3d+2))
+
+    ! compute s at z-edges
+
+    ! compute van Leer slopes in z-direction
+    dsvl  = 0.d0
+    dsvlm = 0.d0
+    dsvlp = 0.d0
+
+    !$OMP PARALLEL DO PRIVATE(i,j,k,dsc,dsl,dsr,s6,sigma)
+    do j=ilo2-1,ihi2+1
+       do i=ilo1-1,ihi1+1
+
+          ! compute on slab below
+          k = k3d-1
+          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
+          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
+          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
+          if (dsl*dsr .gt. 0.d0) &
+               dsvlm(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
+
+          ! compute on slab above
+          k = k3d+1
+          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
+          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
+          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
+          if (dsl*dsr .gt. 0.d0) &
+               dsvlp(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
+
+          ! compute on current slab
+          k = k3d
+          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
+          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
+          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
+          if (dsl*dsr .gt. 0.d0) &
+               dsvl(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
+
+          ! interpolate to lo face
+          k = k3d
+          sm(i,j) = 0.5d0*(s(i,j,k)+s(i,j,k-1)) - (1.0d0/6.0d0)*(dsvl(i,j)-dsvlm(i,j))
+          ! make sure sedge lies in between adjacent cell-centered values
+          sm(i,j) = max(sm(i,j),min(s(i,j,k),s(i,j,k-1)))
+          sm(i,j) = min(sm(i,j),max(s(i,j,k),s(i,j,k-1)))
+
+          ! interpolate to hi face
+          k = k3d+1
+          sp(i,j) = 0.5d0*(s(i,j,k)+s(i,j,k-1)) - (1.0d0/6.0d0)*(dsvlp(i,j)-dsvl(i,j))
+          ! make sure sedge lies in between adjacent cell-centered values
+          sp(i,j) = max(sp(i,j),min(s(i,j,k),s(i,j,k-1)))
+          sp(i,j) = min(sp(i,j),max(s(i,j,k),s(i,j,k-1)))
+
+          ! modify using quadratic limiters
+          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.0d0) then
+             sp(i,j) = s(i,j,k3d)
+             sm(i,j) = s(i,j,k3d)
+          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.0d0*abs(sm(i,j)-s(i,j,k3d))) then
+             sp(i,j) = 3.0d0*s(i,j,k3d) - 2.0d0*sm(i,j)
+          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.0d0*abs(sp(i,j)-s(i,j,k3d))) then
+             sm(i,j) = 3.0d0*s(i,j,k3d) - 2.0d0*sp(i,j)
+          end if
+
+          ! compute z-component of Ip and Im
+          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
+          sigma = abs(u(i,j,k3d,3)-cspd(i,j,k3d))*dt/dz
+          Ip(i,j,kc,3,1) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,3,1) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,3))*dt/dz
+          Ip(i,j,kc,3,2) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,3,2) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          sigma = abs(u(i,j,k3d,3)+cspd(i,j,k3d))*dt/dz
+          Ip(i,j,kc,3,3) = sp(i,j) - &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+          Im(i,j,kc,3,3) = sm(i,j) + &
+               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       end do
+    end do
+    !$OMP END PARALLEL DO
+
+    deallocate(dsvl,dsvlm,dsvlp,sp,sm,sedgez)
+
+  end subroutine ppm_ref_type1
+
+end module ppm_ref_module
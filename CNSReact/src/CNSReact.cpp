@@ -74,6 +74,9 @@ int          CNSReact::allow_untagging = 0;
 int          CNSReact::normalize_species = 0;
 int          CNSReact::do_special_tagging = 0;
 int          CNSReact::ppm_type = 1;
+int          CNSReact::use_vode = 0;  // react with VODE, one cell at a time, instead of BDF
+int          CNSReact::chem_npt = 8;  // cells per BDF batch
+int          CNSReact::cache_transport = 1;  // reuse the predictor's transport coefficients
 
 
 Real CNSReact::gravx = 0.0;
@@ -222,6 +225,12 @@ CNSReact::read_params ()
     pp.query("normalize_species",normalize_species);
     pp.query("do_special_tagging",do_special_tagging);
     pp.query("ppm_type", ppm_type);
+
+    pp.query("use_vode", use_vode);
+    pp.query("chem_npt", chem_npt);
+    pp.query("cache_transport", cache_transport);
+    if (chem_npt < 1 || chem_npt > 8)
+        BoxLib::Abort("CNSReact::read_params: chem_npt must be between 1 and 8");
 }
 
 CNSReact::CNSReact ()
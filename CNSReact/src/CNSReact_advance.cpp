@@ -79,27 +79,16 @@ CNSReact::advance_hydro (Real time,
       current = &getFluxReg(level);
     }
 
-    AmrLevel &levelData = *this;
-    Geometry g = levelData.Geom();
-    MultiFab levelVolume;
-    g.GetVolume(levelVolume,grids,NUM_GROW);
-        
-    MultiFab levelArea[BL_SPACEDIM];
-    for (int i = 0; i < BL_SPACEDIM ; i++) {
-      g.GetFaceArea(levelArea[i],grids,i,NUM_GROW);
-    }
-
-    // Integrate, looping through the grids.
-    FArrayBox divu, grid_volume;
-    FArrayBox dloga, area[BL_SPACEDIM];
-    FArrayBox flux[BL_SPACEDIM];
-        
     const Real *dx = geom.CellSize();
     Real courno    = -1.0e+20;
 
+    //
+    // Fluxes of the whole level, filled tile by tile and handed to the flux
+    // registers once all tiles are done.
+    //
     MultiFab fluxes[BL_SPACEDIM];
 
-    if (do_reflux && fine) {
+    if (do_reflux && (fine || current)) {
       for (int j = 0; j < BL_SPACEDIM; j++) {
 	BoxArray ba = S_new.boxArray();
 	ba.surroundingNodes(j);
@@ -107,77 +96,120 @@ CNSReact::advance_hydro (Real time,
       }
     }
 
-    for (FillPatchIterator fpi(*this, S_new, NUM_GROW,
-			       time, State_Type, 0, NUM_STATE);
-	 fpi.isValid(); ++fpi) {
+    FillPatchIterator fpi(*this, S_new, NUM_GROW,
+			  time, State_Type, 0, NUM_STATE);
+    MultiFab& Sborder = fpi.get_mf();
 
-      int mfiindex = fpi.index();
+    //
+    // Chemistry work (right-hand side evaluations) per grid, for load
+    // balancing diagnostics.
+    //
+    chem_cost.resize(grids.size());
+    for (int i = 0; i < chem_cost.size(); i++) {
+      chem_cost[i] = 0.0;
+    }
 
-      Box bx(fpi.UngrownBox());
+    //
+    // React the filled state, ghost cells included, for the first half of the
+    // step.  Grown tiles do not overlap, so every cell is reacted once.
+    //
+    const Real dt_react = 0.5*dt;
 
-      Box bx_g(BoxLib::grow(bx,NUM_GROW));
-      // Create FAB for extended grid values (including boundaries) and fill.
-      FArrayBox &state = fpi();
-      FArrayBox &stateout = S_new[fpi];
-            
-      grid_volume.resize(bx_g,1);
-      grid_volume.copy(levelVolume[fpi]);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(Sborder,true); mfi.isValid(); ++mfi) {
 
-      for (int i = 0; i < BL_SPACEDIM ; i++) {
-	area[i].resize(BoxLib::surroundingNodes(bx_g,i));
-	area[i].copy(levelArea[i][fpi]);
-      }
-            
-#if (BL_SPACEDIM <=2)
-      dloga.resize(bx_g);
-      dloga.copy(dLogArea[0][fpi]);
+      const Box& gbx = mfi.growntilebox();
+
+      Real costLoc = 0.0;
+
+      BL_FORT_PROC_CALL(CNS_REACT,cns_react)
+	(gbx.loVect(), gbx.hiVect(),
+	 BL_TO_FORTRAN(Sborder[mfi]), &dt_react, &costLoc);
+
+#ifdef _OPENMP
+#pragma omp atomic
 #endif
+      chem_cost[mfi.index()] += costLoc;
+    }
 
-      // Allocate fabs for fluxes.
-      Box bx_g1(BoxLib::grow(bx,1));
-      for (int i = 0; i < BL_SPACEDIM ; i++) {
-	flux[i].resize(BoxLib::surroundingNodes(bx_g1,i),NUM_STATE);
-      }
+    //
+    // Integrate, looping through the tiles.  cns_umdrv overwrites its input
+    // state on the whole grown box and writes its output a cell
+    // beyond the box, so each tile works on a private copy of both.  The
+    // metrics are the ones built by buildMetrics, used in place.
+    //
+#ifdef _OPENMP
+#pragma omp parallel reduction(max:courno)
+#endif
+    {
+      FArrayBox state, stateout;
+      FArrayBox flux[BL_SPACEDIM];
 
-      const int*  domain_lo = geom.Domain().loVect();
-      const int*  domain_hi = geom.Domain().hiVect();
-
-      Real cflLoc = -1.0e+20;
-      int is_finest_level = 0;
-      if (level == finest_level) is_finest_level = 1;
-
-      BL_FORT_PROC_CALL(CNS_UMDRV,cns_umdrv)
-	(bx.loVect(), bx.hiVect(),
-	 BL_TO_FORTRAN(state), BL_TO_FORTRAN(stateout),
-	 dx, &dt,
-	 D_DECL(BL_TO_FORTRAN(flux[0]), 
-		BL_TO_FORTRAN(flux[1]), 
-		BL_TO_FORTRAN(flux[2])), 
-	 D_DECL(BL_TO_FORTRAN(area[0]), 
-		BL_TO_FORTRAN(area[1]), 
-		BL_TO_FORTRAN(area[2])), 
+      for (MFIter mfi(S_new,true); mfi.isValid(); ++mfi) {
+
+	const Box& bx = mfi.tilebox();
+
+	state.resize(BoxLib::grow(bx,NUM_GROW),NUM_STATE);
+	state.copy(Sborder[mfi]);
+
+	Box bx_g1(BoxLib::grow(bx,1));
+	stateout.resize(bx_g1,NUM_STATE);
+
+	// Allocate fabs for fluxes.
+	for (int i = 0; i < BL_SPACEDIM ; i++) {
+	  flux[i].resize(BoxLib::surroundingNodes(bx_g1,i),NUM_STATE);
+	}
+
+	Real cflLoc = -1.0e+20;
+	Real costLoc = 0.0;
+
+	BL_FORT_PROC_CALL(CNS_UMDRV,cns_umdrv)
+	  (bx.loVect(), bx.hiVect(),
+	   BL_TO_FORTRAN(state), BL_TO_FORTRAN(stateout),
+	   dx, &dt,
+	   D_DECL(BL_TO_FORTRAN(flux[0]), 
+		  BL_TO_FORTRAN(flux[1]), 
+		  BL_TO_FORTRAN(flux[2])), 
+	   D_DECL(BL_TO_FORTRAN(area[0][mfi]), 
+		  BL_TO_FORTRAN(area[1][mfi]), 
+		  BL_TO_FORTRAN(area[2][mfi])), 
 #if (BL_SPACEDIM < 3) 
-	 BL_TO_FORTRAN(dloga), 
+	   BL_TO_FORTRAN(dLogArea[0][mfi]), 
 #endif
-	 BL_TO_FORTRAN(grid_volume), 
-	 &cflLoc,verbose);
+	   BL_TO_FORTRAN(volume[mfi]), 
+	   &cflLoc,&costLoc,verbose);
 
-      if (do_reflux) {
-	if (fine) {
-	  for (int i = 0; i < BL_SPACEDIM ; i++) {
-                        fluxes[i][fpi].copy(flux[i]);
-	  }
-	}
-	if (current) {
+	S_new[mfi].copy(stateout,bx);
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+	chem_cost[mfi.index()] += costLoc;
+
+	if (do_reflux && (fine || current)) {
 	  for (int i = 0; i < BL_SPACEDIM ; i++) {
-	    current->FineAdd(flux[i],i,mfiindex,0,0,NUM_STATE,1);
+	    fluxes[i][mfi].copy(flux[i],mfi.nodaltilebox(i));
 	  }
 	}
-      }
 
-      courno = std::max(courno,cflLoc);
+	courno = std::max(courno,cflLoc);
+
+      } // end for(mfi...)
+    }
 
-    } // end for(fpi...)
+    //
+    // FineAdd and CrseInit are not thread safe, so the registers are
+    // filled from the assembled level fluxes here.
+    //
+    if (do_reflux && current) {
+      for (MFIter mfi(fluxes[0]); mfi.isValid(); ++mfi) {
+	for (int i = 0; i < BL_SPACEDIM ; i++) {
+	  current->FineAdd(fluxes[i][mfi],i,mfi.index(),0,0,NUM_STATE,1);
+	}
+      }
+    }
 
     if (do_reflux && fine) {
       for (int i = 0; i < BL_SPACEDIM ; i++) {
@@ -187,6 +219,20 @@ CNSReact::advance_hydro (Real time,
 
     ParallelDescriptor::ReduceRealMax(courno);
 
+    if (verbose) {
+      Real cost_max = 0.0, cost_sum = 0.0;
+      for (int i = 0; i < chem_cost.size(); i++) {
+        cost_max = std::max(cost_max, chem_cost[i]);
+        cost_sum += chem_cost[i];
+      }
+      ParallelDescriptor::ReduceRealMax(cost_max);
+      ParallelDescriptor::ReduceRealSum(cost_sum);
+      if (ParallelDescriptor::IOProcessor()) {
+        std::cout << "[Level " << level << "] chemistry cost per grid: max "
+                  << cost_max << ", average " << cost_sum/grids.size() << std::endl;
+      }
+    }
+
     if (courno > 1.0) {
       if (ParallelDescriptor::IOProcessor()) 
 	std::cout << "OOPS -- EFFECTIVE CFL AT THIS LEVEL " << level << " IS " << courno << std::endl;
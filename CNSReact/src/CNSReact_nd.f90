@@ -23,7 +23,8 @@
       subroutine set_method_params(dm,Density,Xmom,Eden,Eint,Temp, &
                                    FirstAdv,FirstSpec,numadv, &
                                    small_dens_in, small_temp_in, small_pres_in, &
-                                   ppm_type_in, normalize_species_in)
+                                   ppm_type_in, normalize_species_in, use_vode_in, &
+                                   cache_transport_in)
 
         use meth_params_module
         use eos_module
@@ -36,7 +37,8 @@
         integer, intent(in) :: numadv
         integer, intent(in) :: ppm_type_in
         double precision, intent(in) :: small_dens_in, small_temp_in, small_pres_in
-        integer, intent(in) :: normalize_species_in
+        integer, intent(in) :: normalize_species_in, use_vode_in
+        integer, intent(in) :: cache_transport_in
 
         integer             :: QLAST
 
@@ -116,6 +118,8 @@
 
         ppm_type              = ppm_type_in
         normalize_species     = normalize_species_in
+        use_vode              = use_vode_in .ne. 0
+        cache_transport       = cache_transport_in .ne. 0
 
       end subroutine set_method_params
 
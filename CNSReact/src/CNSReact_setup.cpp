@@ -103,12 +103,12 @@ CNSReact::variableSetUp ()
 {
     BL_ASSERT(desc_lst.size() == 0);
 
-    if (chemSolve == 0) {
-      chemSolve = new ChemDriver();
-    }
-
     // Get options, set phys_bc
     read_params();
+
+    if (chemSolve == 0) {
+      chemSolve = new ChemDriver(use_vode, chem_npt);
+    }
     //
     // Set number of state variables and pointers to components
     //
@@ -153,7 +153,8 @@ CNSReact::variableSetUp ()
     BL_FORT_PROC_CALL(SET_METHOD_PARAMS, set_method_params)
         (dm, Density, Xmom, Eden, Eint, Temp, FirstAdv, FirstSpec,
          NumAdv, small_dens, small_temp, small_pres, 
-         ppm_type, normalize_species);
+         ppm_type, normalize_species, use_vode,
+         cache_transport);
 
     Real run_stop = ParallelDescriptor::second() - run_strt;
  
@@ -13,13 +13,13 @@ subroutine cns_umdrv(lo,hi,&
      area2,area2_l1,area2_l2,area2_l3,area2_h1,area2_h2,area2_h3, &
      area3,area3_l1,area3_l2,area3_l3,area3_h1,area3_h2,area3_h3, &
      vol  ,  vol_l1,  vol_l2,  vol_l3,  vol_h1,  vol_h2,  vol_h3, &
-     courno,verbose)
+     courno,cost,verbose)
 
   use meth_params_module, only : URHO, QVAR, NVAR, NHYP, NDIF, &
        QPRES,QU,QV,QW,normalize_species
   use advection_module, only : umeth3d, ctoprim, ptoderiv, srctosrcQ, uflaten, divu, consup, &
        enforce_minimum_density, normalize_new_species
-  use diff_flux_module, only : diffFlux, fluxtosrc, diffup
+  use diff_flux_module, only : diffFlux, fluxtosrc, diffup, diffFlux_state_key
   use chemsolv_module, only : chemsolv
 
   implicit none
@@ -46,7 +46,7 @@ subroutine cns_umdrv(lo,hi,&
   double precision,intent(in   )::  vol(  vol_l1:  vol_h1,  vol_l2:  vol_h2,  vol_l3:  vol_h3)
 
   double precision, intent(in) :: delta(3),dt
-  double precision, intent(inout) :: courno
+  double precision, intent(inout) :: courno, cost
 
   integer :: lo_work(3),hi_work(3)
   integer :: lo_diff(3),hi_diff(3)
@@ -70,6 +70,7 @@ subroutine cns_umdrv(lo,hi,&
 
   double precision :: dx,dy,dz, dt_flux, dt_src
   integer :: iflaten, dflux_timer
+  integer(8) :: q_key
 
   allocate(    q(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3,QVAR))
   allocate( dpdr(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
@@ -99,11 +100,7 @@ subroutine cns_umdrv(lo,hi,&
   dy = delta(2)
   dz = delta(3)
 
-  ! Chemically react input state for half time step
-  lo_work = lo-NHYP-NDIF
-  hi_work = hi+NHYP+NDIF
-  call chemsolv(lo_work, hi_work, &
-       uin,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, 0.5d0*dt)
+  ! The input state has already been reacted for half a time step by cns_react
 
   lo_work = lo_hyp - NHYP
   hi_work = hi_hyp + NHYP
@@ -129,13 +126,18 @@ subroutine cns_umdrv(lo,hi,&
      flatn = 1.d0
   end if
 
+  ! The corrector's diffFlux below sees this same q (ctoprim of the
+  ! unchanged uin), so both calls share a key and the transport
+  ! coefficients are evaluated once.
+  q_key = diffFlux_state_key()
+
   dflux_timer = 1
   call diffFlux(lo_diff,hi_diff, &
        q,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
        dfluxx,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1)+1,hi_diff(2),hi_diff(3),&
        dfluxy,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2)+1,hi_diff(3),&
        dfluxz,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3)+1,&
-       dx,dy,dz,dflux_timer)
+       dx,dy,dz,dflux_timer,q_key)
 
   ! Compute source terms due to diffusion for hyperbolic advection step 
   call fluxtosrc(lo_diff, hi_diff, &
@@ -189,7 +191,7 @@ subroutine cns_umdrv(lo,hi,&
        dfluxx,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1)+1,hi_diff(2),hi_diff(3),&
        dfluxy,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2)+1,hi_diff(3),&
        dfluxz,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3)+1,&
-       dx,dy,dz,dflux_timer)
+       dx,dy,dz,dflux_timer,q_key)
 
   ! Add diffusion flux with half dt because the flux stores the sum of old and new fluxes,
   ! and subtract src (i.e., the old diffusion flux)
@@ -207,9 +209,9 @@ subroutine cns_umdrv(lo,hi,&
        vol  ,  vol_l1,  vol_l2,  vol_l3,  vol_h1,  vol_h2,  vol_h3, &
        dx,dy,dz,dt_flux, dt_src)
 
-  ! Chemically react input state for half time step
+  ! Chemically react output state for half time step
   call chemsolv(lo, hi, &
-       uout,uout_l1,uout_l2,uout_l3,uout_h1,uout_h2,uout_h3, 0.5d0*dt)
+       uout,uout_l1,uout_l2,uout_l3,uout_h1,uout_h2,uout_h3, 0.5d0*dt, cost)
 
   ! Add diffusion fluxes to hyperbolic fluxes to pass back to AMR
   flux1 = flux1 + dfluxx(flux1_l1:flux1_h1,flux1_l2:flux1_h2,flux1_l3:flux1_h3,:)
@@ -236,6 +238,28 @@ subroutine cns_umdrv(lo,hi,&
   
 end subroutine cns_umdrv
 
+! :::
+! ::: ----------------------------------------------------------------
+! ::: React u in lo:hi for dt.  cost is incremented by the work done.
+! :::
+
+subroutine cns_react(lo,hi,u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,dt,cost)
+
+  use meth_params_module, only : NVAR
+  use chemsolv_module, only : chemsolv
+
+  implicit none
+
+  integer,intent(in):: lo(3),hi(3)
+  integer,intent(in):: u_l1,u_l2,u_l3,u_h1,u_h2,u_h3
+  double precision,intent(inout):: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+  double precision,intent(in):: dt
+  double precision,intent(inout):: cost
+
+  call chemsolv(lo,hi,u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,dt,cost)
+
+end subroutine cns_react
+
 ! :: ----------------------------------------------------------
 ! :: Volume-weight average the fine grid data onto the coarse
 ! :: grid.  Overlap is given in coarse grid coordinates.
@@ -10,8 +10,31 @@ module chemsolv_module
 
 contains
 
-  subroutine chemsolv(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt)
-    
+  ! React u in loc:hic for dt at constant volume and internal energy.  cost
+  ! is incremented by the number of right-hand side evaluations.
+  subroutine chemsolv(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt, cost)
+
+    use meth_params_module, only : NVAR, use_vode
+
+    implicit none
+
+    integer, intent(in) :: loc(3), hic(3)
+    integer, intent(in) :: u_l1, u_l2, u_l3, u_h1, u_h2, u_h3
+    double precision, intent(in) :: dt
+    double precision, intent(inout) :: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+    double precision, intent(inout) :: cost
+
+    if (use_vode) then
+       call chemsolv_vode(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt, cost)
+    else
+       call chemsolv_bdf (loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt, cost)
+    end if
+
+  end subroutine chemsolv
+
+
+  subroutine chemsolv_vode(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt, cost)
+
     use meth_params_module, only : NVAR, URHO, UEDEN, UMX, UMY, UMZ, UTEMP, UFS
     use chemistry_module, only : nspec=>nspecies
     use vode_module, only : itol, rtol, atol, MF_NOSTIFF, MF_NUMERICAL_JAC, &
@@ -23,6 +46,7 @@ contains
     integer, intent(in) :: u_l1, u_l2, u_l3, u_h1, u_h2, u_h3
     double precision, intent(in) :: dt
     double precision, intent(inout) :: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+    double precision, intent(inout) :: cost
 
     external jac, f_rhs, dvode
 
@@ -51,7 +75,7 @@ contains
 
        voderpar(1) = rho
        voderpar(2) = ei
-       
+
        Y = u(i,j,k,UFS:UFS+nspec-1) * rhoinv
 
        istate = 1
@@ -67,6 +91,8 @@ contains
           call bl_error("ERROR in chemsolv: VODE failed")
        end if
 
+       cost = cost + vodeiwork(12)
+
        call feeytt(ei, Y, ckiwork, ckrwork, u(i,j,k,UTEMP))
 
        u(i,j,k,UFS:UFS+nspec-1) = rho * Y
@@ -74,8 +100,97 @@ contains
     end do
     end do
 
-  end subroutine chemsolv
+  end subroutine chemsolv_vode
 
-end module chemsolv_module
 
+  ! Cells are advanced ts%npt at a time by BDF with the analytic Jacobian.
+  ! The state of a cell is (Y,T); the internal energy stays fixed, so T is
+  ! recomputed from it at the end.
+  subroutine chemsolv_bdf(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt, cost)
+
+    use meth_params_module, only : NVAR, URHO, UEDEN, UMX, UMY, UMZ, UTEMP, UFS
+    use chemistry_module, only : nspec=>nspecies
+    use bdf
+    use bdf_data, only : ts, reuse_jac
+    use cv_feval, only : f_rhs, f_jac, rho
+
+    implicit none
 
+    integer, intent(in) :: loc(3), hic(3)
+    integer, intent(in) :: u_l1, u_l2, u_l3, u_h1, u_h2, u_h3
+    double precision, intent(in) :: dt
+    double precision, intent(inout) :: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+    double precision, intent(inout) :: cost
+
+    integer :: i, j, k, n, p, nb, npt, neq, ierr, ckiwork
+    integer :: idx(3,ts%npt)
+    double precision :: rhoinv, ckrwork
+    double precision :: ei(ts%npt), y0(nspec+1,ts%npt), y1(nspec+1,ts%npt)
+    logical :: reset, reuse_J
+
+    neq = nspec+1
+    npt = ts%npt
+
+    reuse_J = .false.
+    nb = 0
+
+    do k=loc(3),hic(3)
+    do j=loc(2),hic(2)
+    do i=loc(1),hic(1)
+
+       nb = nb+1
+       idx(:,nb) = (/ i, j, k /)
+
+       rho(nb) = u(i,j,k,URHO)
+       rhoinv = 1.d0/rho(nb)
+
+       ei(nb) = rhoinv*( u(i,j,k,UEDEN) - 0.5d0*rhoinv* &
+            (u(i,j,k,UMX)**2 + u(i,j,k,UMY)**2 + u(i,j,k,UMZ)**2) )
+
+       y0(1:nspec,nb) = u(i,j,k,UFS:UFS+nspec-1) * rhoinv
+       y0(neq,nb) = u(i,j,k,UTEMP)
+       call feeytt(ei(nb), y0(1,nb), ckiwork, ckrwork, y0(neq,nb))
+
+       if (nb .eq. npt .or. &
+            (i.eq.hic(1) .and. j.eq.hic(2) .and. k.eq.hic(3))) then
+
+          ! pad a short last batch with copies of its last cell
+          do p = nb+1, npt
+             rho(p) = rho(nb)
+             y0(:,p) = y0(:,nb)
+          end do
+
+          reset = .true.
+          call bdf_advance(ts, f_rhs, f_jac, neq, npt, y0, 0.d0, &
+               y1, dt, dt, reset, reuse_J, ierr)
+
+          if (ierr .ne. 0) then
+             print *, 'chemsolv: BDF failed:', errors(ierr)
+             do p = 1, nb
+                print *, idx(:,p), y0(:,p)
+             end do
+             call bl_error("ERROR in chemsolv: BDF failed")
+          end if
+
+          reuse_J = reuse_jac
+
+          cost = cost + dble(ts%nfe*npt)
+
+          do p = 1, nb
+             do n = 1, nspec
+                u(idx(1,p),idx(2,p),idx(3,p),UFS+n-1) = rho(p) * y1(n,p)
+             end do
+             call feeytt(ei(p), y1(1,p), ckiwork, ckrwork, &
+                  u(idx(1,p),idx(2,p),idx(3,p),UTEMP))
+          end do
+
+          nb = 0
+       end if
+
+    end do
+    end do
+    end do
+
+  end subroutine chemsolv_bdf
+
+end module chemsolv_module
@@ -4,7 +4,13 @@ module diff_flux_module
 
   private
 
-  public :: diffFlux, fluxtosrc, diffup
+  ! Transport coefficients of the last diffFlux call on this thread, and
+  ! the key of the primitive state they were evaluated on (0: none)
+  double precision, allocatable, save :: tc_rhoD(:,:,:,:), tc_lam(:,:,:), tc_mu(:,:,:)
+  integer(8), save :: tc_key = 0, tc_last_key = 0
+  !$omp threadprivate(tc_rhoD, tc_lam, tc_mu, tc_key, tc_last_key)
+
+  public :: diffFlux, fluxtosrc, diffup, diffFlux_state_key
  
 contains
 
@@ -13,14 +19,15 @@ contains
        flux1,flux1_l1,flux1_l2,flux1_l3,flux1_h1,flux1_h2,flux1_h3, &
        flux2,flux2_l1,flux2_l2,flux2_l3,flux2_h1,flux2_h2,flux2_h3, &
        flux3,flux3_l1,flux3_l2,flux3_l3,flux3_h1,flux3_h2,flux3_h3, &
-       dx,dy,dz,df_timer)
+       dx,dy,dz,df_timer,q_key)
 
-    use meth_params_module, only : NVAR, QVAR
+    use meth_params_module, only : NVAR, QVAR, cache_transport
     use chemistry_module, only : nspec=>nspecies
     
     implicit none
     
     integer,intent(in):: lof(3),hif(3), df_timer
+    integer(8),intent(in):: q_key
     integer,intent(in)::    q_l1,    q_l2,    q_l3,    q_h1,    q_h2,    q_h3
     integer,intent(in)::flux1_l1,flux1_l2,flux1_l3,flux1_h1,flux1_h2,flux1_h3
     integer,intent(in)::flux2_l1,flux2_l2,flux2_l3,flux2_h1,flux2_h2,flux2_h3
@@ -32,7 +39,7 @@ contains
     double precision,intent(inout)::flux3(flux3_l1:flux3_h1,flux3_l2:flux3_h2,flux3_l3:flux3_h3,NVAR)
 
     integer :: loD(3), hiD(3)
-    double precision, allocatable :: rhoD(:,:,:,:), lam(:,:,:), mu(:,:,:)
+    logical :: reuse
 
     if (df_timer .eq. 1) then
        flux1(:,:,:,:) = 0.d0
@@ -42,32 +49,55 @@ contains
 
     loD = lof - 1
     hiD = hif + 1
-    allocate(rhoD(loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3),nspec))
-    allocate(lam (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3)))
-    allocate(mu  (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3)))
 
-    call get_transCoef(q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
-         rhoD, lam, mu, loD, hiD)
+    ! q_key is the caller's word that q is the state of an earlier call with
+    ! the same key (see diffFlux_state_key); its coefficients are reused if
+    ! they cover the box.  q_key = 0 never matches.
+    reuse = cache_transport .and. q_key .ne. 0 .and. q_key .eq. tc_key .and. allocated(tc_mu)
+    if (reuse) then
+       reuse = all(lbound(tc_mu) .le. loD) .and. all(ubound(tc_mu) .ge. hiD)
+    end if
+
+    if (.not. reuse) then
+       if (allocated(tc_mu)) deallocate(tc_rhoD, tc_lam, tc_mu)
+       allocate(tc_rhoD(loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3),nspec))
+       allocate(tc_lam (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3)))
+       allocate(tc_mu  (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3)))
+
+       call get_transCoef(q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
+            tc_rhoD, tc_lam, tc_mu, loD, hiD)
+
+       tc_key = q_key
+    end if
 
     call comp_dflux(lof,hif, &
          q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
-         rhoD, lam, mu, loD, hiD, &
+         tc_rhoD, tc_lam, tc_mu, lbound(tc_mu), ubound(tc_mu), &
          flux1,flux1_l1,flux1_l2,flux1_l3,flux1_h1,flux1_h2,flux1_h3, &
          flux2,flux2_l1,flux2_l2,flux2_l3,flux2_h1,flux2_h2,flux2_h3, &
          flux3,flux3_l1,flux3_l2,flux3_l3,flux3_h1,flux3_h2,flux3_h3, &
          dx,dy,dz)
 
-    deallocate(rhoD, lam, mu)
-
   end subroutine diffFlux
 
 
+  ! A new key for diffFlux, naming a primitive state on this thread.  The
+  ! caller passes it with every diffFlux call on that same state, and draws
+  ! a new one whenever the state changes.
+  function diffFlux_state_key() result(key)
+    integer(8) :: key
+    tc_last_key = tc_last_key + 1
+    key = tc_last_key
+  end function diffFlux_state_key
+
+
+  ! Transport coefficients on loD:hiD, a row of cells at a time.
   subroutine get_transCoef(q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
          rhoD, lam, mu, loD, hiD)
 
-    use meth_params_module, only : QVAR, QRHO, QU, QV, QW, QREINT, QPRES, QTEMP, QFS
+    use meth_params_module, only : QVAR, QTEMP, QFS
     use chemistry_module, only : nspec=>nspecies, inv_mwt
-    use eglib_module
+    use egz_module
 
     implicit none
 
@@ -78,39 +108,63 @@ contains
     double precision,intent(out)::lam (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3))
     double precision,intent(out)::  mu(loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3))
 
-    integer :: i, j, k, iwrk
-    double precision :: rwrk, rhoDt(nspec), Cpt(nspec), Xt(nspec), Yt(nspec), Tt, Wtm, &
-         lam1, lam2
+    integer :: i, j, k, n, np, iwrk
+    double precision :: rwrk, Cpt(nspec), Xt(nspec), Yt(nspec)
+    double precision :: TZ(loD(1):hiD(1)), Wtm(loD(1):hiD(1))
+    double precision :: L1Z(loD(1):hiD(1)), L2Z(loD(1):hiD(1))
+    double precision, allocatable :: XZ(:,:), CPZ(:,:), DZ(:,:)
 
-    integer, parameter :: NP=1, ITLS=1, IFLAG=3
     double precision, parameter :: TMIN_TRANS=250.d0
 
-    call eglib_init(nspec, NP, ITLS, IFLAG)
+    np = hiD(1)-loD(1)+1
 
-    do       k = loD(3), hiD(3)
-       do    j = loD(2), hiD(2)
-          do i = loD(1), hiD(1)
+    allocate(XZ (loD(1):hiD(1),nspec))
+    allocate(CPZ(loD(1):hiD(1),nspec))
+    allocate(DZ (loD(1):hiD(1),nspec))
+
+    ! EGZINI keeps its work space per thread
+    call egzini(np)
+
+    do    k = loD(3), hiD(3)
+       do j = loD(2), hiD(2)
 
-             Tt = max(TMIN_TRANS, q(i,j,k,QTEMP))
+          do i = loD(1), hiD(1)
+             TZ(i) = max(TMIN_TRANS, q(i,j,k,QTEMP))
              Yt = q(i,j,k,QFS:QFS+nspec-1)
              call ckytx(Yt,iwrk,rwrk,Xt)
-             call ckcpms(Tt, iwrk, rwrk, Cpt)
-             call ckmmwy(Yt, iwrk, rwrk, Wtm)
+             call ckmmwy(Yt,iwrk,rwrk,Wtm(i))
+             XZ(i,:) = Xt
+          end do
 
-             call EGSPAR(Tt, Xt, Yt, Cpt, egwork, egiwork)
+          if (iflag > 3) then
+             do i = loD(1), hiD(1)
+                call ckcpms(TZ(i), iwrk, rwrk, Cpt)
+                CPZ(i,:) = Cpt
+             end do
+          else
+             CPZ = 0.d0
+          end if
+
+          call egzpar(TZ, XZ, CPZ)
 
-             call EGSE3(Tt, Yt, egwork, mu(i,j,k))
+          call egze3(TZ, mu(:,j,k))
 
-             call EGSVR1(Tt, Yt, egwork, rhoDt)
-             rhoD(i,j,k,:) = rhoDt * Wtm * inv_mwt
+          call egzl1( 1.d0, XZ, L1Z)
+          call egzl1(-1.d0, XZ, L2Z)
+          lam(:,j,k) = 0.5d0*(L1Z+L2Z)
 
-             call EGSL1( 1.d0, Tt, Xt, egwork, lam1) 
-             call EGSL1(-1.d0, Tt, Xt, egwork, lam2) 
-             lam(i,j,k) = 0.5d0*(lam1+lam2)
+          call EGZVR1(TZ, DZ)
+          do n = 1, nspec
+             do i = loD(1), hiD(1)
+                rhoD(i,j,k,n) = DZ(i,n) * Wtm(i) * inv_mwt(n)
+             end do
           end do
+
        end do
     end do
 
+    deallocate(XZ, CPZ, DZ)
+
   end subroutine get_transCoef
 
 
@@ -69,275 +69,68 @@ contains
     integer         ,intent(in) :: k3d,kc,ivar
 
     ! local
-    integer i,j,k
-
-    double precision dsl, dsr, dsc
-    double precision sigma, s6
+    integer j, il, ih, n
 
-    ! s_{\ib,+}, s_{\ib,-}
-    double precision, allocatable :: sp(:,:)
-    double precision, allocatable :: sm(:,:)
-
-    ! \delta s_{\ib}^{vL}
-    double precision, allocatable :: dsvl(:,:)
-    double precision, allocatable :: dsvlm(:,:)
-    double precision, allocatable :: dsvlp(:,:)
-
-    ! s_{i+\half}^{H.O.}
-    double precision, allocatable :: sedge(:,:)
-    double precision, allocatable :: sedgez(:,:,:)
-
-    ! cell-centered indexing
-    allocate(sp(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
-    allocate(sm(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
+    ! van Leer slopes and edge values: along x of a row, along y of the
+    ! plane (sey(:,j) is at j-1/2), and along z of the planes below, at and
+    ! above the row
+    double precision dsx(ilo1-2:ihi1+2), sex(ilo1-1:ihi1+2)
+    double precision dsy(ilo1-1:ihi1+1,ilo2-2:ihi2+2), sey(ilo1-1:ihi1+1,ilo2-1:ihi2+2)
+    double precision dszm(ilo1-1:ihi1+1), dsz0(ilo1-1:ihi1+1), dszp(ilo1-1:ihi1+1)
+    double precision sezm(ilo1-1:ihi1+1), sezp(ilo1-1:ihi1+1)
 
     if (ppm_type .ne. 1) &
          call bl_error("Should have ppm_type = 1 in ppm_type1")
 
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-    ! x-direction
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-    ! cell-centered indexing w/extra x-ghost cell
-    allocate(dsvl(ilo1-2:ihi1+2,ilo2-1:ihi2+1))
-
-    ! edge-centered indexing for x-faces -- ppm_type = 1 only
-    allocate(sedge(ilo1-1:ihi1+2,ilo2-1:ihi2+1))
+    ! Every direction is done a row of cells (ilo1-1:ihi1+1) at a time.
+    ! The row and its neighbors in the sweep direction are contiguous
+    ! pencils of s, so all three sweeps run unit stride.  As in the loops
+    ! this replaced, each slope and edge value along x and y is computed
+    ! once; along z those of three planes are needed for every k3d anyway.
+    il = ilo1-1
+    ih = ihi1+1
+    n  = ih-il+1
 
-    ! compute s at x-edges
+    !$OMP PARALLEL PRIVATE(j,dsx,sex,dszm,dsz0,dszp,sezm,sezp)
 
-    ! compute van Leer slopes in x-direction
-    dsvl = 0.d0
-    do j=ilo2-1,ihi2+1
-       do i=ilo1-2,ihi1+2
-          dsc = 0.5d0 * (s(i+1,j,k3d) - s(i-1,j,k3d))
-          dsl = 2.d0  * (s(i  ,j,k3d) - s(i-1,j,k3d))
-          dsr = 2.d0  * (s(i+1,j,k3d) - s(i  ,j,k3d))
-          if (dsl*dsr .gt. 0.d0) &
-               dsvl(i,j) = sign(1.d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
-       end do
-    end do
-
-    ! interpolate s to x-edges
-    do j=ilo2-1,ihi2+1
-       do i=ilo1-1,ihi1+2
-          sedge(i,j) = 0.5d0*(s(i,j,k3d)+s(i-1,j,k3d)) &
-               - (1.d0/6.d0)*(dsvl(i,j)-dsvl(i-1,j))
-          ! make sure sedge lies in between adjacent cell-centered values
-          sedge(i,j) = max(sedge(i,j),min(s(i,j,k3d),s(i-1,j,k3d)))
-          sedge(i,j) = min(sedge(i,j),max(s(i,j,k3d),s(i-1,j,k3d)))
-       end do
-    end do
-
-    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
-    do j=ilo2-1,ihi2+1
-       do i=ilo1-1,ihi1+1
-
-          ! copy sedge into sp and sm
-          sp(i,j) = sedge(i+1,j)
-          sm(i,j) = sedge(i  ,j)
-
-          ! modify using quadratic limiters
-          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.d0) then
-             sp(i,j) = s(i,j,k3d)
-             sm(i,j) = s(i,j,k3d)
-          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sm(i,j)-s(i,j,k3d))) then
-             sp(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sm(i,j)
-          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sp(i,j)-s(i,j,k3d))) then
-             sm(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sp(i,j)
-          end if
-
-          ! compute x-component of Ip and Im
-          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
-          sigma = abs(u(i,j,k3d,1)-cspd(i,j,k3d))*dt/dx
-          Ip(i,j,kc,1,1) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,1,1) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,1))*dt/dx
-          Ip(i,j,kc,1,2) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,1,2) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,1)+cspd(i,j,k3d))*dt/dx
-          Ip(i,j,kc,1,3) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,1,3) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-       end do
-    end do
-    !$OMP END PARALLEL DO
-
-    deallocate(sedge,dsvl)
-
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-    ! y-direction
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-    ! cell-centered indexing w/extra y-ghost cell
-    allocate( dsvl(ilo1-1:ihi1+1,ilo2-2:ihi2+2))
-
-    ! edge-centered indexing for y-faces
-    allocate(sedge(ilo1-1:ihi1+1,ilo2-1:ihi2+2))
-
-    ! compute s at y-edges
-
-    ! compute van Leer slopes in y-direction
-    dsvl = 0.d0
+    !$OMP DO
     do j=ilo2-2,ihi2+2
-       do i=ilo1-1,ihi1+1
-          dsc = 0.5d0 * (s(i,j+1,k3d) - s(i,j-1,k3d))
-          dsl = 2.d0  * (s(i,j  ,k3d) - s(i,j-1,k3d))
-          dsr = 2.d0  * (s(i,j+1,k3d) - s(i,j  ,k3d))
-          if (dsl*dsr .gt. 0.d0) &
-               dsvl(i,j) = sign(1.d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
-       end do
+       call vl_slope(n, s(il:ih,j-1,k3d), s(il:ih,j,k3d), s(il:ih,j+1,k3d), dsy(:,j))
     end do
+    !$OMP END DO
 
-    ! interpolate s to y-edges
+    !$OMP DO
     do j=ilo2-1,ihi2+2
-       do i=ilo1-1,ihi1+1
-          sedge(i,j) = 0.5d0*(s(i,j,k3d)+s(i,j-1,k3d)) &
-               - (1.d0/6.d0)*(dsvl(i,j)-dsvl(i,j-1))
-          ! make sure sedge lies in between adjacent cell-centered values
-          sedge(i,j) = max(sedge(i,j),min(s(i,j,k3d),s(i,j-1,k3d)))
-          sedge(i,j) = min(sedge(i,j),max(s(i,j,k3d),s(i,j-1,k3d)))
-       end do
+       call ppm_edge(n, s(il:ih,j-1,k3d), s(il:ih,j,k3d), dsy(:,j-1), dsy(:,j), sey(:,j))
     end do
+    !$OMP END DO
 
-    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
+    !$OMP DO
     do j=ilo2-1,ihi2+1
-       do i=ilo1-1,ihi1+1
 
-          ! copy sedge into sp and sm
-          sp(i,j) = sedge(i,j+1)
-          sm(i,j) = sedge(i,j  )
-
-          ! modify using quadratic limiters
-          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.d0) then
-             sp(i,j) = s(i,j,k3d)
-             sm(i,j) = s(i,j,k3d)
-          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sm(i,j)-s(i,j,k3d))) then
-             sp(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sm(i,j)
-          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.d0*abs(sp(i,j)-s(i,j,k3d))) then
-             sm(i,j) = 3.d0*s(i,j,k3d) - 2.d0*sp(i,j)
-          end if
+       ! x-direction
+       call vl_slope(n+2, s(il-2:ih,j,k3d), s(il-1:ih+1,j,k3d), s(il:ih+2,j,k3d), dsx)
+       call ppm_edge(n+1, s(il-1:ih,j,k3d), s(il:ih+1,j,k3d), dsx(il-1:ih), dsx(il:ih+1), sex)
+       call ppm1_row(n, s(il:ih,j,k3d), sex(il:ih), sex(il+1:ih+1), &
+            u(il:ih,j,k3d,1), cspd(il:ih,j,k3d), dt, dx, Ip(:,j,kc,1,:), Im(:,j,kc,1,:))
+
+       ! y-direction
+       call ppm1_row(n, s(il:ih,j,k3d), sey(:,j), sey(:,j+1), &
+            u(il:ih,j,k3d,2), cspd(il:ih,j,k3d), dt, dy, Ip(:,j,kc,2,:), Im(:,j,kc,2,:))
+
+       ! z-direction
+       call vl_slope(n, s(il:ih,j,k3d-2), s(il:ih,j,k3d-1), s(il:ih,j,k3d  ), dszm)
+       call vl_slope(n, s(il:ih,j,k3d-1), s(il:ih,j,k3d  ), s(il:ih,j,k3d+1), dsz0)
+       call vl_slope(n, s(il:ih,j,k3d  ), s(il:ih,j,k3d+1), s(il:ih,j,k3d+2), dszp)
+       call ppm_edge(n, s(il:ih,j,k3d-1), s(il:ih,j,k3d  ), dszm, dsz0, sezm)
+       call ppm_edge(n, s(il:ih,j,k3d  ), s(il:ih,j,k3d+1), dsz0, dszp, sezp)
+       call ppm1_row(n, s(il:ih,j,k3d), sezm, sezp, &
+            u(il:ih,j,k3d,3), cspd(il:ih,j,k3d), dt, dz, Ip(:,j,kc,3,:), Im(:,j,kc,3,:))
 
-          ! compute y-component of Ip and Im
-          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
-          sigma = abs(u(i,j,k3d,2)-cspd(i,j,k3d))*dt/dy
-          Ip(i,j,kc,2,1) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,2,1) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,2))*dt/dy
-          Ip(i,j,kc,2,2) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,2,2) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,2)+cspd(i,j,k3d))*dt/dy
-          Ip(i,j,kc,2,3) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,2,3) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-       end do
-    end do
-    !$OMP END PARALLEL DO
-
-    deallocate(dsvl,sedge)
-
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-    ! z-direction
-    !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-    ! cell-centered indexing
-    allocate( dsvl(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
-    allocate(dsvlm(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
-    allocate(dsvlp(ilo1-1:ihi1+1,ilo2-1:ihi2+1))
-
-    allocate(sedgez(ilo1-1:ihi1+1,ilo2-2:ihi2+3,k3d-1:k3d+2))
-
-    ! compute s at z-edges
-
-    ! compute van Leer slopes in z-direction
-    dsvl  = 0.d0
-    dsvlm = 0.d0
-    dsvlp = 0.d0
-
-    !$OMP PARALLEL DO PRIVATE(i,j,k,dsc,dsl,dsr,s6,sigma)
-    do j=ilo2-1,ihi2+1
-       do i=ilo1-1,ihi1+1
-
-          ! compute on slab below
-          k = k3d-1
-          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
-          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
-          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
-          if (dsl*dsr .gt. 0.d0) &
-               dsvlm(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
-
-          ! compute on slab above
-          k = k3d+1
-          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
-          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
-          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
-          if (dsl*dsr .gt. 0.d0) &
-               dsvlp(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
-
-          ! compute on current slab
-          k = k3d
-          dsc = 0.5d0 * (s(i,j,k+1) - s(i,j,k-1))
-          dsl = 2.0d0 * (s(i,j,k  ) - s(i,j,k-1))
-          dsr = 2.0d0 * (s(i,j,k+1) - s(i,j,k  ))
-          if (dsl*dsr .gt. 0.d0) &
-               dsvl(i,j) = sign(1.0d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr))
-
-          ! interpolate to lo face
-          k = k3d
-          sm(i,j) = 0.5d0*(s(i,j,k)+s(i,j,k-1)) - (1.0d0/6.0d0)*(dsvl(i,j)-dsvlm(i,j))
-          ! make sure sedge lies in between adjacent cell-centered values
-          sm(i,j) = max(sm(i,j),min(s(i,j,k),s(i,j,k-1)))
-          sm(i,j) = min(sm(i,j),max(s(i,j,k),s(i,j,k-1)))
-
-          ! interpolate to hi face
-          k = k3d+1
-          sp(i,j) = 0.5d0*(s(i,j,k)+s(i,j,k-1)) - (1.0d0/6.0d0)*(dsvlp(i,j)-dsvl(i,j))
-          ! make sure sedge lies in between adjacent cell-centered values
-          sp(i,j) = max(sp(i,j),min(s(i,j,k),s(i,j,k-1)))
-          sp(i,j) = min(sp(i,j),max(s(i,j,k),s(i,j,k-1)))
-
-          ! modify using quadratic limiters
-          if ((sp(i,j)-s(i,j,k3d))*(s(i,j,k3d)-sm(i,j)) .le. 0.0d0) then
-             sp(i,j) = s(i,j,k3d)
-             sm(i,j) = s(i,j,k3d)
-          else if (abs(sp(i,j)-s(i,j,k3d)) .ge. 2.0d0*abs(sm(i,j)-s(i,j,k3d))) then
-             sp(i,j) = 3.0d0*s(i,j,k3d) - 2.0d0*sm(i,j)
-          else if (abs(sm(i,j)-s(i,j,k3d)) .ge. 2.0d0*abs(sp(i,j)-s(i,j,k3d))) then
-             sm(i,j) = 3.0d0*s(i,j,k3d) - 2.0d0*sp(i,j)
-          end if
-
-          ! compute z-component of Ip and Im
-          s6 = 6.0d0*s(i,j,k3d) - 3.0d0*(sm(i,j)+sp(i,j))
-          sigma = abs(u(i,j,k3d,3)-cspd(i,j,k3d))*dt/dz
-          Ip(i,j,kc,3,1) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,3,1) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,3))*dt/dz
-          Ip(i,j,kc,3,2) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,3,2) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          sigma = abs(u(i,j,k3d,3)+cspd(i,j,k3d))*dt/dz
-          Ip(i,j,kc,3,3) = sp(i,j) - &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-          Im(i,j,kc,3,3) = sm(i,j) + &
-               (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
-       end do
     end do
-    !$OMP END PARALLEL DO
+    !$OMP END DO
 
-    deallocate(dsvl,dsvlm,dsvlp,sp,sm,sedgez)
+    !$OMP END PARALLEL
 
   end subroutine ppm_type1
 
@@ -820,5 +613,89 @@ contains
 
   end subroutine ppm_type2
 
+  ! :::
+  ! ::: ----------------------------------------------------------------
+  ! ::: PPM (ppm_type = 1) for a row of n cells of s0, whose lo and hi edge
+  ! ::: values in the sweep direction are sm and sp; un is the velocity in
+  ! ::: that direction and dx the cell size.  Ip and Im are traced along the
+  ! ::: u-c, u and u+c characteristics.  The limiters are written with merge
+  ! ::: so the loop has no branches.  sigma is |u|*dt/dx, not |u|*(dt/dx),
+  ! ::: as in the loops this replaced, so that the two agree to the bit.
+  ! :::
+
+  subroutine ppm1_row(n, s0, sm, sp, un, cs, dt, dx, Ip, Im)
+
+    integer, intent(in) :: n
+    double precision, intent(in) :: s0(n), sm(n), sp(n), un(n), cs(n), dt, dx
+    double precision, intent(out) :: Ip(:,:), Im(:,:)
+
+    integer i
+    double precision smi, spi, s6, sigma
+    logical flat, bigp, bigm
+
+    do i=1,n
+
+       ! quadratic limiters
+       flat = (sp(i)-s0(i))*(s0(i)-sm(i)) .le. 0.d0
+       bigp = abs(sp(i)-s0(i)) .ge. 2.d0*abs(sm(i)-s0(i))
+       bigm = abs(sm(i)-s0(i)) .ge. 2.d0*abs(sp(i)-s0(i))
+
+       spi = merge(s0(i), merge(3.d0*s0(i)-2.d0*sm(i), sp(i), bigp), flat)
+       smi = merge(s0(i), merge(3.d0*s0(i)-2.d0*sp(i), sm(i), bigm .and. .not.bigp), flat)
+
+       s6 = 6.0d0*s0(i) - 3.0d0*(smi+spi)
+
+       sigma = abs(un(i)-cs(i))*dt/dx
+       Ip(i,1) = spi - (sigma/2.0d0)*(spi-smi-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       Im(i,1) = smi + (sigma/2.0d0)*(spi-smi+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+
+       sigma = abs(un(i))*dt/dx
+       Ip(i,2) = spi - (sigma/2.0d0)*(spi-smi-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       Im(i,2) = smi + (sigma/2.0d0)*(spi-smi+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+
+       sigma = abs(un(i)+cs(i))*dt/dx
+       Ip(i,3) = spi - (sigma/2.0d0)*(spi-smi-(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+       Im(i,3) = smi + (sigma/2.0d0)*(spi-smi+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
+    end do
+
+  end subroutine ppm1_row
+
+  ! s at the edge between sl and sr, whose van Leer slopes are dsl and dsr,
+  ! kept between the two
+  subroutine ppm_edge(n, sl, sr, dsl, dsr, sedge)
+
+    integer, intent(in) :: n
+    double precision, intent(in) :: sl(n), sr(n), dsl(n), dsr(n)
+    double precision, intent(out) :: sedge(n)
+
+    integer i
+
+    do i=1,n
+       sedge(i) = 0.5d0*(sr(i)+sl(i)) - (1.d0/6.d0)*(dsr(i)-dsl(i))
+       sedge(i) = min(max(sedge(i),min(sr(i),sl(i))),max(sr(i),sl(i)))
+    end do
+
+  end subroutine ppm_edge
+
+  ! van Leer slope of s0, given its neighbors sl and sr
+  subroutine vl_slope(n, sl, s0, sr, dsvl)
+
+    integer, intent(in) :: n
+    double precision, intent(in) :: sl(n), s0(n), sr(n)
+    double precision, intent(out) :: dsvl(n)
+
+    integer i
+    double precision dsc, dsl, dsr
+
+    do i=1,n
+       dsc = 0.5d0 * (sr(i) - sl(i))
+       dsl = 2.d0  * (s0(i) - sl(i))
+       dsr = 2.d0  * (sr(i) - s0(i))
+       dsvl(i) = merge(sign(1.d0,dsc)*min(abs(dsc),abs(dsl),abs(dsr)), 0.d0, &
+            dsl*dsr .gt. 0.d0)
+    end do
+
+  end subroutine vl_slope
+
 end module ppm_module
 
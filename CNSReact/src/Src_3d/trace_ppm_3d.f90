@@ -40,8 +40,10 @@ contains
 
     ! Local variables
     integer i, j
-    integer n, iadv
-    integer ns, ispec
+    integer n
+
+    ! upwind weights of the passive quantities on a row
+    double precision wp(ilo1-1:ihi1+1), wm(ilo1-1:ihi1+1)
 
     double precision dtdx, dtdy
     double precision cc, csq, rho, u, v, w, p, rhoe
@@ -222,76 +224,28 @@ contains
     end do
     !$OMP END PARALLEL DO
 
-    ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,u) IF(nadv.gt.1)
-    do iadv = 1, nadv
-       n = QFA + iadv - 1
-       do j = ilo2-1, ihi2+1
-
-          ! plus state on face i
-          do i = ilo1, ihi1+1
-             u = q(i,j,k3d,QU)
-             if (u .gt. 0.d0) then
-                qxp(i,j,kc,n) = q(i,j,k3d,n)
-             else if (u .lt. 0.d0) then
-                qxp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,1,2,n) - q(i,j,k3d,n))
-             else
-                qxp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,1,2,n) - q(i,j,k3d,n))
-             endif
-          enddo
-
-          ! minus state on face i+1
-          do i = ilo1-1, ihi1
-             u = q(i,j,k3d,QU)
-             if (u .gt. 0.d0) then
-                qxm(i+1,j,kc,n) = q(i,j,k3d,n) &
-                     + flatn(i,j,k3d)*(Ip(i,j,kc,1,2,n) - q(i,j,k3d,n))
-             else if (u .lt. 0.d0) then
-                qxm(i+1,j,kc,n) = q(i,j,k3d,n)
-             else
-                qxm(i+1,j,kc,n) = q(i,j,k3d,n) &
-                     + 0.5d0*flatn(i,j,k3d)*(Ip(i,j,kc,1,2,n) - q(i,j,k3d,n))
-             endif
-          enddo
+    ! Now the passively advected quantities and species, all components in
+    ! one loop.  The upwind weights only depend on u, so they are computed
+    ! once per row.
+    !$OMP PARALLEL DO PRIVATE(n,i,j,u,wp,wm)
+    do j = ilo2-1, ihi2+1
 
+       do i = ilo1-1, ihi1+1
+          u = q(i,j,k3d,QU)
+          wp(i) = flatn(i,j,k3d)*merge(0.d0, merge(1.d0, 0.5d0, u .lt. 0.d0), u .gt. 0.d0)
+          wm(i) = flatn(i,j,k3d)*merge(1.d0, merge(0.d0, 0.5d0, u .lt. 0.d0), u .gt. 0.d0)
        enddo
-    enddo
-    !$OMP END PARALLEL DO
-
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,u) IF(Nspec.gt.1)
-    do ispec = 1, Nspec
-       ns = QFS + ispec - 1
 
-       do j = ilo2-1, ihi2+1
+       do n = QFS-nadv, QFS+nspec-1
 
           ! plus state on face i
           do i = ilo1, ihi1+1
-             u = q(i,j,k3d,QU)
-             if (u .gt. 0.d0) then
-                qxp(i,j,kc,ns) = q(i,j,k3d,ns)
-             else if (u .lt. 0.d0) then
-                qxp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,1,2,ns) - q(i,j,k3d,ns))
-             else
-                qxp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,1,2,ns) - q(i,j,k3d,ns))
-             endif
+             qxp(i,j,kc,n) = q(i,j,k3d,n) + wp(i)*(Im(i,j,kc,1,2,n) - q(i,j,k3d,n))
           enddo
 
           ! minus state on face i+1
           do i = ilo1-1, ihi1
-             u = q(i,j,k3d,QU)
-             if (u .gt. 0.d0) then
-                qxm(i+1,j,kc,ns) = q(i,j,k3d,ns) &
-                     + flatn(i,j,k3d)*(Ip(i,j,kc,1,2,ns) - q(i,j,k3d,ns))
-             else if (u .lt. 0.d0) then
-                qxm(i+1,j,kc,ns) = q(i,j,k3d,ns)
-             else
-                qxm(i+1,j,kc,ns) = q(i,j,k3d,ns) &
-                     + 0.5d0*flatn(i,j,k3d)*(Ip(i,j,kc,1,2,ns) - q(i,j,k3d,ns))
-             endif
+             qxm(i+1,j,kc,n) = q(i,j,k3d,n) + wm(i)*(Ip(i,j,kc,1,2,n) - q(i,j,k3d,n))
           enddo
 
        enddo
@@ -452,76 +406,31 @@ contains
     end do
     !$OMP END PARALLEL DO
 
-    ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,v) IF(nadv.gt.1)
-    do iadv = 1, nadv
-       n = QFA + iadv - 1
-       do i = ilo1-1, ihi1+1
-
-          ! plus state on face j
-          do j = ilo2, ihi2+1
-             v = q(i,j,k3d,QV)
-             if (v .gt. 0.d0) then
-                qyp(i,j,kc,n) = q(i,j,k3d,n)
-             else if (v .lt. 0.d0) then
-                qyp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,2,2,n) - q(i,j,k3d,n))
-             else
-                qyp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,2,2,n) - q(i,j,k3d,n))
-             endif
-          enddo
-
-          ! minus state on face j+1
-          do j = ilo2-1, ihi2
-             v = q(i,j,k3d,QV)
-             if (v .gt. 0.d0) then
-                qym(i,j+1,kc,n) = q(i,j,k3d,n) &
-                     + flatn(i,j,k3d)*(Ip(i,j,kc,2,2,n) - q(i,j,k3d,n))
-             else if (v .lt. 0.d0) then
-                qym(i,j+1,kc,n) = q(i,j,k3d,n)
-             else
-                qym(i,j+1,kc,n) = q(i,j,k3d,n) &
-                     + 0.5d0*flatn(i,j,k3d)*(Ip(i,j,kc,2,2,n) - q(i,j,k3d,n))
-             endif
-          enddo
+    ! Now the passively advected quantities and species
+    !$OMP PARALLEL DO PRIVATE(n,i,j,v,wp,wm)
+    do j = ilo2-1, ihi2+1
 
+       do i = ilo1-1, ihi1+1
+          v = q(i,j,k3d,QV)
+          wp(i) = flatn(i,j,k3d)*merge(0.d0, merge(1.d0, 0.5d0, v .lt. 0.d0), v .gt. 0.d0)
+          wm(i) = flatn(i,j,k3d)*merge(1.d0, merge(0.d0, 0.5d0, v .lt. 0.d0), v .gt. 0.d0)
        enddo
-    enddo
-    !$OMP END PARALLEL DO
 
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,v) IF(Nspec.gt.1)
-    do ispec = 1, Nspec
-       ns = QFS + ispec - 1
-       do i = ilo1-1, ihi1+1
+       do n = QFS-nadv, QFS+nspec-1
 
           ! plus state on face j
-          do j = ilo2, ihi2+1
-             v = q(i,j,k3d,QV)
-             if (v .gt. 0.d0) then
-                qyp(i,j,kc,ns) = q(i,j,k3d,ns)
-             else if (v .lt. 0.d0) then
-                qyp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,2,2,ns) - q(i,j,k3d,ns))
-             else
-                qyp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,2,2,ns) - q(i,j,k3d,ns))
-             endif
-          enddo
+          if (j .ge. ilo2) then
+             do i = ilo1-1, ihi1+1
+                qyp(i,j,kc,n) = q(i,j,k3d,n) + wp(i)*(Im(i,j,kc,2,2,n) - q(i,j,k3d,n))
+             enddo
+          end if
 
           ! minus state on face j+1
-          do j = ilo2-1, ihi2
-             v = q(i,j,k3d,QV)
-             if (v .gt. 0.d0) then
-                qym(i,j+1,kc,ns) = q(i,j,k3d,ns) &
-                     + flatn(i,j,k3d)*(Ip(i,j,kc,2,2,ns) - q(i,j,k3d,ns))
-             else if (v .lt. 0.d0) then
-                qym(i,j+1,kc,ns) = q(i,j,k3d,ns)
-             else
-                qym(i,j+1,kc,ns) = q(i,j,k3d,ns) &
-                     + 0.5d0*flatn(i,j,k3d)*(Ip(i,j,kc,2,2,ns) - q(i,j,k3d,ns))
-             endif
-          enddo
+          if (j .le. ihi2) then
+             do i = ilo1-1, ihi1+1
+                qym(i,j+1,kc,n) = q(i,j,k3d,n) + wm(i)*(Ip(i,j,kc,2,2,n) - q(i,j,k3d,n))
+             enddo
+          end if
 
        enddo
     enddo
@@ -563,8 +472,10 @@ contains
 
     !     Local variables
     integer i, j
-    integer n, iadv
-    integer ns, ispec
+    integer n
+
+    ! upwind weights of the passive quantities on a row
+    double precision wp(ilo1-1:ihi1+1), wm(ilo1-1:ihi1+1)
 
     double precision dtdz
     double precision cc, csq, rho, u, v, w, p, rhoe
@@ -753,73 +664,31 @@ contains
     end do
     !$OMP END PARALLEL DO
 
-    ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,w) IF(nadv.gt.1)
-    do iadv = 1, nadv
-       n = QFA + iadv - 1
-       do j = ilo2-1, ihi2+1
-          do i = ilo1-1, ihi1+1
-
-             ! plus state on face kc
-             w = q(i,j,k3d,QW)
-             if (w .gt. 0.d0) then
-                qzp(i,j,kc,n) = q(i,j,k3d,n)
-             else if (w .lt. 0.d0) then
-                qzp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,3,2,n) - q(i,j,k3d,n))
-             else
-                qzp(i,j,kc,n) = q(i,j,k3d,n) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,3,2,n) - q(i,j,k3d,n))
-             endif
-
-             ! minus state on face k
-             w = q(i,j,k3d-1,QW)
-             if (w .gt. 0.d0) then
-                qzm(i,j,kc,n) = q(i,j,k3d-1,n) &
-                     + flatn(i,j,k3d-1)*(Ip(i,j,km,3,2,n) - q(i,j,k3d-1,n))
-             else if (w .lt. 0.d0) then
-                qzm(i,j,kc,n) = q(i,j,k3d-1,n)
-             else
-                qzm(i,j,kc,n) = q(i,j,k3d-1,n) &
-                     + 0.5d0*flatn(i,j,k3d-1)*(Ip(i,j,km,3,2,n) - q(i,j,k3d-1,n))
-             endif
+    ! Now the passively advected quantities and species, all components in
+    ! one loop.  The upwind weights only depend on w, so they are computed
+    ! once per row.
+    !$OMP PARALLEL DO PRIVATE(n,i,j,w,wp,wm)
+    do j = ilo2-1, ihi2+1
 
-          enddo
+       do i = ilo1-1, ihi1+1
+          w = q(i,j,k3d,QW)
+          wp(i) = flatn(i,j,k3d)*merge(0.d0, merge(1.d0, 0.5d0, w .lt. 0.d0), w .gt. 0.d0)
+          w = q(i,j,k3d-1,QW)
+          wm(i) = flatn(i,j,k3d-1)*merge(1.d0, merge(0.d0, 0.5d0, w .lt. 0.d0), w .gt. 0.d0)
        enddo
-    enddo
-    !$OMP END PARALLEL DO
 
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,w) IF(Nspec.gt.1)
-    do ispec = 1, Nspec
-       ns = QFS + ispec - 1
-       do j = ilo2-1, ihi2+1
-          do i = ilo1-1, ihi1+1
+       do n = QFS-nadv, QFS+nspec-1
 
-             ! plus state on face kc
-             w = q(i,j,k3d,QW)
-             if (w .gt. 0.d0) then
-                qzp(i,j,kc,ns) = q(i,j,k3d,ns)
-             else if (w .lt. 0.d0) then
-                qzp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + flatn(i,j,k3d)*(Im(i,j,kc,3,2,ns) - q(i,j,k3d,ns))
-             else
-                qzp(i,j,kc,ns) = q(i,j,k3d,ns) &
-                     + 0.5d0*flatn(i,j,k3d)*(Im(i,j,kc,3,2,ns) - q(i,j,k3d,ns))
-             endif
-
-             ! minus state on face k
-             w = q(i,j,k3d-1,QW)
-             if (w .gt. 0.d0) then
-                qzm(i,j,kc,ns) = q(i,j,k3d-1,ns) &
-                     + flatn(i,j,k3d-1)*(Ip(i,j,km,3,2,ns) - q(i,j,k3d-1,ns))
-             else if (w .lt. 0.d0) then
-                qzm(i,j,kc,ns) = q(i,j,k3d-1,ns)
-             else
-                qzm(i,j,kc,ns) = q(i,j,k3d-1,ns) &
-                     + 0.5d0*flatn(i,j,k3d-1)*(Ip(i,j,km,3,2,ns) - q(i,j,k3d-1,ns))
-             endif
+          ! plus state on face kc
+          do i = ilo1-1, ihi1+1
+             qzp(i,j,kc,n) = q(i,j,k3d,n) + wp(i)*(Im(i,j,kc,3,2,n) - q(i,j,k3d,n))
+          enddo
 
+          ! minus state on face k
+          do i = ilo1-1, ihi1+1
+             qzm(i,j,kc,n) = q(i,j,k3d-1,n) + wm(i)*(Ip(i,j,km,3,2,n) - q(i,j,k3d-1,n))
           enddo
+
        enddo
     enddo
     !$OMP END PARALLEL DO
@@ -28,4 +28,7 @@ module meth_params_module
   integer         , save :: ppm_type
   integer         , save :: normalize_species
 
+  logical         , save :: use_vode      ! react with VODE instead of BDF
+  logical         , save :: cache_transport
+
 end module meth_params_module
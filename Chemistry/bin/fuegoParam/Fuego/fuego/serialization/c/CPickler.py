@@ -99,7 +99,13 @@ class CPickler(CMill):
         self._write('};')
         self._write()
         nReactions = len(mechanism.reaction())
-        self._write('static struct ReactionData R[%d], R_DEF[%d];' % (nReactions, nReactions))
+        self._write('static struct ReactionData R_SHARED[%d], R_DEF[%d];' % (nReactions, nReactions))
+        self._write()
+        self._write(self.line('reaction data of the calling thread: R_SHARED, or a set bound by SetReactionDataSet'))
+        self._write('static struct ReactionData * R = R_SHARED;')
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(R)')
+        self._write('#endif')
         self._write()
         self._write('struct ReactionData* GetReactionData(int id)')
         self._write('{')
@@ -134,7 +140,7 @@ class CPickler(CMill):
         self._write('void SetReactionData(int id, const struct ReactionData * rhs)')
         self._write('{')
         self._indent()
-        self._write('if (id<0 || id>=175) {')
+        self._write('if (id<0 || id>=%d) {' % (nReactions) )
         self._indent()
         self._write('printf("SetReactionData: Bad reaction id = %d",id);')
         self._write('abort();')
@@ -170,6 +176,24 @@ class CPickler(CMill):
         self._write('r->sri_e = rhs->sri_e;')
         self._outdent()
         self._write('}')
+        self._write()
+
+        self._write(self.line('a private copy of the default reaction data, for SetReactionDataSet'))
+        self._write('struct ReactionData* NewReactionDataSet()')
+        self._write('{')
+        self._indent()
+        self._write('struct ReactionData* rd = malloc(%d * sizeof(struct ReactionData));' % (nReactions))
+        self._write('memcpy(rd, R_DEF, %d * sizeof(struct ReactionData));' % (nReactions))
+        self._write('return rd;')
+        self._outdent()
+        self._write('}')
+        self._write()
+        self._write('void FreeReactionDataSet(struct ReactionData* rd)')
+        self._write('{')
+        self._indent()
+        self._write('free(rd);')
+        self._outdent()
+        self._write('}')
         
         return
 
@@ -285,6 +309,7 @@ class CPickler(CMill):
         self._equilibriumConstants(mechanism)
         self._thermo(mechanism)
         self._molecularWeight(mechanism)
+        self._T_tol(mechanism)
         self._T_given_ey(mechanism)
         return
 
@@ -390,6 +415,7 @@ class CPickler(CMill):
             '#define VCKWYR VCKWYR',
             '#define VCKYTX VCKYTX',
             '#define GET_T_GIVEN_EY GET_T_GIVEN_EY',
+            '#define GET_T_TOL GET_T_TOL',
             '#elif defined(BL_FORT_USE_LOWERCASE)',
             '#define CKINDX ckindx',
             '#define CKINIT ckinit',
@@ -471,6 +497,7 @@ class CPickler(CMill):
             '#define VCKWYR vckwyr',
             '#define VCKYTX vckytx',
             '#define GET_T_GIVEN_EY get_t_given_ey',
+            '#define GET_T_TOL get_t_tol',
             '#elif defined(BL_FORT_USE_UNDERSCORE)',
             '#define CKINDX ckindx_',
             '#define CKINIT ckinit_',
@@ -552,6 +579,7 @@ class CPickler(CMill):
             '#define VCKWYR vckwyr_',
             '#define VCKYTX vckytx_',
             '#define GET_T_GIVEN_EY get_t_given_ey_',
+            '#define GET_T_TOL get_t_tol_',
             '#endif','',
             self.line('function declarations'),
             'void molecularWeight(double * restrict  wt);',
@@ -656,6 +684,7 @@ class CPickler(CMill):
             'void aJacobian(double * restrict J, double * restrict sc, double T, int consP);',
             'void dcvpRdT(double * restrict  species, double * restrict  tc);',
             'void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict rwrk, double * restrict  t, int *ierr);',
+            'void GET_T_TOL(double * restrict tol, int * maxiter);',
             self.line('vector version'),
             'void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);',
             'void VCKHMS'+sym+'(int * restrict np, double * restrict  T, int * iwrk, double * restrict  rwrk, double * restrict  ums);',
@@ -4317,6 +4346,16 @@ class CPickler(CMill):
         self._write('#endif')
         self._write()
 
+        self._write(self.line('bind the calling thread to the set rd, or to the shared data if rd is 0'))
+        self._write('void SetReactionDataSet(struct ReactionData* rd)')
+        self._write('{')
+        self._indent()
+        self._write('R = rd ? rd : R_SHARED;')
+        self._write('T_save = -1;')
+        self._outdent()
+        self._write('}')
+        self._write()
+
         self._write()
         self._write(self.line('compute the production rate for each species'))
         self._write('void productionRate(double * restrict  wdot, double * restrict  sc, double T)')
@@ -6267,27 +6306,37 @@ class CPickler(CMill):
         self._write('%+15.8e ;' % (parameters[6]))
         return
 
-    def _T_given_ey(self, mechanism):
-        self._write(self.line(' get temperature given internal energy in mass units and mass fracs'))
-        self._write('void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  t, int * ierr)')
+    def _T_tol(self, mechanism):
+        self._write(self.line(' tolerance and iteration limit of the Newton solves for T'))
+        self._write('void GET_T_TOL(double * restrict tol, int * maxiter)')
         self._write('{')
         self._write('#ifdef CONVERGENCE')
         self._indent()
-        self._write('const int maxiter = 5000;')
-        self._write('const double tol  = 1.e-12;')
+        self._write('*maxiter = 5000;')
+        self._write('*tol = 1.e-12;')
         self._outdent()
         self._write('#else')
         self._indent()
-        self._write('const int maxiter = 200;')
-        self._write('const double tol  = 1.e-6;')
+        self._write('*maxiter = 200;')
+        self._write('*tol = 1.e-6;')
         self._outdent()
         self._write('#endif')
+        self._write('}')
+        self._write()
+
+    def _T_given_ey(self, mechanism):
+        self._write(self.line(' get temperature given internal energy in mass units and mass fracs'))
+        self._write('void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  t, int * ierr)')
+        self._write('{')
         self._indent()
+        self._write('int maxiter;')
+        self._write('double tol;')
         self._write('double ein  = *e;')
         self._write('double tmin = 250;'+self.line('max lower bound for thermo def'))
         self._write('double tmax = 3500;'+self.line('min upper bound for thermo def'))
         self._write('double e1,emin,emax,cv,t1,dt;')
         self._write('int i;'+self.line(' loop counter'))
+        self._write('GET_T_TOL(&tol, &maxiter);')
         self._write('CKUBMS(&tmin, y, iwrk, rwrk, &emin);')
         self._write('CKUBMS(&tmax, y, iwrk, rwrk, &emax);')
         self._write('if (ein < emin) {')
@@ -6,6 +6,10 @@
 
 #include <Observation.H>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 static Real Patm_DEF = 1;
 static Real dt_DEF   = 1.e-6;
 static Real Tfile_DEF = 1000;
@@ -25,44 +29,100 @@ extern "C" {
 
     *y = ctx.Evolve();
   }
+
+  void observation_ensemble(int num_evals, int num_vals, const Real* pvals, Real* y)
+  {
+    BL_ASSERT(the_obs_ptr);
+    BL_ASSERT(num_vals == the_obs_ptr->NumParameters());
+    the_obs_ptr->EvolveEnsemble(num_evals,pvals,y);
+  }
 }
 
 Real
 Observation::Evolve()
+{
+  return Evolve(members[0]);
+}
+
+void
+Observation::EvolveEnsemble(int num_evals, const Real* pvals, Real* y)
+{
+  const int nParams = NumParameters();
+  const int nProcs  = ParallelDescriptor::NProcs();
+  const int myProc  = ParallelDescriptor::MyProc();
+
+  int nThreads = 1;
+#ifdef _OPENMP
+  nThreads = omp_get_max_threads();
+#endif
+  // Thread tid evaluates on members[tid+1], leaving members[0] to Evolve
+  for (int t=members.size(); t<nThreads+1; ++t) {
+    members.resize(t+1,PArrayManage);
+    members.set(t, NewMember());
+  }
+
+  // Evaluation k is done on rank k % nProcs, and left 0 on the others
+  for (int k=0; k<num_evals; ++k) {
+    y[k] = 0;
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int k=myProc; k<num_evals; k+=nProcs)
+  {
+    int tid = 0;
+#ifdef _OPENMP
+    tid = omp_get_thread_num();
+#endif
+    Member& m = members[tid+1];
+    for (int i=0; i<nParams; ++i) {
+      m.params[i] = pvals[k*nParams+i];
+    }
+    y[k] = Evolve(m);
+  }
+
+  ParallelDescriptor::ReduceRealSum(y,num_evals);
+}
+
+Real
+Observation::Evolve(Member& m) const
 {
   // Evolve the initial state for time interval = dt(s), at pressure Patm (atm)
-  // Return final value of evolved state
-  Reset();
-  const Box& box = funcCnt.box();
+  // with m's parameters.  Return final value of evolved state
+  Reset(m);
+  m.pset.Activate();
+  const Box& box = m.funcCnt.box();
 
 #ifdef LMC_SDC
-  FArrayBox& rYold = s_init;
-  FArrayBox& rYnew = s_final;
-  FArrayBox& rHold = s_init;
-  FArrayBox& rHnew = s_final;
-  FArrayBox& Told  = s_init;
-  FArrayBox& Tnew  = s_final;
+  const FArrayBox& rYold = s_init;
+  FArrayBox&       rYnew = m.s_final;
+  const FArrayBox& rHold = s_init;
+  FArrayBox&       rHnew = m.s_final;
+  const FArrayBox& Told  = s_init;
+  FArrayBox&       Tnew  = m.s_final;
   FArrayBox* diag = 0;
-  cd->solveTransient_sdc(rYnew,rHnew,Tnew,rYold,rHold,Told,C_0,I_R,
-                         funcCnt,box,sCompY,sCompRH,sCompT,
+  cd->solveTransient_sdc(rYnew,rHnew,Tnew,rYold,rHold,Told,C_0,m.I_R,
+                         m.funcCnt,box,sCompY,sCompRH,sCompT,
                          dt,Patm,diag,true);
 #else
-  FArrayBox& Yold = s_init;
-  FArrayBox& Ynew = s_final;
-  FArrayBox& Told = s_init;
-  FArrayBox& Tnew = s_final;
-  cd->solveTransient(Ynew,Tnew,Yold,Told,funcCnt,box,
+  const FArrayBox& Yold = s_init;
+  FArrayBox&       Ynew = m.s_final;
+  const FArrayBox& Told = s_init;
+  FArrayBox&       Tnew = m.s_final;
+  cd->solveTransient(Ynew,Tnew,Yold,Told,m.funcCnt,box,
                           sCompY,sCompT,dt,Patm);
 #endif
 
-  return FinalValue();
+  ChemDriver::ParameterSet::Deactivate();
+  return FinalValue(m);
 }
 
 Real
-Observation::FinalValue() const
+Observation::FinalValue(const Member& m) const
 {
   // Return the final temperature of the cell that was evolved
-  return s_final(s_final.box().smallEnd(),sCompT);
+  return m.s_final(m.s_final.box().smallEnd(),sCompT);
 }
 
 Observation::Observation()
@@ -107,7 +167,6 @@ Observation::Observation()
   Patm = Patm_DEF; pp.query("Patm",Patm);
   dt = dt_DEF; pp.query("dt",dt);
   s_init.resize(bx,fileFAB.nComp()); s_init.copy(fileFAB);
-  funcCnt.resize(bx,1);
   
 #ifdef LMC_SDC
   s_init.mult(1.e3,sCompR,1);
@@ -117,50 +176,72 @@ Observation::Observation()
     s_init.mult(s_init,sCompR,sCompY+i,1);
   }
   C_0.resize(bx,nSpec+1); C_0.setVal(0);
-  I_R.resize(bx,nSpec+1); I_R.setVal(0);
 #endif
 
-  s_final.resize(bx,s_init.nComp());
-  s_final.copy(s_init);
+  members.resize(1,PArrayManage);
+  members.set(0, NewMember());
 }
 
 Observation::~Observation()
 {
+  members.clear();
   delete cd;
-  active_params.clear();
   the_obs_ptr = 0;
 }
 
+Observation::Member*
+Observation::NewMember() const
+{
+  Member* m = new Member;
+  const Box& bx = s_init.box();
+  m->s_final.resize(bx,s_init.nComp());
+  m->s_final.copy(s_init);
+  m->funcCnt.resize(bx,1);
+#ifdef LMC_SDC
+  m->I_R.resize(bx,C_0.nComp()); m->I_R.setVal(0);
+#endif
+  m->params.resize(param_ids.size(),PArrayManage);
+  for (int i=0; i<param_ids.size(); ++i) {
+    m->params.set(i, new ChemDriver::Parameter(param_reactions[i],param_ids[i],&m->pset));
+  }
+  return m;
+}
+
 Real
 Observation::AddParameter(int reaction, 
                           const ChemDriver::REACTION_PARAMETER& rp)
 {
-  int len = active_params.size();
-  active_params.resize(len+1,PArrayManage);
-  active_params.set(len, new ChemDriver::Parameter(reaction,rp));
-  return active_params[len].DefaultValue();
+  int len = param_ids.size();
+  param_reactions.push_back(reaction);
+  param_ids.push_back(rp);
+  for (int t=0; t<members.size(); ++t) {
+    Member& m = members[t];
+    m.params.resize(len+1,PArrayManage);
+    m.params.set(len, new ChemDriver::Parameter(reaction,rp,&m.pset));
+  }
+  return members[0].params[len].DefaultValue();
 }
 
 ChemDriver::Parameter&
 Observation::Parameter(int i)
 {
-  return active_params[i];
+  return members[0].params[i];
 }
 
 const ChemDriver::Parameter&
 Observation::Parameter(int i) const
 {
-  return active_params[i];
+  return members[0].params[i];
 }
 
 int
 Observation::NumParameters() const
 {
-  return active_params.size();
+  return param_ids.size();
 }
 
 void
-Observation::Reset()
+Observation::Reset(Member& m) const
 {
-  funcCnt.setVal(0);
+  m.funcCnt.setVal(0);
 }
@@ -85,6 +85,7 @@
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_TOL GET_T_TOL
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
 #define CKINIT ckinit
@@ -166,6 +167,7 @@
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_TOL get_t_tol
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
 #define CKINIT ckinit_
@@ -247,6 +249,7 @@
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_TOL get_t_tol_
 #endif
 
 /*function declarations */
@@ -341,6 +344,7 @@ void DWDOT(double * restrict  J, double * restrict  sc, double * T, int * consP)
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict  species, double * restrict  tc);
 void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict rwrk, double * restrict  t, int *ierr);
+void GET_T_TOL(double * restrict tol, int * maxiter);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
 void VCKHMS(int * restrict np, double * restrict  T, int * iwrk, double * restrict  rwrk, double * restrict  ums);
@@ -402,7 +406,13 @@ struct ReactionData {
     double sri_a, sri_b, sri_c, sri_d, sri_e;
 };
 
-static struct ReactionData R[175], R_DEF[175];
+static struct ReactionData R_SHARED[175], R_DEF[175];
+
+/*reaction data of the calling thread: R_SHARED, or a set bound by SetReactionDataSet */
+static struct ReactionData * R = R_SHARED;
+#ifdef _OPENMP
+#pragma omp threadprivate(R)
+#endif
 
 struct ReactionData* GetReactionData(int id)
 {
@@ -459,6 +469,19 @@ void SetReactionData(int id, const struct ReactionData * rhs)
     r->sri_e = rhs->sri_e;
 }
 
+/*a private copy of the default reaction data, for SetReactionDataSet */
+struct ReactionData* NewReactionDataSet()
+{
+    struct ReactionData* rd = malloc(175 * sizeof(struct ReactionData));
+    memcpy(rd, R_DEF, 175 * sizeof(struct ReactionData));
+    return rd;
+}
+
+void FreeReactionDataSet(struct ReactionData* rd)
+{
+    free(rd);
+}
+
 /* Initializes static database */
 void CKINIT()
 {
@@ -9869,6 +9892,13 @@ static double Kc_save[175];
 #pragma omp threadprivate(Kc_save)
 #endif
 
+/*bind the calling thread to the set rd, or to the shared data if rd is 0 */
+void SetReactionDataSet(struct ReactionData* rd)
+{
+    R = rd ? rd : R_SHARED;
+    T_save = -1;
+}
+
 
 /*compute the production rate for each species */
 void productionRate(double * restrict  wdot, double * restrict  sc, double T)
@@ -35188,21 +35218,29 @@ void molecularWeight(double * restrict  wt)
 
     return;
 }
-/* get temperature given internal energy in mass units and mass fracs */
-void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  t, int * ierr)
+/* tolerance and iteration limit of the Newton solves for T */
+void GET_T_TOL(double * restrict tol, int * maxiter)
 {
 #ifdef CONVERGENCE
-    const int maxiter = 5000;
-    const double tol  = 1.e-12;
+    *maxiter = 5000;
+    *tol = 1.e-12;
 #else
-    const int maxiter = 200;
-    const double tol  = 1.e-6;
+    *maxiter = 200;
+    *tol = 1.e-6;
 #endif
+}
+
+/* get temperature given internal energy in mass units and mass fracs */
+void GET_T_GIVEN_EY(double * restrict  e, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  t, int * ierr)
+{
+    int maxiter;
+    double tol;
     double ein  = *e;
     double tmin = 250;/*max lower bound for thermo def */
     double tmax = 3500;/*min upper bound for thermo def */
     double e1,emin,emax,cv,t1,dt;
     int i;/* loop counter */
+    GET_T_TOL(&tol, &maxiter);
     CKUBMS(&tmin, y, iwrk, rwrk, &emin);
     CKUBMS(&tmax, y, iwrk, rwrk, &emax);
     if (ein < emin) {
@@ -52,6 +52,34 @@ main (int   argc,
   test_observation(&observation_function,cnt,pdata.dataPtr(),&ret);
   std::cout << "Observation (F90): " << ret << std::endl;
 
+  // Evaluate an ensemble at once: the defaults with the first parameter
+  // scaled by each of the factors
+  const int nEvals = 5;
+  const Real scale[nEvals] = {1, 0.98, 0.99, 1.01, 1.02};
+  Array<Real> pens(nEvals*cnt), yens(nEvals);
+  for (int k=0; k<nEvals; ++k) {
+    for (int i=0; i<cnt; ++i) {
+      pens[k*cnt+i] = pdata[i];
+    }
+    pens[k*cnt] *= scale[k];
+  }
+  observation_ensemble(nEvals,cnt,pens.dataPtr(),yens.dataPtr());
+  for (int k=0; k<nEvals; ++k) {
+    std::cout << "Observation (ensemble, scale " << scale[k] << "): " << yens[k] << std::endl;
+  }
+
+  // The ensemble must not disturb the values set through Parameter(i): an
+  // Evolve after it gives the same observation as the one before
+  ctx.Parameter(0) = 0.97*pdata[0];
+  const Real yBefore = ctx.Evolve();
+  observation_ensemble(nEvals,cnt,pens.dataPtr(),yens.dataPtr());
+  const Real yAfter = ctx.Evolve();
+  std::cout << "Observation (scale 0.97, before/after ensemble): "
+            << yBefore << " " << yAfter << std::endl;
+  if (yAfter != yBefore) {
+    BoxLib::Abort("EvolveEnsemble changed the parameters of Evolve");
+  }
+
   BoxLib::Finalize();
 }
 
@@ -57,6 +57,9 @@ extern "C" {
   struct ReactionData* GetReactionData(int id);
   struct ReactionData* GetDefaultReactionData(int id);
   void SetReactionData(int id, const struct ReactionData * rhs);
+  struct ReactionData* NewReactionDataSet();
+  void FreeReactionDataSet(struct ReactionData* rd);
+  void SetReactionDataSet(struct ReactionData* rd);
 }
 
 ChemDriver::ChemDriver ()
@@ -112,17 +115,52 @@ Real* get_parameter_value(ChemDriver::REACTION_PARAMETER param_id,
   return ret;
 }
 
+ChemDriver::ParameterSet::ParameterSet()
+{
+  if (!initialized) {
+    BoxLib::Abort("ChemDriver::ParameterSet: no ChemDriver yet, so no default reaction data");
+  }
+  data = NewReactionDataSet();
+}
+
+ChemDriver::ParameterSet::~ParameterSet()
+{
+  FreeReactionDataSet(data);
+}
+
+void
+ChemDriver::ParameterSet::Activate() const
+{
+  SetReactionDataSet(data);
+}
+
+void
+ChemDriver::ParameterSet::Deactivate()
+{
+  SetReactionDataSet(0);
+}
+
 ChemDriver::Parameter::Parameter(int                _reaction_id,
-                                 REACTION_PARAMETER _param_id)
+                                 REACTION_PARAMETER _param_id,
+                                 ParameterSet*      _set)
 {
   reaction_id = _reaction_id;
   param_id = _param_id;
+  set = _set;
+}
+
+ReactionData*
+ChemDriver::Parameter::Data() const
+{
+  // GetReactionData checks the id, and is the thread's data if there is no set
+  ReactionData* r = GetReactionData(reaction_id);
+  return (set == 0) ? r : set->data + reaction_id;
 }
 
 Real
 ChemDriver::Parameter::Parameter::Value() const
 {
-  return *get_parameter_value(param_id, GetReactionData(reaction_id));
+  return *get_parameter_value(param_id, Data());
 }
 
 Real
@@ -175,7 +213,7 @@ std::ostream& operator<< (std::ostream&  os, const ChemDriver::Parameter& param)
 void
 ChemDriver::Parameter::operator=(Real new_value)
 {
-  *get_parameter_value(param_id, GetReactionData(reaction_id)) = new_value;
+  *get_parameter_value(param_id, Data()) = new_value;
 }
 
 void
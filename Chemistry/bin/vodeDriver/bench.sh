@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# Run the vodeDriver benchmark for each mechanism with a sample flame FAB
+# here, one build per mechanism.  Results go to bench_<model>.json.
+#
+#   ./bench.sh [extra vodeDriver options, e.g. "dts=1e-6 1e-5" nthreads="1 4"]
+#
+# Only the 3D FORT_CONPSOLV is threaded, so the builds are DIM=3 with
+# USE_OMP=TRUE unless DIM or USE_OMP is set in the environment (a DIM=2 or
+# serial build runs single threaded).  The 3D runs read the .3d.fab
+# inputs; those not shipped are made from the 2D FAB by giving its box a
+# third dimension.
+#
+DIM=${DIM:-3}
+USE_OMP=${USE_OMP:-TRUE}
+
+CASES="CHEMH:chem-H_0370.fab DRM19:drm19_0700.fab GRI30:gri30_0750.fab LUDME:dme_0700_1444pt.fab"
+
+for c in $CASES; do
+  model=${c%%:*}
+  fab=${c#*:}
+  if [ "$DIM" = "3" ]; then
+    fab3=${fab%.fab}.3d.fab
+    if [ ! -f $fab3 ]; then
+      { head -n 1 $fab | sed 's/((\([-0-9]*\),\([-0-9]*\)) (\([-0-9]*\),\([-0-9]*\)) (\([-0-9]*\),\([-0-9]*\)))/((\1,\2,0) (\3,\4,0) (\5,\6,0))/'
+        tail -n +2 $fab; } > $fab3
+    fi
+    fab=$fab3
+  fi
+  echo "=== $model ($fab)"
+  make clean DIM=$DIM USE_OMP=$USE_OMP CHEMISTRY_MODEL=$model > /dev/null
+  make -j4 DIM=$DIM USE_OMP=$USE_OMP CHEMISTRY_MODEL=$model > make_$model.log 2>&1 || { echo "build failed, see make_$model.log"; continue; }
+  exe=`ls -t cdvode*.ex | head -1`
+  ./$exe bench=1 mechanism=$model pmf_files=$fab json_file=bench_$model.json "$@"
+done
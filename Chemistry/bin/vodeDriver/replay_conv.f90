@@ -0,0 +1,160 @@
+! Constant-volume integrations for the corpus replay of vodeDriver, i.e. the
+! cap_conv records that the RNS and SMC burners capture.  The right-hand
+! side and Jacobian are those of cv_feval, as in the burners, and either
+! DVODE or the multi-point BDF of Chemistry/src_common integrates them.
+!
+! The state of cell i is YT(:,i) = (Y,T) and rho(i) its density.  On
+! return cost(i) is the number of right-hand side evaluations spent on the
+! cell (with BDF, on its batch) and ok(i) is 0 where the integration
+! failed; YT of a failed BDF batch is left as it was.
+module replay_conv_module
+
+  use iso_c_binding, only : c_int, c_double
+  use chemistry_module, only : chemistry_initialized, chemistry_init
+  use bdf, only : bdf_ts, bdf_ts_build, bdf_ts_destroy, bdf_advance
+  use cv_feval, only : cv_rhs => f_rhs, cv_jac => f_jac, rho, max_npt
+
+  implicit none
+
+  ! largest number of VODE steps, as max_vode_subcycles in ChemDriver
+  integer, parameter, private :: max_steps = 15000
+
+  private
+
+  public :: replay_conv_vode, replay_conv_bdf
+
+contains
+
+  ! stiff /= 0: BDF with a finite difference Jacobian (MF=22), else Adams
+  ! (MF=10), as for the constant pressure records.
+  subroutine replay_conv_vode(neq, n, YT, rho_in, dt, rtol, atol, stiff, cost, ok) &
+       bind(c, name='replay_conv_vode')
+    integer(c_int), intent(in) :: neq, n, stiff
+    real(c_double), intent(inout) :: YT(neq,n)
+    real(c_double), intent(in) :: rho_in(n), dt, rtol, atol
+    real(c_double), intent(out) :: cost(n)
+    integer(c_int), intent(out) :: ok(n)
+
+    integer, parameter :: itol = 1, itask = 1, iopt = 1
+    integer :: i, istate, MF, lrw, liw, ipar(1)
+    double precision :: time, rpar(1)
+    double precision, allocatable :: rwork(:)
+    integer, allocatable :: iwork(:)
+
+    ! The DVODE of Chemistry/src reuses the Jacobian of the previous cell
+    ! unless FIRST is set (see vode.H); each call starts with a new one.
+    double precision :: YJ_SAVE(80)
+    logical :: FIRST
+    common /VHACK/ YJ_SAVE, FIRST
+    !$omp threadprivate(/VHACK/)
+
+    external dvode
+
+    if (.not. chemistry_initialized) call chemistry_init()
+
+    lrw = 22 + 9*neq + 2*neq**2
+    liw = 30 + neq
+    allocate(rwork(lrw), iwork(liw))
+
+    FIRST = .true.
+
+    do i = 1, n
+
+       rwork(5:10) = 0.d0
+       iwork(5:10) = 0
+       iwork(6) = max_steps
+
+       rpar(1) = rho_in(i)
+
+       istate = 1
+       time = 0.d0
+
+       MF = merge(22, 10, stiff .ne. 0)  ! vode might change its sign!
+       call dvode(vode_rhs, neq, YT(:,i), time, dt, itol, rtol, atol, itask, &
+            istate, iopt, rwork, lrw, iwork, liw, vode_jac, MF, rpar, ipar)
+
+       cost(i) = iwork(12)
+       ok(i) = merge(1, 0, istate .gt. 0)
+
+    end do
+
+    deallocate(rwork, iwork)
+
+  end subroutine replay_conv_vode
+
+
+  ! Cells go through bdf_advance npt at a time (at most max_npt of
+  ! cv_feval), a short last batch padded with copies of its last cell, as
+  ! in the RNS burner.  order and reuse_jac are those of the bdf.* inputs.
+  subroutine replay_conv_bdf(neq, n, YT, rho_in, dt, rtol, atol, order, npt_in, reuse_jac, &
+       cost, ok) bind(c, name='replay_conv_bdf')
+    integer(c_int), intent(in) :: neq, n, order, npt_in, reuse_jac
+    real(c_double), intent(inout) :: YT(neq,n)
+    real(c_double), intent(in) :: rho_in(n), dt, rtol, atol
+    real(c_double), intent(out) :: cost(n)
+    integer(c_int), intent(out) :: ok(n)
+
+    type(bdf_ts) :: ts
+    integer :: i, p, nb, npt, ierr
+    logical :: reuse
+    double precision :: rtolv(neq), atolv(neq)
+    double precision, allocatable :: y0(:,:), y1(:,:)
+
+    if (.not. chemistry_initialized) call chemistry_init()
+
+    npt = min(max(npt_in,1), max_npt)
+
+    rtolv = rtol
+    atolv = atol
+    call bdf_ts_build(ts, neq, npt, rtolv, atolv, max_order=order)
+
+    allocate(y0(neq,npt), y1(neq,npt))
+
+    reuse = .false.
+
+    do i = 1, n, npt
+
+       nb = min(npt, n-i+1)
+
+       rho(1:nb) = rho_in(i:i+nb-1)
+       y0(:,1:nb) = YT(:,i:i+nb-1)
+       do p = nb+1, npt
+          rho(p) = rho(nb)
+          y0(:,p) = y0(:,nb)
+       end do
+
+       call bdf_advance(ts, cv_rhs, cv_jac, neq, npt, y0, 0.d0, y1, dt, dt, &
+            .true., reuse, ierr)
+
+       reuse = reuse_jac .ne. 0
+
+       cost(i:i+nb-1) = ts%nfe
+       ok(i:i+nb-1) = merge(1, 0, ierr .eq. 0)
+
+       if (ierr .eq. 0) YT(:,i:i+nb-1) = y1(:,1:nb)
+
+    end do
+
+    deallocate(y0, y1)
+
+    call bdf_ts_destroy(ts)
+
+  end subroutine replay_conv_bdf
+
+
+  subroutine vode_rhs(neq, time, y, ydot, rpar, ipar)
+    integer :: neq, ipar(*)
+    double precision :: time, y(neq), ydot(neq), rpar(*)
+    rho(1) = rpar(1)
+    call cv_rhs(neq, 1, y, time, ydot)
+  end subroutine vode_rhs
+
+
+  subroutine vode_jac(neq, time, y, ml, mu, pd, nrpd, rpar, ipar)
+    integer :: neq, ml, mu, nrpd, ipar(*)
+    double precision :: time, y(neq), pd(nrpd,neq), rpar(*)
+    rho(1) = rpar(1)
+    call cv_jac(neq, 1, y, time, pd)
+  end subroutine vode_jac
+
+end module replay_conv_module
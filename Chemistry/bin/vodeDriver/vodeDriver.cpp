@@ -1,5 +1,15 @@
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "Utility.H"
 #include "ParallelDescriptor.H"
@@ -9,6 +19,8 @@
 static Real Patm_DEF    = 1;
 static Real dt_DEF      = 1.e-5;
 static bool verbose_DEF = false;
+static int  stiff_DEF   = 1;
+static Real ref_fac_DEF = 1.e-3;
 
 static
 void 
@@ -17,13 +29,539 @@ print_usage (int,
 {
    std::cerr << "usage:\n";
    std::cerr << argv[0] << " pmf_file=<input fab file name> [options] \n";
+   std::cerr << "   or " << argv[0] << " corpus=<captured states file> [options] \n";
+   std::cerr << "   or " << argv[0] << " bench=1 pmf_files=<input fab file names> [options] \n";
    std::cerr << "\tOptions:       Patm = <pressure, in atmospheres>              [DEFAULT = " << Patm_DEF << "]\n";
    std::cerr << "\t                 dt = <time interval, in seconds>             [DEFAULT = " << dt_DEF << "]\n";
    std::cerr << "\t        fabfile_out = <output fab file name, null->no output> [DEFAULT = \"\"""]\n";
    std::cerr << "\t            verbose = <0,1>                                   [DEFAULT = " << verbose_DEF << "]\n";
+   std::cerr << "\t         check_diag = <0,1>, recheck with rates of progress   [DEFAULT = 1]\n";
+   std::cerr << "\tCorpus options: stiff = <0 (Adams),1 (BDF, FD Jacobian)>        [DEFAULT = " << stiff_DEF << "]\n";
+   std::cerr << "\t            ref_fac = <tolerance factor of the reference solve> [DEFAULT = " << ref_fac_DEF << "]\n";
+   std::cerr << "\t              bdf.* = <BDF options of the constant volume replay, as in RNS>\n";
+   std::cerr << "\tBench options:   dts = <time intervals>                       [DEFAULT = " << dt_DEF << "]\n";
+   std::cerr << "\t           nthreads = <OpenMP thread counts>                  [DEFAULT = max]\n";
+   std::cerr << "\t            solvers = <adams bdf_fd bdf_aj>                   [DEFAULT = all built]\n";
+   std::cerr << "\t               nrep = <repetitions, fastest reported>        [DEFAULT = 1]\n";
+   std::cerr << "\t          mechanism = <name recorded in the results>\n";
+   std::cerr << "\t          json_file = <JSON results file, null->no output>  [DEFAULT = \"\"""]\n";
    exit(1);
 }
 
+extern "C"
+{
+    void replay_conv_vode (const int* neq, const int* n, Real* YT, const Real* rho,
+                           const Real* dt, const Real* rtol, const Real* atol,
+                           const int* stiff, Real* cost, int* ok);
+
+    void replay_conv_bdf (const int* neq, const int* n, Real* YT, const Real* rho,
+                          const Real* dt, const Real* rtol, const Real* atol,
+                          const int* order, const int* npt, const int* reuse_jac,
+                          Real* cost, int* ok);
+}
+
+//
+// Replay the constant volume records of a corpus (recs, laid out as in the
+// file) through the integrators of the RNS and SMC burners: DVODE, with the
+// ht.vode_rtol and ht.vode_atol tolerances, and the multi-point BDF of
+// Chemistry/src_common, with the bdf.* inputs of the RNS ChemDriver.  See
+// replay_conv.f90.  Runs of records with the same dt are integrated
+// together, and each result is compared with a VODE BDF solve at the VODE
+// tolerances scaled by ref_fac.
+//
+static
+void
+replay_conv (const std::vector<Real>& recs,
+             int                      nSpec,
+             bool                     stiff,
+             Real                     ref_fac)
+{
+    const int nr     = nSpec + 6;
+    const int neq    = nSpec + 1;
+    const int ncells = recs.size() / nr;
+
+    ParmParse pph("ht");
+
+    Real vrtol = 1.e-10, vatol = 1.e-10;
+
+    pph.query("vode_rtol",vrtol);
+    pph.query("vode_atol",vatol);
+
+    ParmParse ppb("bdf");
+
+    Real brtol = 1.e-10, batol = 1.e-10;
+    int  order = 6, reuse_jac = 1, multipoint = 1;
+
+    ppb.query("rtol",brtol);
+    ppb.query("atol",batol);
+    ppb.query("order",order);
+    ppb.query("reuse_jac",reuse_jac);
+    ppb.query("multipoint",multipoint);
+
+    const int  npt    = multipoint ? 8 : 1; // max_npt of cv_feval
+    const int  istiff = stiff, ref_stiff = 1;
+    const Real rrtol  = vrtol*ref_fac, ratol = vatol*ref_fac;
+
+    const int   nsolv = 2;
+    std::string solver[nsolv] = { stiff ? "VODE BDF" : "VODE Adams", "BDF" };
+    Real        solve_time[nsolv] = {0}, nfe[nsolv] = {0}, maxerrT[nsolv] = {0}, maxerrY[nsolv] = {0};
+    int         nfail[nsolv] = {0};
+
+    for (int c0 = 0; c0 < ncells; )
+    {
+        const Real* r0 = &recs[c0*nr];
+        //
+        // The run of cells sharing dt.
+        //
+        int n = 1;
+        while (c0+n < ncells && recs[(c0+n)*nr+2] == r0[2])
+            n++;
+
+        const Real dt = r0[2];
+        //
+        // State (Y, T) of each cell, as cv_feval has it.
+        //
+        std::vector<Real> YT0(n*neq), rho(n), cost(n);
+        std::vector<int>  ok(n), ref_ok(n);
+
+        for (int i = 0; i < n; i++)
+        {
+            const Real* r = &recs[(c0+i)*nr];
+            rho[i] = r[5];
+            for (int k = 0; k < nSpec; k++)
+                YT0[i*neq+k] = r[6+k];
+            YT0[i*neq+nSpec] = r[4];
+        }
+
+        std::vector<Real> ref(YT0);
+
+        replay_conv_vode(&neq,&n,&ref[0],&rho[0],&dt,&rrtol,&ratol,&ref_stiff,&cost[0],&ref_ok[0]);
+
+        for (int s = 0; s < nsolv; s++)
+        {
+            std::vector<Real> YT(YT0);
+
+            double strt_time = ParallelDescriptor::second();
+
+            if (s == 0)
+                replay_conv_vode(&neq,&n,&YT[0],&rho[0],&dt,&vrtol,&vatol,&istiff,&cost[0],&ok[0]);
+            else
+                replay_conv_bdf(&neq,&n,&YT[0],&rho[0],&dt,&brtol,&batol,&order,&npt,&reuse_jac,
+                                &cost[0],&ok[0]);
+
+            solve_time[s] += ParallelDescriptor::second() - strt_time;
+
+            for (int i = 0; i < n; i++)
+            {
+                nfe[s] += cost[i];
+
+                if (!ok[i])
+                {
+                    nfail[s]++;
+                    continue;
+                }
+                if (!ref_ok[i])
+                    continue;
+
+                maxerrT[s] = std::max(maxerrT[s],std::abs(YT[i*neq+nSpec]-ref[i*neq+nSpec]));
+                for (int k = 0; k < nSpec; k++)
+                    maxerrY[s] = std::max(maxerrY[s],std::abs(YT[i*neq+k]-ref[i*neq+k]));
+            }
+        }
+
+        c0 += n;
+    }
+
+    for (int s = 0; s < nsolv; s++)
+    {
+        std::cout << " ... constant volume, " << solver[s] << '\n';
+        std::cout << " ... cells: " << ncells << ", failed: " << nfail[s] << '\n';
+        std::cout << " ... solve time: " << solve_time[s]
+                  << " (" << ncells/std::max(solve_time[s],1.e-30) << " cells/s)\n";
+        std::cout << " ... function evals per cell: " << nfe[s]/ncells
+                  << (s == 1 ? " (per batch of cells)" : "") << '\n';
+        std::cout << " ... max |T - Tref|: " << maxerrT[s]
+                  << ", max |Y - Yref|: " << maxerrY[s] << '\n';
+    }
+}
+
+//
+// Replay a corpus of states captured in production (chem.capture_file, see
+// chem_capture_module.f90).  Runs of records with the same pressure and dt
+// are integrated together, as a box would be, then once more with the
+// tolerances scaled by ref_fac to measure the error of the first solve.
+// This ChemDriver integrates constant pressure records only; the constant
+// volume ones written by RNS and SMC go to replay_conv.
+//
+static
+void
+replay_corpus (ChemDriver&        cd,
+               const std::string& corpus,
+               bool               stiff,
+               Real               ref_fac)
+{
+    std::ifstream is(corpus.c_str(), std::ios::in|std::ios::binary);
+
+    char magic[8];
+    int  nspec = 0;
+
+    is.read(magic,8);
+    is.read((char*) &nspec, sizeof(int));
+
+    if (!is.good() || std::strncmp(magic,"CHEMCAP1",8) != 0)
+        BoxLib::Abort("vodeDriver: not a chemistry corpus file");
+
+    const int nSpec = cd.numSpecies();
+
+    if (nspec != nSpec)
+    {
+        std::cout << "corpus is not compatible with the mechanism compiled into this code" << '\n';
+        BoxLib::Abort();
+    }
+    //
+    // Record: kind, status, dt, cost, T, p_or_rho, Y.
+    //
+    const int nr = nSpec + 6;
+
+    std::vector<Real> recs, conv;
+    std::vector<Real> rec(nr);
+
+    int nrec = 0, nfailed = 0;
+
+    while (is.read((char*) &rec[0], nr*sizeof(Real)))
+    {
+        nrec++;
+        if (rec[1] != 0)
+            nfailed++;
+        if (int(rec[0]) == 1)
+            recs.insert(recs.end(),rec.begin(),rec.end());
+        else
+            conv.insert(conv.end(),rec.begin(),rec.end());
+    }
+
+    std::cout << " ... " << nrec << " records, " << nfailed << " failed in production, "
+              << conv.size()/nr << " constant volume\n";
+
+    if (!conv.empty())
+        replay_conv(conv,nSpec,stiff,ref_fac);
+
+    const int ncells = recs.size() / nr;
+
+    if (ncells == 0)
+        return;
+
+    ParmParse pph("ht");
+
+    int  itol = 1;
+    Real rtol = 1.e-10, atol = 1.e-10;
+
+    pph.query("vode_itol",itol);
+    pph.query("vode_rtol",rtol);
+    pph.query("vode_atol",atol);
+
+    Real nfe = 0, nje = 0, nlu = 0, dum;
+    Real solve_time = 0, maxerrT = 0, maxerrY = 0;
+    int  nfail = 0;
+
+    cd.getVodeStats(dum,dum,dum);
+
+    for (int c0 = 0; c0 < ncells; )
+    {
+        const Real* r0 = &recs[c0*nr];
+        //
+        // The run of cells sharing dt and pressure.
+        //
+        int n = 1;
+        while (c0+n < ncells && recs[(c0+n)*nr+2] == r0[2] && recs[(c0+n)*nr+5] == r0[5])
+            n++;
+
+        const Real dt   = r0[2];
+        const Real Patm = r0[5] / 1.01325e6;
+
+        IntVect hi(IntVect::TheZeroVector());
+        hi[0] = n-1;
+        const Box box(IntVect::TheZeroVector(),hi);
+
+        FArrayBox state(box,nSpec+1), ref(box,nSpec+1), funcCnt(box,1);
+        const int sCompT = 0, sCompY = 1;
+
+        for (int i = 0; i < n; i++)
+        {
+            IntVect iv(IntVect::TheZeroVector());
+            iv[0] = i;
+            const Real* r = &recs[(c0+i)*nr];
+            state(iv,sCompT) = r[4];
+            for (int k = 0; k < nSpec; k++)
+                state(iv,sCompY+k) = r[6+k];
+        }
+        ref.copy(state);
+
+        std::vector<bool> ok(n,true);
+
+        double strt_time = ParallelDescriptor::second();
+
+        if (!cd.solveTransient(state,state,state,state,funcCnt,box,sCompY,sCompT,dt,Patm,0,stiff))
+        {
+            //
+            // Redo the run cell by cell to find the failures.
+            //
+            for (int i = 0; i < n; i++)
+            {
+                IntVect iv(IntVect::TheZeroVector());
+                iv[0] = i;
+                const Box cbox(iv,iv);
+                state.copy(ref,cbox);
+                ok[i] = cd.solveTransient(state,state,state,state,funcCnt,cbox,sCompY,sCompT,dt,Patm,0,stiff);
+                if (!ok[i])
+                    nfail++;
+            }
+        }
+
+        solve_time += ParallelDescriptor::second() - strt_time;
+
+        Real fe, je, lu;
+        cd.getVodeStats(fe,je,lu);
+        nfe += fe; nje += je; nlu += lu;
+        //
+        // Reference solution, BDF at tightened tolerances.
+        //
+        cd.set_vode_tols(rtol*ref_fac,atol*ref_fac,itol);
+
+        for (int i = 0; i < n; i++)
+        {
+            IntVect iv(IntVect::TheZeroVector());
+            iv[0] = i;
+            const Box cbox(iv,iv);
+            if (ok[i] && cd.solveTransient(ref,ref,ref,ref,funcCnt,cbox,sCompY,sCompT,dt,Patm,0,true))
+            {
+                maxerrT = std::max(maxerrT,std::abs(state(iv,sCompT)-ref(iv,sCompT)));
+                for (int k = 0; k < nSpec; k++)
+                    maxerrY = std::max(maxerrY,std::abs(state(iv,sCompY+k)-ref(iv,sCompY+k)));
+            }
+        }
+
+        cd.set_vode_tols(rtol,atol,itol);
+        cd.getVodeStats(dum,dum,dum);
+
+        c0 += n;
+    }
+
+    std::cout << " ... constant pressure\n";
+    std::cout << " ... cells: " << ncells << ", failed: " << nfail << '\n';
+    std::cout << " ... solve time: " << solve_time
+              << " (" << ncells/std::max(solve_time,1.e-30) << " cells/s)\n";
+    std::cout << " ... function evals: " << nfe
+              << ", Jacobians: " << nje
+              << ", LU decompositions: " << nlu << '\n';
+    std::cout << " ... max |T - Tref|: " << maxerrT
+              << ", max |Y - Yref|: " << maxerrY << '\n';
+}
+
+//
+// Percentile p (0 to 1) of the sorted v.
+//
+static
+Real
+percentile (const std::vector<Real>& v,
+            Real                     p)
+{
+    if (v.empty()) return 0;
+    const int i = std::min(int(p*(v.size()-1) + 0.5), int(v.size()-1));
+    return v[i];
+}
+
+//
+// Benchmark solveTransient over each of the pmf files compatible with the
+// compiled mechanism, for each dt, thread count (with OpenMP) and solver:
+//
+//   adams   VODE Adams (non-stiff)
+//   bdf_fd  VODE BDF, finite difference Jacobian
+//   bdf_aj  VODE BDF, the mechanism's analytic Jacobian (needs DO_AJAC)
+//
+// Each case is run nrep times from the same initial data; the fastest run
+// is reported, with the VODE counters and the distribution of the
+// right-hand side evaluations per cell.  The results go to stdout and, as
+// JSON, to json_file.  The mechanism is fixed at compile time; bench.sh
+// builds and runs the driver for each.
+//
+static
+void
+run_benchmark (ChemDriver& cd,
+               ParmParse&  pp)
+{
+    const int nSpec  = cd.numSpecies();
+    const int nComp  = nSpec + 4;
+    const int sCompY = 4;
+    const int sCompT = 1;
+
+    Real Patm = Patm_DEF; pp.query("Patm",Patm);
+    int  nrep = 1;        pp.query("nrep",nrep);
+
+    std::string mechanism = "unknown"; pp.query("mechanism",mechanism);
+    std::string json_file = "";        pp.query("json_file",json_file);
+
+    std::vector<std::string> files;
+    if (pp.countval("pmf_files") > 0) {
+      Array<std::string> a; pp.getarr("pmf_files",a);
+      files.assign(a.begin(),a.end());
+    } else {
+      std::string f; pp.get("pmf_file",f);
+      files.push_back(f);
+    }
+
+    std::vector<Real> dts(1,dt_DEF);
+    if (pp.countval("dts") > 0) {
+      Array<Real> a; pp.getarr("dts",a);
+      dts.assign(a.begin(),a.end());
+    }
+
+    std::vector<int> nthreads(1,1);
+#ifdef _OPENMP
+    nthreads[0] = omp_get_max_threads();
+#endif
+    if (pp.countval("nthreads") > 0) {
+      Array<int> a; pp.getarr("nthreads",a);
+      nthreads.assign(a.begin(),a.end());
+    }
+#if !defined(_OPENMP) || BL_SPACEDIM != 3
+    //
+    // Only the 3D FORT_CONPSOLV is threaded; elsewhere a thread sweep
+    // would time the same serial solve over and over.
+    //
+    if (nthreads.size() > 1 || nthreads[0] != 1) {
+      std::cout << "vodeDriver: solveTransient is threaded in 3D OpenMP builds only, nthreads ignored\n";
+      nthreads.assign(1,1);
+    }
+#endif
+
+    std::vector<std::string> solvers;
+    if (pp.countval("solvers") > 0) {
+      Array<std::string> a; pp.getarr("solvers",a);
+      solvers.assign(a.begin(),a.end());
+    } else {
+      solvers.push_back("adams");
+      solvers.push_back("bdf_fd");
+#ifdef DO_AJAC
+      solvers.push_back("bdf_aj");
+#endif
+    }
+
+    std::ostringstream js;
+    js << std::setprecision(8)
+       << "{\n"
+       << "  \"mechanism\": \"" << mechanism << "\",\n"
+       << "  \"nspecies\": " << nSpec << ",\n"
+       << "  \"nreactions\": " << cd.numReactions() << ",\n"
+       << "  \"dim\": " << BL_SPACEDIM << ",\n"
+       << "  \"Patm\": " << Patm << ",\n"
+       << "  \"nrep\": " << nrep << ",\n"
+       << "  \"runs\": [";
+
+    std::cout << std::setw(24) << "file"    << std::setw(8)  << "cells"
+              << std::setw(10) << "dt"      << std::setw(4)  << "nt"
+              << std::setw(8)  << "solver"  << std::setw(12) << "cells/s"
+              << std::setw(12) << "RHS"     << std::setw(9)  << "Jac"
+              << std::setw(9)  << "LU"      << std::setw(8)  << "p50"
+              << std::setw(8)  << "p90"     << std::setw(8)  << "p99"
+              << std::setw(8)  << "max"     << '\n';
+
+    bool first = true;
+
+    for (int f = 0; f < files.size(); f++)
+    {
+      std::ifstream is(files[f].c_str());
+      FArrayBox ostate;
+      ostate.readFrom(is);
+      is.close();
+
+      if (ostate.nComp() != nComp) {
+        std::cout << files[f] << " is not compatible with the mechanism compiled into this code, skipped\n";
+        continue;
+      }
+
+      const Box& box    = ostate.box();
+      const long ncells = box.numPts();
+
+      FArrayBox nstate(box,nComp), funcCnt(box,1);
+
+      for (int d = 0; d < dts.size(); d++)
+      for (int t = 0; t < nthreads.size(); t++)
+      for (int s = 0; s < solvers.size(); s++)
+      {
+        const std::string& solver = solvers[s];
+
+        if (solver != "adams" && solver != "bdf_fd" && solver != "bdf_aj")
+          BoxLib::Abort("vodeDriver: unknown solver " + solver);
+
+        const bool stiff = (solver != "adams");
+        cd.set_vode_ajac(solver == "bdf_aj");
+#ifdef _OPENMP
+        omp_set_num_threads(nthreads[t]);
+#endif
+        Real best = -1, nfe = 0, nje = 0, nlu = 0, fe, je, lu;
+        bool ok   = true;
+
+        cd.getVodeStats(fe,je,lu);
+
+        for (int r = 0; r < nrep; r++)
+        {
+          nstate.copy(ostate);
+          funcCnt.setVal(0);
+
+          double strt_time = ParallelDescriptor::second();
+          ok = cd.solveTransient(nstate,nstate,ostate,ostate,funcCnt,
+                                 box,sCompY,sCompT,dts[d],Patm,0,stiff) && ok;
+          double run_time = ParallelDescriptor::second() - strt_time;
+
+          if (best < 0 || run_time < best) best = run_time;
+
+          cd.getVodeStats(fe,je,lu);
+          nfe += fe/nrep; nje += je/nrep; nlu += lu/nrep;
+        }
+
+        std::vector<Real> cost(funcCnt.dataPtr(),funcCnt.dataPtr()+ncells);
+        std::sort(cost.begin(),cost.end());
+        Real mean = 0;
+        for (int i = 0; i < cost.size(); i++) mean += cost[i]/ncells;
+
+        const Real rate = ncells/std::max(best,1.e-30);
+
+        std::cout << std::setw(24) << files[f]   << std::setw(8)  << ncells
+                  << std::setw(10) << dts[d]     << std::setw(4)  << nthreads[t]
+                  << std::setw(8)  << solver     << std::setw(12) << rate
+                  << std::setw(12) << nfe        << std::setw(9)  << nje
+                  << std::setw(9)  << nlu        << std::setw(8)  << percentile(cost,0.5)
+                  << std::setw(8)  << percentile(cost,0.9)
+                  << std::setw(8)  << percentile(cost,0.99)
+                  << std::setw(8)  << cost.back() << (ok ? "" : "  FAILED") << '\n';
+
+        js << (first ? "\n" : ",\n")
+           << "    {\"file\": \"" << files[f] << "\", \"ncells\": " << ncells
+           << ", \"dt\": " << dts[d] << ", \"nthreads\": " << nthreads[t]
+           << ", \"solver\": \"" << solver << "\", \"ok\": " << (ok ? "true" : "false")
+           << ",\n     \"time\": " << best << ", \"cells_per_s\": " << rate
+           << ", \"nfe\": " << nfe << ", \"nje\": " << nje << ", \"nlu\": " << nlu
+           << ",\n     \"cost\": {\"mean\": " << mean
+           << ", \"p50\": " << percentile(cost,0.5)
+           << ", \"p90\": " << percentile(cost,0.9)
+           << ", \"p99\": " << percentile(cost,0.99)
+           << ", \"max\": " << cost.back() << "}}";
+        first = false;
+      }
+    }
+
+    js << "\n  ]\n}\n";
+
+    cd.set_vode_ajac(false);
+
+    if (json_file != "") {
+      std::ofstream os(json_file.c_str());
+      os << js.str();
+      if (!os.good())
+        BoxLib::FileOpenFailed(json_file);
+    }
+}
+
 int
 main (int   argc,
       char* argv[])
@@ -40,6 +578,22 @@ main (int   argc,
     if (verbose)
         cd.set_verbose_vode();
 
+    std::string corpus=""; pp.query("corpus",corpus);
+    if (corpus != "") {
+      int  stiff   = stiff_DEF;   pp.query("stiff",stiff);
+      Real ref_fac = ref_fac_DEF; pp.query("ref_fac",ref_fac);
+      replay_corpus(cd,corpus,stiff,ref_fac);
+      BoxLib::Finalize();
+      return 0;
+    }
+
+    bool bench=false; pp.query("bench",bench);
+    if (bench) {
+      run_benchmark(cd,pp);
+      BoxLib::Finalize();
+      return 0;
+    }
+
     // Read fab containing pmf solution
     std::string pmf_file=""; pp.get("pmf_file",pmf_file);
     std::ifstream is;
@@ -94,6 +648,29 @@ main (int   argc,
     std::cout << " ... total function evals: " << funcCnt.norm(1) << '\n';
     std::cout << " ... max evals at a point: " << funcCnt.norm(0) << '\n';
 
+#ifndef LMC_SDC
+    //
+    // Rates of progress taken without sub-steps, as for the reaction path
+    // fluxes of LMC, must leave the solution exactly as it was.
+    //
+    bool check_diag=true; pp.query("check_diag",check_diag);
+    if (check_diag) {
+      FArrayBox dstate(box,nComp), dfuncCnt(box,1), diag(box,cd.numReactions());
+      dstate.copy(ostate,box,sCompT,box,sCompT,1);
+      diag.setVal(0);
+      cd.solveTransient(dstate,dstate,ostate,ostate,dfuncCnt,
+                        box,sCompY,sCompT,dt,Patm,&diag,true,false);
+      dstate.minus(nstate,box,sCompY,sCompY,nSpec);
+      dstate.minus(nstate,box,sCompT,sCompT,1);
+      dfuncCnt.minus(funcCnt);
+      const bool same = dstate.norm(0,sCompY,nSpec) == 0 && dstate.norm(0,sCompT,1) == 0
+                     && dfuncCnt.norm(0) == 0;
+      std::cout << " ... same solution with rates of progress: " << (same ? "yes" : "NO") << '\n';
+      if (!same)
+        BoxLib::Abort("solveTransient: rates of progress changed the solution");
+    }
+#endif
+
     std::string fabfile_out=""; pp.query("fabfile_out",fabfile_out);
     if (fabfile_out != "") {
       std::ofstream os;
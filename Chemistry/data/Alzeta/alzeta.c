@@ -87,6 +87,7 @@
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_TOL GET_T_TOL
 #define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
@@ -172,6 +173,7 @@
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_TOL get_t_tol
 #define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
@@ -257,6 +259,7 @@
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_TOL get_t_tol_
 #define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
@@ -359,6 +362,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_TOL(double * restrict tol, int * maxiter);
 void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
@@ -80000,21 +80004,29 @@ void atomicWeight(double * restrict awt)
 
     return;
 }
-/* get temperature given internal energy in mass units and mass fracs */
-void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+/* tolerance and iteration limit of the Newton solves for T */
+void GET_T_TOL(double * restrict tol, int * maxiter)
 {
 #ifdef CONVERGENCE
-    const int maxiter = 5000;
-    const double tol  = 1.e-12;
+    *maxiter = 5000;
+    *tol = 1.e-12;
 #else
-    const int maxiter = 200;
-    const double tol  = 1.e-6;
+    *maxiter = 200;
+    *tol = 1.e-6;
 #endif
+}
+
+/* get temperature given internal energy in mass units and mass fracs */
+void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+    int maxiter;
+    double tol;
     double ein  = *e;
     double tmin = 250;/*max lower bound for thermo def */
     double tmax = 4000;/*min upper bound for thermo def */
     double e1,emin,emax,cv,t1,dt;
     int i;/* loop counter */
+    GET_T_TOL(&tol, &maxiter);
     CKUBMS(&tmin, y, iwrk, rwrk, &emin);
     CKUBMS(&tmax, y, iwrk, rwrk, &emax);
     if (ein < emin) {
@@ -80052,18 +80064,14 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
 /* get temperature given enthalpy in mass units and mass fracs */
 void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
 {
-#ifdef CONVERGENCE
-    const int maxiter = 5000;
-    const double tol  = 1.e-12;
-#else
-    const int maxiter = 200;
-    const double tol  = 1.e-6;
-#endif
+    int maxiter;
+    double tol;
     double hin  = *h;
     double tmin = 250;/*max lower bound for thermo def */
     double tmax = 4000;/*min upper bound for thermo def */
     double h1,hmin,hmax,cp,t1,dt;
     int i;/* loop counter */
+    GET_T_TOL(&tol, &maxiter);
     CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
     CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
     if (hin < hmin) {
@@ -328,12 +328,37 @@ ChemDriver::initOnce ()
 
     FORT_SETVODETOLS(&v_rtol,&v_atol,&v_itol);
 
+    bool v_ajac = false;
+    pp.query("vode_ajac",v_ajac);
+    set_vode_ajac(v_ajac);
+
     int  v_maxcyc = -1;
 
     pp.query("vode_max_subcycles",v_maxcyc);
     if (v_maxcyc > 0) {
       set_max_vode_subcycles(v_maxcyc);
     }
+    //
+    // Capture the inputs of the most expensive and the failed integrations
+    // of solveTransient, for replay with vodeDriver.  One file per rank.
+    //
+    ParmParse ppc("chem");
+
+    std::string capture_file;
+    int         capture_ntop = 8;
+
+    ppc.query("capture_file",capture_file);
+    ppc.query("capture_ntop",capture_ntop);
+
+    if (!capture_file.empty())
+    {
+        std::ostringstream fname;
+        fname << capture_file << '.' << ParallelDescriptor::MyProc();
+
+        Array<int> file = encodeStringForFortran(fname.str());
+        int len         = file.size();
+        FORT_CHEMCAPTURE(file.dataPtr(),&len,&capture_ntop);
+    }
 
     reaction_map.resize(numReactions());
     FORT_GET_REACTION_MAP(reaction_map.dataPtr());
@@ -356,6 +381,29 @@ ChemDriver::set_max_vode_subcycles(int maxcyc)
     FORT_SETVODESUBCYC(&maxcyc);
 }
 
+void
+ChemDriver::set_vode_tols(Real rtol, Real atol, int itol)
+{
+    FORT_SETVODETOLS(&rtol,&atol,&itol);
+}
+
+void
+ChemDriver::set_vode_ajac(bool ajac)
+{
+#ifndef DO_AJAC
+    if (ajac)
+        BoxLib::Abort("ChemDriver::set_vode_ajac: build with DO_AJAC for the analytic Jacobian");
+#endif
+    int v_ajac = ajac;
+    FORT_SETVODEAJAC(&v_ajac);
+}
+
+void
+ChemDriver::getVodeStats(Real& nfe, Real& nje, Real& nlu)
+{
+    FORT_GETVODESTATS(&nfe,&nje,&nlu);
+}
+
 void
 ChemDriver::set_species_Yscales(const std::string& scalesFile)
 {
@@ -952,7 +1000,8 @@ ChemDriver::solveTransient(FArrayBox&        Ynew,
                            Real              dt,
                            Real              Patm,
                            FArrayBox*        chemDiag,
-                           bool              use_stiff_solver) const
+                           bool              use_stiff_solver,
+                           bool              chemDiag_substeps) const
 {
     BL_ASSERT(sCompY+numSpecies() <= Ynew.nComp());
     BL_ASSERT(sCompY+numSpecies() <= Yold.nComp());
@@ -962,7 +1011,7 @@ ChemDriver::solveTransient(FArrayBox&        Ynew,
     BL_ASSERT(Ynew.box().contains(box) && Yold.box().contains(box));
     BL_ASSERT(Tnew.box().contains(box) && Told.box().contains(box));
 
-    const int do_diag  = (chemDiag!=0);
+    const int do_diag  = (chemDiag==0 ? 0 : chemDiag_substeps ? 1 : 2);
     Real*     diagData = do_diag ? chemDiag->dataPtr() : 0;
     const int do_stiff = (use_stiff_solver);
     int success = FORT_CONPSOLV(box.loVect(), box.hiVect(),
@@ -1,6 +1,7 @@
 # For F90 BoxLib based codes
 
 fsources += vode.f LinAlg.f math_d.f tranlib_d.f
+f90sources += tinv_module.f90 chem_capture_module.f90 transport_tab_module.f90
 
 ifdef USE_EGZ
   f90sources += egz_module.f90
@@ -0,0 +1,183 @@
+module chem_capture_module
+
+  ! Capture of chemistry integrator inputs, for replaying production states
+  ! offline (see Chemistry/bin/vodeDriver).
+  !
+  ! When capture is on, the burners hand every cell they integrate to
+  ! chem_capture_cell, with its input state, its cost (right-hand side
+  ! evaluations) and the integrator's return status.  Of the cells offered
+  ! between two calls to chem_capture_flush (a box, usually) the ntop most
+  ! expensive are kept and then appended to the corpus.  Failed integrations
+  ! are written right away, since the caller may abort.
+  !
+  ! The corpus is a stream of native-endian binary data:
+  !
+  !   header:  'CHEMCAP1', nspec (default integer)
+  !   record:  kind, status, dt, cost, T, p_or_rho, Y(1:nspec) (doubles)
+  !
+  ! kind is cap_conp for a constant-pressure reactor (p_or_rho is the
+  ! pressure in dyne/cm^2) and cap_conv for a constant-volume one (the
+  ! density in g/cm^3).  Nonzero status is the integrator's failure code.
+
+  implicit none
+
+  integer, parameter :: cap_conp = 1, cap_conv = 2
+
+  character(len=8), parameter :: cap_magic = 'CHEMCAP1'
+
+  logical, save :: capture_on = .false.
+
+  integer, save, private :: nspec = 0, ntop = 0, nkept = 0, lun = -1
+  double precision, allocatable, save, private :: buf(:,:)
+
+  private
+
+  public :: capture_on, cap_conp, cap_conv, cap_magic
+  public :: chem_capture_init, chem_capture_cell, chem_capture_flush, chem_capture_close
+  public :: chem_capture_load
+
+contains
+
+  subroutine chem_capture_init(fname, nspec_in, ntop_in)
+    character(len=*), intent(in) :: fname
+    integer, intent(in) :: nspec_in, ntop_in
+
+    if (capture_on) call chem_capture_close()
+
+    nspec = nspec_in
+    ntop  = max(ntop_in, 0)
+    nkept = 0
+
+    allocate(buf(nspec+6,max(ntop,1)))
+
+    open(newunit=lun, file=trim(fname), access='stream', form='unformatted', &
+         status='replace', action='write')
+    write(lun) cap_magic, nspec
+
+    capture_on = .true.
+
+  end subroutine chem_capture_init
+
+
+  subroutine chem_capture_cell(kind, status, dt, cost, T, p_or_rho, Y)
+    integer, intent(in) :: kind, status
+    double precision, intent(in) :: dt, cost, T, p_or_rho, Y(nspec)
+
+    integer :: m
+    double precision :: rec(nspec+6)
+
+    if (.not. capture_on) return
+
+    rec(1) = kind
+    rec(2) = status
+    rec(3) = dt
+    rec(4) = cost
+    rec(5) = T
+    rec(6) = p_or_rho
+    rec(7:) = Y
+
+    !$omp critical (chem_capture)
+    if (status .ne. 0) then
+       write(lun) rec
+       flush(lun)
+    else if (nkept .lt. ntop) then
+       nkept = nkept + 1
+       buf(:,nkept) = rec
+    else if (ntop .gt. 0) then
+       m = minloc(buf(4,1:ntop),1)
+       if (cost .gt. buf(4,m)) buf(:,m) = rec
+    end if
+    !$omp end critical (chem_capture)
+
+  end subroutine chem_capture_cell
+
+
+  subroutine chem_capture_flush()
+
+    if (.not. capture_on) return
+
+    !$omp critical (chem_capture)
+    if (nkept .gt. 0) then
+       write(lun) buf(:,1:nkept)
+       flush(lun)
+       nkept = 0
+    end if
+    !$omp end critical (chem_capture)
+
+  end subroutine chem_capture_flush
+
+
+  subroutine chem_capture_close()
+
+    if (.not. capture_on) return
+
+    call chem_capture_flush()
+    close(lun)
+    deallocate(buf)
+    capture_on = .false.
+
+  end subroutine chem_capture_close
+
+
+  ! Read a whole corpus.  rec(:,r) is record r as laid out above; ierr is
+  ! nonzero if the file cannot be read or is not a corpus.
+  subroutine chem_capture_load(fname, nspec_out, nrec, rec, ierr)
+    character(len=*), intent(in) :: fname
+    integer, intent(out) :: nspec_out, nrec, ierr
+    double precision, allocatable, intent(out) :: rec(:,:)
+
+    integer :: u, fsize, hsize
+    character(len=8) :: magic
+
+    nspec_out = 0
+    nrec = 0
+
+    open(newunit=u, file=trim(fname), access='stream', form='unformatted', &
+         status='old', action='read', iostat=ierr)
+    if (ierr .ne. 0) return
+
+    read(u, iostat=ierr) magic, nspec_out
+    if (ierr .eq. 0 .and. magic .ne. cap_magic) ierr = 1
+
+    if (ierr .eq. 0) then
+       inquire(unit=u, size=fsize)
+       inquire(unit=u, pos=hsize)
+       nrec = (fsize - hsize + 1) / (8*(nspec_out+6))
+       allocate(rec(nspec_out+6,nrec))
+       if (nrec .gt. 0) read(u, iostat=ierr) rec
+    end if
+
+    close(u)
+
+  end subroutine chem_capture_load
+
+end module chem_capture_module
+
+
+! Entry points for the fixed-form ChemDriver routines and for C++.
+
+! name is the corpus file name coded as integers (encodeStringForFortran).
+subroutine chem_capture_setup(name, nlength, nspec, ntop)
+  use chem_capture_module, only : chem_capture_init
+  integer, intent(in) :: nlength, name(nlength), nspec, ntop
+  character(len=nlength) :: fname
+  integer :: i
+  do i = 1, nlength
+     fname(i:i) = char(name(i))
+  end do
+  call chem_capture_init(fname, nspec, ntop)
+end subroutine chem_capture_setup
+
+
+subroutine chem_capture_record(kind, status, dt, cost, T, p_or_rho, Y)
+  use chem_capture_module, only : capture_on, chem_capture_cell
+  integer, intent(in) :: kind, status
+  double precision, intent(in) :: dt, cost, T, p_or_rho, Y(*)
+  if (capture_on) call chem_capture_cell(kind, status, dt, cost, T, p_or_rho, Y)
+end subroutine chem_capture_record
+
+
+subroutine chem_capture_box_done()
+  use chem_capture_module, only : chem_capture_flush
+  call chem_capture_flush()
+end subroutine chem_capture_box_done
@@ -1,7 +1,11 @@
-module feval
+! Right-hand side and analytic Jacobian of a constant-volume, adiabatic
+! reactor for bdf_advance.  The state of each point is (Y, T); its density
+! is taken from rho, which the caller fills before advancing a batch.
+module cv_feval
   use bdf
   implicit none
-  double precision, save :: rho(8)
+  integer, parameter :: max_npt = 8   ! largest batch
+  double precision, save :: rho(max_npt)
   !$omp threadprivate(rho)
 contains
 
@@ -91,4 +95,4 @@ contains
     
   end subroutine f_jac
 
-end module feval
+end module cv_feval
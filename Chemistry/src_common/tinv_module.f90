@@ -0,0 +1,394 @@
+module tinv_module
+
+  ! Batched temperature inversion: T from (h,Y) or (e,Y) for a row of cells.
+  !
+  ! At init the thermodynamic fits of the mechanism are recovered from the
+  ! CK routines.  For every species h is a quintic in T on either side of
+  ! its midpoint temperature, and cp its derivative.  For a cell, the species
+  ! polynomials are summed with weights Y into one polynomial per distinct
+  ! midpoint and range.  A Newton step then gets h and cp together from one
+  ! Horner pass over a handful of coefficients instead of two passes over all
+  ! the species.  Cells are held in SoA form, a row at a time, and converged
+  ! cells are masked out.
+  !
+  ! The recovered polynomials are checked against the CK routines on
+  ! [tinv_tlo,tinv_thi].  If they do not reproduce them (a mechanism with
+  ! other fits), tinv_ok is .false. and every cell is handed back.  Cells the
+  ! engine does not solve come back with niter < 0, for the caller to redo
+  ! with its pointwise solver.
+
+  implicit none
+
+  double precision, parameter :: tinv_tlo = 250.d0, tinv_thi = 4000.d0
+
+  logical, save :: tinv_ok = .false.
+
+  ! Newton step tolerance and iteration limit of the mechanism's
+  ! get_T_given_eY, for callers that hand unsolved cells to it.  tinv_init
+  ! takes them from the mechanism's get_T_tol.
+  double precision, save :: tinv_ttol_eY = 1.d-6
+  integer, save :: tinv_itmax_eY = 200
+
+  ! the fits are checked to this relative accuracy in h, and more loosely in
+  ! cp, which only enters the Newton steps
+  double precision, parameter, private :: fit_tol = 1.d-10, cp_tol = 1.d-6
+  ! largest Newton step, as in the CK solvers
+  double precision, parameter, private :: dTmax = 100.d0
+
+  integer, save, private :: nspec = 0, ngrp = 0
+  ! midpoint temperature group of each species, and the group midpoints
+  integer, allocatable, save, private :: grp(:)
+  double precision, allocatable, save, private :: tmid(:)
+  ! h = sum_m hc(m,r,k) T**m, for r = 1 below and r = 2 above the midpoint
+  double precision, allocatable, save, private :: hc(:,:,:)
+  ! R/W
+  double precision, allocatable, save, private :: rw(:)
+
+  private
+
+  public :: tinv_ok, tinv_tlo, tinv_thi, tinv_init, tinv_T_given_hY, tinv_T_given_eY
+  public :: tinv_ttol_eY, tinv_itmax_eY
+
+contains
+
+  subroutine tinv_init()
+
+    integer :: k, g, n, nT, r, iwrk, nelt, nreac, nfit
+    double precision :: rwrk, ru, ruc, pa, T
+    double precision, allocatable :: wt(:), cp(:), h(:), tk(:)
+    logical :: ok
+
+    if (allocated(hc)) return
+
+    call get_t_tol(tinv_ttol_eY, tinv_itmax_eY)
+
+    call ckindx(iwrk, rwrk, nelt, nspec, nreac, nfit)
+
+    allocate(grp(nspec), tmid(nspec), hc(0:5,2,nspec), rw(nspec))
+    allocate(wt(nspec), cp(nspec), h(nspec), tk(nspec))
+
+    call ckwt(iwrk, rwrk, wt)
+    call ckrp(iwrk, rwrk, ru, ruc, pa)
+    rw = ru / wt
+
+    do k = 1, nspec
+       tk(k) = find_tmid(k)
+       if (tk(k) .lt. tinv_thi) then
+          call fit_range(k, tinv_tlo, tk(k), hc(:,1,k))
+          call fit_range(k, tk(k), tinv_thi, hc(:,2,k))
+       else
+          call fit_range(k, tinv_tlo, tinv_thi, hc(:,1,k))
+          hc(:,2,k) = hc(:,1,k)
+       end if
+    end do
+
+    ngrp = 0
+    do k = 1, nspec
+       grp(k) = 0
+       do g = 1, ngrp
+          if (tmid(g) .eq. tk(k)) grp(k) = g
+       end do
+       if (grp(k) .eq. 0) then
+          ngrp = ngrp + 1
+          tmid(ngrp) = tk(k)
+          grp(k) = ngrp
+       end if
+    end do
+
+    ok = .true.
+
+    nT = nint((tinv_thi-tinv_tlo)/25.d0)
+
+    do n = 0, nT + 2*ngrp
+       if (n .le. nT) then
+          T = tinv_tlo + 25.d0*n
+       else
+          ! either side of each midpoint
+          g = (n-nT+1)/2
+          if (tmid(g) .ge. tinv_thi) cycle
+          T = tmid(g) * merge(1.d0-1.d-9, 1.d0+1.d-9, mod(n-nT,2).eq.1)
+       end if
+       call ckcpms(T, iwrk, rwrk, cp)
+       call ckhms (T, iwrk, rwrk, h)
+       do k = 1, nspec
+          r = merge(1, 2, T .lt. tk(k))
+          ok = ok .and. abs(cp_fit(hc(:,r,k),T)-cp(k)) .le. cp_tol*abs(cp(k)) &
+               &  .and. abs(h_fit(hc(:,r,k),T)-h(k)) .le. fit_tol*(abs(h(k))+cp(k)*T)
+       end do
+    end do
+
+    tinv_ok = ok
+
+    deallocate(wt, cp, h, tk)
+
+  end subroutine tinv_init
+
+
+  ! T from h and Y, cgs units.  Y(i,:) is the composition of cell i.  On
+  ! entry T is the initial guess, which is replaced by a secant guess from
+  ! h(tinv_tlo) and h(tinv_thi) if it is out of range or guess is .true.
+  ! A cell is converged when the relative residual is at most rtol or the
+  ! Newton step is at most ttol.  niter is the number of Newton steps, or -1
+  ! for cells not solved (h out of range or itmax reached).
+  subroutine tinv_T_given_hY(np, h, Y, T, rtol, ttol, itmax, guess, niter)
+    integer, intent(in) :: np, itmax
+    double precision, intent(in) :: h(np), Y(:,:), rtol, ttol
+    double precision, intent(inout) :: T(np)
+    logical, intent(in) :: guess
+    integer, intent(out) :: niter(np)
+    call tinv_solve(np, h, Y, T, rtol, ttol, itmax, guess, .false., niter)
+  end subroutine tinv_T_given_hY
+
+
+  ! As tinv_T_given_hY, from the internal energy e.
+  subroutine tinv_T_given_eY(np, e, Y, T, rtol, ttol, itmax, guess, niter)
+    integer, intent(in) :: np, itmax
+    double precision, intent(in) :: e(np), Y(:,:), rtol, ttol
+    double precision, intent(inout) :: T(np)
+    logical, intent(in) :: guess
+    integer, intent(out) :: niter(np)
+    call tinv_solve(np, e, Y, T, rtol, ttol, itmax, guess, .true., niter)
+  end subroutine tinv_T_given_eY
+
+
+  subroutine tinv_solve(np, ht, Y, T, rtol, ttol, itmax, guess, use_e, niter)
+    integer, intent(in) :: np, itmax
+    double precision, intent(in) :: ht(np), Y(:,:), rtol, ttol
+    double precision, intent(inout) :: T(np)
+    logical, intent(in) :: guess, use_e
+    integer, intent(out) :: niter(np)
+
+    integer :: i, k, g, m, it
+    double precision :: c, dT, dH
+    double precision :: hm(np), cpm(np), Tb(np), hlo(np), hhi(np)
+    logical :: done(np)
+    double precision, allocatable :: cl(:,:,:), ch(:,:,:)
+
+    if (.not. tinv_ok) then
+       niter = -1
+       return
+    end if
+
+    !
+    ! mixture polynomials, one per midpoint group and range
+    !
+    allocate(cl(np,0:5,ngrp), ch(np,0:5,ngrp))
+    cl = 0.d0
+    ch = 0.d0
+    do k = 1, nspec
+       g = grp(k)
+       do m = 0, 5
+          c = hc(m,1,k)
+          if (use_e .and. m.eq.1) c = c - rw(k)
+          do i = 1, np
+             cl(i,m,g) = cl(i,m,g) + Y(i,k)*c
+          end do
+          c = hc(m,2,k)
+          if (use_e .and. m.eq.1) c = c - rw(k)
+          do i = 1, np
+             ch(i,m,g) = ch(i,m,g) + Y(i,k)*c
+          end do
+       end do
+    end do
+
+    Tb = tinv_tlo
+    call mix_eval(np, Tb, cl, ch, hlo, cpm)
+    Tb = tinv_thi
+    call mix_eval(np, Tb, cl, ch, hhi, cpm)
+
+    do i = 1, np
+       done(i) = ht(i).lt.hlo(i) .or. ht(i).gt.hhi(i)
+       niter(i) = -1
+       if (guess .or. T(i).lt.tinv_tlo .or. T(i).gt.tinv_thi) then
+          T(i) = tinv_tlo + (tinv_thi-tinv_tlo)/(hhi(i)-hlo(i))*(ht(i)-hlo(i))
+       end if
+    end do
+
+    do it = 0, itmax-1
+
+       call mix_eval(np, T, cl, ch, hm, cpm)
+
+       do i = 1, np
+          if (.not. done(i)) then
+             dH = 2.d0*abs(hm(i)-ht(i))/(1.d0+abs(hm(i))+abs(ht(i)))
+             dT = max(-dTmax, min(dTmax, (ht(i)-hm(i))/cpm(i)))
+             if (dH .le. rtol) then
+                done(i) = .true.
+                niter(i) = it
+             else
+                T(i) = max(tinv_tlo, min(tinv_thi, T(i)+dT))
+                if (abs(dT) .le. ttol) then
+                   done(i) = .true.
+                   niter(i) = it+1
+                end if
+             end if
+          end if
+       end do
+
+       if (all(done)) exit
+
+    end do
+
+    deallocate(cl, ch)
+
+  end subroutine tinv_solve
+
+
+  ! h and cp of the mixtures at T, from the same powers of T.
+  subroutine mix_eval(np, T, cl, ch, hm, cpm)
+    integer, intent(in) :: np
+    double precision, intent(in) :: T(np), cl(np,0:5,ngrp), ch(np,0:5,ngrp)
+    double precision, intent(out) :: hm(np), cpm(np)
+
+    integer :: i, g
+    double precision :: t1, c0, c1, c2, c3, c4, c5
+    logical :: lo
+
+    hm = 0.d0
+    cpm = 0.d0
+    do g = 1, ngrp
+       do i = 1, np
+          t1 = T(i)
+          lo = t1 .lt. tmid(g)
+          c0 = merge(cl(i,0,g), ch(i,0,g), lo)
+          c1 = merge(cl(i,1,g), ch(i,1,g), lo)
+          c2 = merge(cl(i,2,g), ch(i,2,g), lo)
+          c3 = merge(cl(i,3,g), ch(i,3,g), lo)
+          c4 = merge(cl(i,4,g), ch(i,4,g), lo)
+          c5 = merge(cl(i,5,g), ch(i,5,g), lo)
+          hm(i)  = hm(i)  + c0 + t1*(c1 + t1*(c2 + t1*(c3 + t1*(c4 + t1*c5))))
+          cpm(i) = cpm(i) + c1 + t1*(2.d0*c2 + t1*(3.d0*c3 + t1*(4.d0*c4 + t1*5.d0*c5)))
+       end do
+    end do
+
+  end subroutine mix_eval
+
+
+  ! Midpoint temperature of species k: where a quintic fitted to h at low
+  ! temperature stops reproducing it.  Species with a single range, at least
+  ! up to tinv_thi, get huge().
+  function find_tmid(k) result(tm)
+    integer, intent(in) :: k
+    double precision :: tm
+
+    integer :: n
+    double precision :: c(0:5), a, b
+
+    call fit_range(k, 300.d0, 800.d0, c)
+
+    if (h_match(k, c, tinv_thi)) then
+       tm = huge(1.d0)
+       return
+    end if
+
+    a = 800.d0
+    b = tinv_thi
+    do n = 1, 60
+       tm = 0.5d0*(a+b)
+       if (h_match(k, c, tm)) then
+          a = tm
+       else
+          b = tm
+       end if
+    end do
+
+    ! midpoints are given to the mK
+    tm = anint(b*1.d3)*1.d-3
+
+  end function find_tmid
+
+
+  logical function h_match(k, c, T)
+    integer, intent(in) :: k
+    double precision, intent(in) :: c(0:5), T
+    integer :: iwrk
+    double precision :: rwrk, h(nspec), cp(nspec)
+    call ckhms (T, iwrk, rwrk, h)
+    call ckcpms(T, iwrk, rwrk, cp)
+    h_match = abs(h_fit(c,T)-h(k)) .le. 0.1d0*fit_tol*(abs(h(k))+cp(k)*T)
+  end function h_match
+
+
+  ! h polynomial of species k on [a,b): the quintic through h at six
+  ! Chebyshev points.
+  subroutine fit_range(k, a, b, c)
+    integer, intent(in) :: k
+    double precision, intent(in) :: a, b
+    double precision, intent(out) :: c(0:5)
+
+    integer :: i, m, iwrk
+    double precision :: rwrk, T, s, V(6,6), h(nspec)
+    double precision, parameter :: Tscale = 1.d3, pi = 3.141592653589793d0
+
+    do i = 1, 6
+       T = 0.5d0*(a+b) - 0.5d0*(b-a)*cos((2*i-1)*pi/12.d0)
+       s = T/Tscale
+       call ckhms(T, iwrk, rwrk, h)
+       c(i-1) = h(k)
+       do m = 1, 6
+          V(i,m) = s**(m-1)
+       end do
+    end do
+
+    call solve6(V, c)
+
+    do m = 1, 5
+       c(m) = c(m) / Tscale**m
+    end do
+
+  end subroutine fit_range
+
+
+  ! Gaussian elimination with partial pivoting; x overwrites f.
+  subroutine solve6(V, f)
+    double precision, intent(inout) :: V(6,6), f(6)
+    integer :: i, j, p
+    double precision :: r, row(6)
+    do i = 1, 6
+       p = i - 1 + maxloc(abs(V(i:6,i)),1)
+       if (p .ne. i) then
+          row = V(i,:);  V(i,:) = V(p,:);  V(p,:) = row
+          r = f(i);  f(i) = f(p);  f(p) = r
+       end if
+       do j = i+1, 6
+          r = V(j,i)/V(i,i)
+          V(j,i:6) = V(j,i:6) - r*V(i,i:6)
+          f(j) = f(j) - r*f(i)
+       end do
+    end do
+    do i = 6, 1, -1
+       f(i) = (f(i) - dot_product(V(i,i+1:6),f(i+1:6))) / V(i,i)
+    end do
+  end subroutine solve6
+
+
+  pure double precision function h_fit(c, T)
+    double precision, intent(in) :: c(0:5), T
+    h_fit = c(0) + T*(c(1) + T*(c(2) + T*(c(3) + T*(c(4) + T*c(5)))))
+  end function h_fit
+
+
+  pure double precision function cp_fit(c, T)
+    double precision, intent(in) :: c(0:5), T
+    cp_fit = c(1) + T*(2.d0*c(2) + T*(3.d0*c(3) + T*(4.d0*c(4) + T*5.d0*c(5))))
+  end function cp_fit
+
+end module tinv_module
+
+
+! Entry points for the fixed-form ChemDriver routines.
+
+subroutine tinv_setup()
+  use tinv_module, only : tinv_init
+  call tinv_init()
+end subroutine tinv_setup
+
+
+subroutine tinv_hy_row(np, nspec, h, Y, T, rtol, ttol, itmax, niter)
+  use tinv_module, only : tinv_T_given_hY
+  integer, intent(in) :: np, nspec, itmax
+  double precision, intent(in) :: h(np), Y(np,nspec), rtol, ttol
+  double precision, intent(inout) :: T(np)
+  integer, intent(out) :: niter(np)
+  call tinv_T_given_hY(np, h, Y, T, rtol, ttol, itmax, .false., niter)
+end subroutine tinv_hy_row
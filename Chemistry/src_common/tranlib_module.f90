@@ -1,5 +1,7 @@
 module tranlib_module
 
+  use transport_tab_module
+
   implicit none
 
   integer, save :: lmcwork, lmciwork
@@ -11,14 +13,33 @@ module tranlib_module
 
 !$omp threadprivate(mcwork,mciwork)
 
+  !
+  ! Tables of the pure-species viscosities and conductivities and of the
+  ! inverse binary diffusion coefficients at 1 atm (see transport_tab_module),
+  ! if tranlib_init was given a tolerance; tab_nt = 0 otherwise.  The inverse
+  ! binary coefficients of the pairs m < n are packed n-major.  Shared by the
+  ! threads, read only.
+  !
+  integer, save :: tab_nt = 0, nspec = 0
+  double precision, save :: tab_xlo, tab_hinv, patm_mc
+  double precision, allocatable, save :: wt_mc(:)
+  double precision, allocatable, save :: vis_tab(:,:), con_tab(:,:), bind_tab(:,:)
+
+  double precision, parameter :: small_mc = 1.0d-20
+
   private
 
   public mcwork, mciwork, lmcwork, lmciwork, tranlib_init, tranlib_close
+  public tranlib_avis, tranlib_acon, tranlib_adif
 
 contains
 
-  subroutine tranlib_init(nspecies)
+  ! With tab_tol > 0, the fits are tabulated on [tab_tmin, tab_tmax] (by
+  ! default 200 K - 4000 K) to that relative accuracy, and tranlib_avis,
+  ! tranlib_acon and tranlib_adif interpolate them.
+  subroutine tranlib_init(nspecies, tab_tol, tab_tmin, tab_tmax)
     integer, intent(in) :: nspecies
+    double precision, intent(in), optional :: tab_tol, tab_tmin, tab_tmax
     integer :: ierr
     integer :: MAXFIT, NO, NFDIM, NT, NRANGE, NLITEMAX
 
@@ -44,12 +65,184 @@ contains
 
     !$omp end parallel
 
+    tab_nt = 0
+    if (present(tab_tol)) then
+       if (tab_tol .gt. 0.d0) then
+          if (present(tab_tmin) .and. present(tab_tmax)) then
+             call tranlib_tab_init(nspecies, tab_tol, tab_tmin, tab_tmax)
+          else
+             call tranlib_tab_init(nspecies, tab_tol, 200.d0, 4000.d0)
+          end if
+       end if
+    end if
+
   end subroutine tranlib_init
 
+
+  subroutine tranlib_tab_init(nspecies, tol, tmin, tmax)
+    integer, intent(in) :: nspecies
+    double precision, intent(in) :: tol, tmin, tmax
+
+    integer :: no, m, n, p, npair
+    double precision :: h
+    double precision, allocatable :: cfe(:,:), cfl(:,:), cfd(:,:,:), cfdp(:,:)
+
+    call egtransetNO(no)
+    call egtransetPATM(patm_mc)
+
+    nspec = nspecies
+    npair = (nspec*(nspec-1))/2
+
+    allocate(wt_mc(nspec))
+    allocate(cfe(no,nspec), cfl(no,nspec), cfd(no,nspec,nspec), cfdp(no,max(npair,1)))
+
+    call egtransetWT(wt_mc)
+    call egtransetCOFETA(cfe)
+    call egtransetCOFLAM(cfl)
+    call egtransetCOFD(cfd)
+
+    p = 0
+    do n=1,nspec
+       do m=1,n-1
+          p = p+1
+          cfdp(:,p) = cfd(:,m,n)
+       end do
+    end do
+
+    tab_nt = max(tab_size(tol, tmin, tmax, no, nspec, cfe, tab_exp), &
+                 tab_size(tol, tmin, tmax, no, nspec, cfl, tab_exp))
+    if (npair .gt. 0) then
+       tab_nt = max(tab_nt, tab_size(tol, tmin, tmax, no, npair, cfdp, tab_expm))
+    end if
+
+    tab_xlo  = log(tmin)
+    h        = (log(tmax) - tab_xlo) / tab_nt
+    tab_hinv = 1.d0 / h
+
+    allocate(vis_tab(0:tab_nt,nspec), con_tab(0:tab_nt,nspec), bind_tab(0:tab_nt,max(npair,1)))
+
+    call tab_fill(tab_nt, tab_xlo, h, no, nspec, cfe, tab_exp, vis_tab)
+    call tab_fill(tab_nt, tab_xlo, h, no, nspec, cfl, tab_exp, con_tab)
+    if (npair .gt. 0) then
+       call tab_fill(tab_nt, tab_xlo, h, no, npair, cfdp, tab_expm, bind_tab)
+    end if
+
+    deallocate(cfe, cfl, cfd, cfdp)
+
+  end subroutine tranlib_tab_init
+
+
   subroutine tranlib_close()
     !$omp parallel
     deallocate(mcwork, mciwork)
     !$omp end parallel
+    if (allocated(wt_mc)) deallocate(wt_mc)
+    if (allocated(vis_tab)) deallocate(vis_tab)
+    if (allocated(con_tab)) deallocate(con_tab)
+    if (allocated(bind_tab)) deallocate(bind_tab)
+    tab_nt = 0
   end subroutine tranlib_close
 
+
+  ! As MCAVIS, MCACON and MCADIF, but from the tables if there are any.
+
+  subroutine tranlib_avis(T, X, vismix)
+    double precision, intent(in) :: T, X(*)
+    double precision, intent(out) :: vismix
+
+    integer :: j, k, jt(1)
+    double precision :: sumi, sumo, w(1), vis(nspec)
+
+    if (tab_nt .eq. 0) then
+       call mcavis(T, X, mcwork, vismix)
+       return
+    end if
+
+    call tab_locate(1, (/ log(T) /), tab_xlo, tab_hinv, tab_nt, jt, w)
+    do k=1,nspec
+       vis(k) = vis_tab(jt(1),k) + w(1)*(vis_tab(jt(1)+1,k) - vis_tab(jt(1),k))
+    end do
+
+    sumo = 0.d0
+    do k=1,nspec
+       sumi = 0.d0
+       do j=1,nspec
+          sumi = sumi + X(j) * &
+               (1.d0 + sqrt(vis(k)/vis(j) * sqrt(wt_mc(j)/wt_mc(k))))**2 / &
+               sqrt(1.d0 + wt_mc(k)/wt_mc(j))
+       end do
+       sumo = sumo + X(k) * vis(k) / sumi
+    end do
+
+    vismix = sumo * sqrt(8.d0)
+
+  end subroutine tranlib_avis
+
+
+  subroutine tranlib_acon(T, X, conmix)
+    double precision, intent(in) :: T, X(*)
+    double precision, intent(out) :: conmix
+
+    integer :: k, jt(1)
+    double precision :: con, sum, sumr, w(1)
+
+    if (tab_nt .eq. 0) then
+       call mcacon(T, X, mcwork, conmix)
+       return
+    end if
+
+    call tab_locate(1, (/ log(T) /), tab_xlo, tab_hinv, tab_nt, jt, w)
+
+    sum  = 0.d0
+    sumr = 0.d0
+    do k=1,nspec
+       con  = con_tab(jt(1),k) + w(1)*(con_tab(jt(1)+1,k) - con_tab(jt(1),k))
+       sum  = sum  + X(k)*con
+       sumr = sumr + X(k)/con
+    end do
+
+    conmix = 0.5d0 * (sum + 1.d0/sumr)
+
+  end subroutine tranlib_acon
+
+
+  subroutine tranlib_adif(P, T, X, D)
+    double precision, intent(in) :: P, T, X(*)
+    double precision, intent(out) :: D(*)
+
+    integer :: j, k, jk, jt(1)
+    double precision :: w(1), wtm, sumxw, bjk, xx(nspec), sumxod(nspec)
+
+    if (tab_nt .eq. 0) then
+       call mcadif(P, T, X, mcwork, D)
+       return
+    end if
+
+    call tab_locate(1, (/ log(T) /), tab_xlo, tab_hinv, tab_nt, jt, w)
+
+    wtm   = 0.d0
+    sumxw = 0.d0
+    do k=1,nspec
+       wtm   = wtm + wt_mc(k)*X(k)
+       xx(k) = max(X(k), small_mc)
+       sumxw = sumxw + xx(k)*wt_mc(k)
+       sumxod(k) = 0.d0
+    end do
+
+    jk = 0
+    do k=1,nspec
+       do j=1,k-1
+          jk = jk+1
+          bjk = bind_tab(jt(1),jk) + w(1)*(bind_tab(jt(1)+1,jk) - bind_tab(jt(1),jk))
+          sumxod(k) = sumxod(k) + xx(j)*bjk
+          sumxod(j) = sumxod(j) + xx(k)*bjk
+       end do
+    end do
+
+    do k=1,nspec
+       D(k) = (sumxw - xx(k)*wt_mc(k)) / (wtm*sumxod(k)) * (patm_mc/P)
+    end do
+
+  end subroutine tranlib_adif
+
 end module tranlib_module
@@ -0,0 +1,122 @@
+module transport_tab_module
+
+  ! Tables of the temperature fits of transport properties.
+  !
+  ! EGLib and TRANLIB fit the pure-species viscosities and conductivities,
+  ! the binary diffusion coefficients and (EGLib) the collision integral
+  ! ratios A* by polynomials in log(T), and evaluate every fit at every
+  ! point: Nspec^2/2 polynomials and exponentials for the binary diffusion
+  ! coefficients alone.  The fits can instead be tabulated once on a grid
+  ! uniform in log(T) and interpolated linearly.
+  !
+  ! A table holds, for each of nf fits, either the fit itself (tab_poly), or
+  ! exp(fit) (tab_exp) or exp(-fit) (tab_expm), so that no exponential is
+  ! left at runtime.  tab_size picks the coarsest grid, doubling from
+  ! tab_nt0 intervals, whose interpolation error at the interval midpoints
+  ! is within tol for every fit: relative for tab_exp and tab_expm, and
+  ! absolute, or relative where the fit exceeds 1, for tab_poly (a log
+  ! property, whose absolute error is the relative error of the property).
+  ! Outside the range of the grid the end intervals are extrapolated.
+
+  implicit none
+
+  integer, parameter :: tab_poly = 0, tab_exp = 1, tab_expm = -1
+
+  integer, parameter, private :: tab_nt0 = 16, tab_ntmax = 2**16
+
+  private
+
+  public :: tab_poly, tab_exp, tab_expm
+  public :: tab_size, tab_fill, tab_locate
+
+contains
+
+  ! The fits cof(:,k) at x = log(T), transformed by form.
+  subroutine tab_eval(no, nf, cof, form, x, val)
+    integer, intent(in) :: no, nf, form
+    double precision, intent(in) :: cof(no,nf), x
+    double precision, intent(out) :: val(nf)
+    integer :: k, m
+    do k=1,nf
+       val(k) = cof(no,k)
+       do m=no-1,1,-1
+          val(k) = val(k)*x + cof(m,k)
+       end do
+    end do
+    if (form .eq. tab_exp) then
+       val = exp(val)
+    else if (form .eq. tab_expm) then
+       val = exp(-val)
+    end if
+  end subroutine tab_eval
+
+
+  ! Number of intervals of the grid on [log(tmin), log(tmax)] that meets
+  ! tol for the fits cof(:,1:nf), or tab_ntmax if none does.
+  integer function tab_size(tol, tmin, tmax, no, nf, cof, form) result(nt)
+    double precision, intent(in) :: tol, tmin, tmax
+    integer, intent(in) :: no, nf, form
+    double precision, intent(in) :: cof(no,nf)
+
+    integer :: j, k
+    double precision :: xlo, h, err, v0(nf), v1(nf), vm(nf)
+
+    xlo = log(tmin)
+
+    nt = tab_nt0
+    do while (nt .lt. tab_ntmax)
+       h = (log(tmax) - xlo) / nt
+       err = 0.d0
+       call tab_eval(no, nf, cof, form, xlo, v0)
+       do j=1,nt
+          call tab_eval(no, nf, cof, form, xlo+j*h, v1)
+          call tab_eval(no, nf, cof, form, xlo+(j-0.5d0)*h, vm)
+          do k=1,nf
+             if (form .eq. tab_poly) then
+                err = max(err, abs(0.5d0*(v0(k)+v1(k)) - vm(k)) / max(1.d0, abs(vm(k))))
+             else
+                err = max(err, abs(0.5d0*(v0(k)+v1(k)) - vm(k)) / vm(k))
+             end if
+          end do
+          v0 = v1
+       end do
+       if (err .le. tol) exit
+       nt = 2*nt
+    end do
+
+  end function tab_size
+
+
+  ! tab(j,k) = fit k at log(T) = xlo + j*h, transformed by form.
+  subroutine tab_fill(nt, xlo, h, no, nf, cof, form, tab)
+    integer, intent(in) :: nt, no, nf, form
+    double precision, intent(in) :: xlo, h, cof(no,nf)
+    double precision, intent(out) :: tab(0:nt,nf)
+    integer :: j
+    double precision :: val(nf)
+    do j=0,nt
+       call tab_eval(no, nf, cof, form, xlo+j*h, val)
+       tab(j,:) = val
+    end do
+  end subroutine tab_fill
+
+
+  ! Interval jt and weight wt of each log(T) on the grid of nt intervals
+  ! from xlo, hinv = 1/h; the value of a table is then
+  ! tab(jt,k) + wt*(tab(jt+1,k) - tab(jt,k)).
+  subroutine tab_locate(np, lgT, xlo, hinv, nt, jt, wt)
+    integer, intent(in) :: np, nt
+    double precision, intent(in) :: lgT(np), xlo, hinv
+    integer, intent(out) :: jt(np)
+    double precision, intent(out) :: wt(np)
+    integer :: i
+    double precision :: s
+    !DEC$ SIMD PRIVATE(s)
+    do i=1,np
+       s = (lgT(i) - xlo) * hinv
+       jt(i) = min(max(int(s), 0), nt-1)
+       wt(i) = s - jt(i)
+    end do
+  end subroutine tab_locate
+
+end module transport_tab_module
@@ -2,6 +2,9 @@
 #include "ChemDriver_F.H"
 
 #include <ParmParse.H>
+#include <ParallelDescriptor.H>
+
+#include <sstream>
 
 namespace
 {
@@ -133,14 +136,42 @@ ChemDriver::initOnce ()
     }
 
 
-    // eglib
+    // capture of the inputs of the most expensive and the failed burns, for
+    // replay offline; one file per rank
+    std::string capture_file;
+    int capture_ntop = 8;
+
+    ParmParse ppc("chem");
+    ppc.query("capture_file", capture_file);
+    ppc.query("capture_ntop", capture_ntop);
+
+    if (!capture_file.empty())
+    {
+	std::ostringstream fname;
+	fname << capture_file << '.' << ParallelDescriptor::MyProc();
+
+	const std::string& f = fname.str();
+	Array<int> name_f(f.size());
+	for (int i=0; i<f.size(); i++) name_f[i] = f[i];
+	int lname = f.size();
+
+	BL_FORT_PROC_CALL(CD_INITCAPTURE, cd_initcapture)
+	    (name_f.dataPtr(), lname, capture_ntop);
+    }
+
+    // eglib; tab_tol > 0 tabulates the transport fits on [tab_tmin,tab_tmax]
+    // to that relative accuracy
     int use_bulk_visc = 1;
+    Real tab_tol = -1, tab_tmin = 200, tab_tmax = 4000;
 
     ParmParse ppe("eglib");
     ppe.query("use_bulk_visc", use_bulk_visc);
+    ppe.query("tab_tol", tab_tol);
+    ppe.query("tab_tmin", tab_tmin);
+    ppe.query("tab_tmax", tab_tmax);
     
     BL_FORT_PROC_CALL(CD_INITEGLIB, cd_initeglib)
-	(use_bulk_visc);
+	(use_bulk_visc, tab_tol, tab_tmin, tab_tmax);
 }
 
 
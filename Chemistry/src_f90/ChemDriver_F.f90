@@ -100,13 +100,23 @@ subroutine cd_closebdf()
 end subroutine cd_closebdf
 
 
-subroutine cd_initeglib(use_bulk_visc_in)
+! name is the corpus file name coded as integers.
+subroutine cd_initcapture(name, lname, ntop)
+  use chemistry_module, only : nspecies
+  implicit none
+  integer, intent(in) :: lname, name(lname), ntop
+  call chem_capture_setup(name, lname, nspecies, ntop)
+end subroutine cd_initcapture
+
+
+subroutine cd_initeglib(use_bulk_visc_in, tab_tol, tab_tmin, tab_tmax)
   use egz_module
   implicit none
   integer, intent(in) :: use_bulk_visc_in
+  double precision, intent(in) :: tab_tol, tab_tmin, tab_tmax
   logical :: use_bulk_visc
   use_bulk_visc = (use_bulk_visc_in .ne. 0)
-  call egz_init(use_bulk_visc)
+  call egz_init(use_bulk_visc, tab_tol, tab_tmin, tab_tmax)
 end subroutine cd_initeglib
 
 
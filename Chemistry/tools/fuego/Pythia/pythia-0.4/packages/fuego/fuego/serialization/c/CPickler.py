@@ -435,6 +435,7 @@ class CPickler(CMill):
         self._thermo(mechanism)
         self._molecularWeight(mechanism)
         self._atomicWeight(mechanism)
+        self._T_tol(mechanism)
         self._T_given_ey(mechanism)
         self._T_given_hy(mechanism)
         return
@@ -543,6 +544,7 @@ class CPickler(CMill):
             '#define VCKWYR VCKWYR',
             '#define VCKYTX VCKYTX',
             '#define GET_T_GIVEN_EY GET_T_GIVEN_EY',
+            '#define GET_T_TOL GET_T_TOL',
             '#define GET_T_GIVEN_HY GET_T_GIVEN_HY',
             '#define GET_REACTION_MAP GET_REACTION_MAP',
             '#elif defined(BL_FORT_USE_LOWERCASE)',
@@ -628,6 +630,7 @@ class CPickler(CMill):
             '#define VCKWYR vckwyr',
             '#define VCKYTX vckytx',
             '#define GET_T_GIVEN_EY get_t_given_ey',
+            '#define GET_T_TOL get_t_tol',
             '#define GET_T_GIVEN_HY get_t_given_hy',
             '#define GET_REACTION_MAP get_reaction_map',
             '#elif defined(BL_FORT_USE_UNDERSCORE)',
@@ -713,6 +716,7 @@ class CPickler(CMill):
             '#define VCKWYR vckwyr_',
             '#define VCKYTX vckytx_',
             '#define GET_T_GIVEN_EY get_t_given_ey_',
+            '#define GET_T_TOL get_t_tol_',
             '#define GET_T_GIVEN_HY get_t_given_hy_',
             '#define GET_REACTION_MAP get_reaction_map_',
             '#endif','',
@@ -825,6 +829,7 @@ class CPickler(CMill):
             'void aJacobian(double * restrict J, double * restrict sc, double T, int consP);',
             'void dcvpRdT(double * restrict species, double * restrict tc);',
             'void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);',
+            'void GET_T_TOL(double * restrict tol, int * maxiter);',
             'void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);',
             'void GET_REACTION_MAP(int * restrict rmap);',
             self.line('vector version'),
@@ -7117,27 +7122,37 @@ class CPickler(CMill):
         self._write('%+15.8e ;' % (parameters[6]))
         return
 
-    def _T_given_ey(self, mechanism):
-        self._write(self.line(' get temperature given internal energy in mass units and mass fracs'))
-        self._write('void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)')
+    def _T_tol(self, mechanism):
+        self._write(self.line(' tolerance and iteration limit of the Newton solves for T'))
+        self._write('void GET_T_TOL(double * restrict tol, int * maxiter)')
         self._write('{')
         self._write('#ifdef CONVERGENCE')
         self._indent()
-        self._write('const int maxiter = 5000;')
-        self._write('const double tol  = 1.e-12;')
+        self._write('*maxiter = 5000;')
+        self._write('*tol = 1.e-12;')
         self._outdent()
         self._write('#else')
         self._indent()
-        self._write('const int maxiter = 200;')
-        self._write('const double tol  = 1.e-6;')
+        self._write('*maxiter = 200;')
+        self._write('*tol = 1.e-6;')
         self._outdent()
         self._write('#endif')
+        self._write('}')
+        self._write()
+
+    def _T_given_ey(self, mechanism):
+        self._write(self.line(' get temperature given internal energy in mass units and mass fracs'))
+        self._write('void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)')
+        self._write('{')
         self._indent()
+        self._write('int maxiter;')
+        self._write('double tol;')
         self._write('double ein  = *e;')
         self._write('double tmin = 250;'+self.line('max lower bound for thermo def'))
         self._write('double tmax = 4000;'+self.line('min upper bound for thermo def'))
         self._write('double e1,emin,emax,cv,t1,dt;')
         self._write('int i;'+self.line(' loop counter'))
+        self._write('GET_T_TOL(&tol, &maxiter);')
         self._write('CKUBMS(&tmin, y, iwrk, rwrk, &emin);')
         self._write('CKUBMS(&tmax, y, iwrk, rwrk, &emax);')
         self._write('if (ein < emin) {')
@@ -7186,23 +7201,15 @@ class CPickler(CMill):
         self._write(self.line(' get temperature given enthalpy in mass units and mass fracs'))
         self._write('void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)')
         self._write('{')
-        self._write('#ifdef CONVERGENCE')
-        self._indent()
-        self._write('const int maxiter = 5000;')
-        self._write('const double tol  = 1.e-12;')
-        self._outdent()
-        self._write('#else')
-        self._indent()
-        self._write('const int maxiter = 200;')
-        self._write('const double tol  = 1.e-6;')
-        self._outdent()
-        self._write('#endif')
         self._indent()
+        self._write('int maxiter;')
+        self._write('double tol;')
         self._write('double hin  = *h;')
         self._write('double tmin = 250;'+self.line('max lower bound for thermo def'))
         self._write('double tmax = 4000;'+self.line('min upper bound for thermo def'))
         self._write('double h1,hmin,hmax,cp,t1,dt;')
         self._write('int i;'+self.line(' loop counter'))
+        self._write('GET_T_TOL(&tol, &maxiter);')
         self._write('CKHBMS(&tmin, y, iwrk, rwrk, &hmin);')
         self._write('CKHBMS(&tmax, y, iwrk, rwrk, &hmax);')
         self._write('if (hin < hmin) {')
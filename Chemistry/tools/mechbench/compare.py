@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+#
+# Compare two mechbench result files:  compare.py baseline results [tol [ctol]]
+#
+# Prints the ratio new/old of each timing, flags those slower by more than
+# tol (default 0.1) and the mechanisms whose checksum moved by more than
+# ctol (default 1e-8) relative.  The checksum is O(1) and positive (see
+# mechbench.c), so a relative test is meaningful.  Exits with 1 if
+# anything was flagged.
+#
+import sys
+
+KERNELS = ['productionRate', 'vproductionRate', 'DWDOT', 'CKHMS', 'CKCPBS', 'CKWYR']
+
+def read(fname):
+    res = {}
+    for line in open(fname):
+        if line.startswith('#') or not line.strip():
+            continue
+        f = line.split()
+        res[f[0]] = ([float(x) for x in f[3:9]], float(f[11]))
+    return res
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: compare.py baseline results [tol [ctol]]')
+    old = read(sys.argv[1])
+    new = read(sys.argv[2])
+    tol = float(sys.argv[3]) if len(sys.argv) > 3 else 0.1
+    ctol = float(sys.argv[4]) if len(sys.argv) > 4 else 1.e-8
+
+    print('%-32s' % 'mechanism' + ''.join(' %15s' % k for k in KERNELS))
+
+    bad = False
+    for name in sorted(new):
+        if name not in old:
+            print('%-32s (not in baseline)' % name)
+            continue
+        (tn, cn), (to, co) = new[name], old[name]
+        line = '%-32s' % name
+        for a, b in zip(tn, to):
+            r = a / b if b > 0 else 0
+            flag = '*' if r > 1 + tol else ' '
+            bad = bad or flag == '*'
+            line += ' %14.3f%s' % (r, flag)
+        if abs(cn - co) > ctol * abs(co):
+            line += '  checksum %.14e -> %.14e' % (co, cn)
+            bad = True
+        print(line)
+
+    for name in sorted(old):
+        if name not in new:
+            print('%-32s (missing from results)' % name)
+
+    sys.exit(1 if bad else 0)
+
+if __name__ == '__main__':
+    main()
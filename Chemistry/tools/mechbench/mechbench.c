@@ -0,0 +1,207 @@
+/*
+ * Microbenchmark of the kernels of a Fuego-generated mechanism file.
+ *
+ * Linked with one mechanism's C file (see the Makefile), it times
+ *
+ *   productionRate   net production rates, one point
+ *   vproductionRate  the same, vectorized over points
+ *   DWDOT            analytic Jacobian of the production rates
+ *   CKHMS            species enthalpies
+ *   CKCPBS           mixture cp
+ *   CKWYR            production rates from rho, T, Y
+ *
+ * on npt random states (T in 300-2800 K, random positive Y summing to 1,
+ * P = 1 atm), each repeated until mintime seconds have passed, and prints
+ * one line: the name, the species and reaction counts, the ns per point of
+ * each kernel, those of productionRate and DWDOT per reaction, and a
+ * checksum of the production rates, so that regenerated code can be
+ * checked for both speed and results.
+ *
+ *   mechbench.exe name [npt [mintime [vnpt]]]
+ *
+ * vnpt is the number of points per vproductionRate call (its work arrays
+ * are on the stack).
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+void CKINIT();
+void CKINDX(int * iwrk, double * rwrk, int * mm, int * kk, int * ii, int * nfit);
+void CKYTCP(double * P, double * T, double * y, int * iwrk, double * rwrk, double * c);
+void CKRHOY(double * P, double * T, double * y, int * iwrk, double * rwrk, double * rho);
+void CKHMS(double * T, int * iwrk, double * rwrk, double * hms);
+void CKCPBS(double * T, double * y, int * iwrk, double * rwrk, double * cpbs);
+void CKWYR(double * rho, double * T, double * y, int * iwrk, double * rwrk, double * wdot);
+void productionRate(double * wdot, double * sc, double T);
+void vproductionRate(int npt, double * wdot, double * sc, double * T);
+void DWDOT(double * J, double * sc, double * T, int * consP);
+
+enum { K_PR, K_VPR, K_DWDOT, K_HMS, K_CPBS, K_WYR, NKERNELS };
+
+static int    nspec, nreac, npt, vnpt;
+static double *T, *Y, *C, *Csi, *Csoa, *rho, *out;
+static double sink;
+
+static double
+now ()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1.e-9*ts.tv_nsec;
+}
+
+/* Deterministic, so that every build sees the same states. */
+static double
+rnd ()
+{
+    static unsigned long long s = 88172645463325252ULL;
+    s ^= s << 13;
+    s ^= s >> 7;
+    s ^= s << 17;
+    return (s >> 11) * (1.0/9007199254740992.0);
+}
+
+/* One pass of kernel k over all the points. */
+static void
+pass (int k)
+{
+    int iwrk = 0, consP = 1;
+    double rwrk = 0;
+
+    for (int i = 0; i < npt; i++)
+    {
+        double *y = Y + i*nspec;
+
+        switch (k)
+        {
+        case K_PR:
+            productionRate(out, Csi + i*nspec, T[i]);
+            break;
+        case K_VPR:
+            if (i % vnpt == 0)
+            {
+                const int n = (npt - i < vnpt) ? npt - i : vnpt;
+                vproductionRate(n, out, Csoa + i*nspec, T + i);
+            }
+            break;
+        case K_DWDOT:
+            DWDOT(out, C + i*nspec, T + i, &consP);
+            break;
+        case K_HMS:
+            CKHMS(T + i, &iwrk, &rwrk, out);
+            break;
+        case K_CPBS:
+            CKCPBS(T + i, y, &iwrk, &rwrk, out);
+            break;
+        case K_WYR:
+            CKWYR(rho + i, T + i, y, &iwrk, &rwrk, out);
+            break;
+        }
+        sink += out[0];
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+    const char *name = argc > 1 ? argv[1] : "mechanism";
+    double mintime   = 0.2;
+    int    iwrk = 0, mm, nfit;
+    double rwrk = 0, P = 1013250.0;
+
+    npt  = argc > 2 ? atoi(argv[2]) : 1024;
+    vnpt = argc > 4 ? atoi(argv[4]) : 32;
+    if (argc > 3) mintime = atof(argv[3]);
+
+    CKINIT();
+    CKINDX(&iwrk, &rwrk, &mm, &nspec, &nreac, &nfit);
+
+    T    = malloc(npt*sizeof(double));
+    rho  = malloc(npt*sizeof(double));
+    Y    = malloc(npt*nspec*sizeof(double));
+    C    = malloc(npt*nspec*sizeof(double));
+    Csi  = malloc(npt*nspec*sizeof(double));
+    Csoa = malloc(npt*nspec*sizeof(double));
+    out  = malloc((nspec+1)*(nspec+1 > vnpt ? nspec+1 : vnpt)*sizeof(double));
+    /*
+     * C is in mol/cm^3 for DWDOT, Csi in mol/m^3 for productionRate, and
+     * Csoa is Csi in the species-major blocks of vnpt points that
+     * vproductionRate wants.
+     */
+    for (int i = 0; i < npt; i++)
+    {
+        double sum = 0, *y = Y + i*nspec;
+
+        T[i] = 300 + 2500*rnd();
+        for (int n = 0; n < nspec; n++)
+        {
+            const double u = rnd();
+            y[n] = u*u*u*u + 1.e-12;
+            sum += y[n];
+        }
+        for (int n = 0; n < nspec; n++)
+            y[n] /= sum;
+
+        CKRHOY(&P, T + i, y, &iwrk, &rwrk, rho + i);
+        CKYTCP(&P, T + i, y, &iwrk, &rwrk, C + i*nspec);
+        for (int n = 0; n < nspec; n++)
+            Csi[i*nspec+n] = 1.e6 * C[i*nspec+n];
+    }
+
+    for (int b = 0; b < npt; b += vnpt)
+    {
+        const int nb = (npt - b < vnpt) ? npt - b : vnpt;
+        for (int n = 0; n < nspec; n++)
+            for (int i = 0; i < nb; i++)
+                Csoa[b*nspec + n*nb + i] = Csi[(b+i)*nspec + n];
+    }
+    /*
+     * Checksum: the mean over points and species of log(1 + |wdot|/ctot),
+     * ctot the total concentration of the point, with the produced species
+     * counted twice.  It is O(1) and a sum of positive terms, so it can be
+     * compared to a relative tolerance: a signed sum of the rates cancels
+     * (to roundoff, if its weights are a combination of the elements).
+     */
+    double check = 0;
+    for (int i = 0; i < npt; i++)
+    {
+        double ctot = 0;
+        productionRate(out, Csi + i*nspec, T[i]);
+        for (int n = 0; n < nspec; n++)
+            ctot += Csi[i*nspec+n];
+        for (int n = 0; n < nspec; n++)
+            check += (out[n] > 0 ? 2 : 1) * log1p(fabs(out[n])/ctot);
+    }
+    check /= (double) npt * nspec;
+
+    double ns[NKERNELS];
+
+    for (int k = 0; k < NKERNELS; k++)
+    {
+        long   reps = 0;
+        double t0, t;
+
+        pass(k);               /* warm up */
+        t0 = now();
+        do {
+            pass(k);
+            reps++;
+            t = now() - t0;
+        } while (t < mintime);
+
+        ns[k] = 1.e9*t/(reps*(double)npt);
+    }
+
+    printf("%-32s %5d %6d", name, nspec, nreac);
+    for (int k = 0; k < NKERNELS; k++)
+        printf(" %10.1f", ns[k]);
+    printf(" %8.3f %8.3f %22.14e\n", ns[K_PR]/nreac, ns[K_DWDOT]/nreac, check);
+
+    if (sink == 12345.6789) printf("\n");
+
+    return 0;
+}
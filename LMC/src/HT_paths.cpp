@@ -0,0 +1,227 @@
+//
+// In-situ reaction path fluxes.
+//
+// For each traced element, ChemDriver::getEdges gives the edges of the
+// chemical path diagram: an edge carries the element from one species to
+// another through a list of reactions, each transferring a given number of
+// atoms.  Rather than writing the REACTIONS diagnostic (one component per
+// reaction) and building the diagrams offline, strang_chem has the
+// chemistry integrator return the rates of progress of the reactions,
+// integrated over the step, for each box it reacts.  They are integrated
+// over the cells of the box right away, so only one number per reaction is
+// kept per rank.  The time integral is the trapezoidal rule on the states
+// at the ends of the step (on nchemdiag sub-steps when REACTIONS is
+// plotted too), so tracing the paths leaves the solution unchanged.
+//
+// Every ns.rxn_paths_int coarse steps these are turned into the net number
+// of moles of atoms moved along each edge, reduced across ranks, appended
+// to the text file ns.rxn_paths_file, and reset.  Only cells not covered by
+// a finer level count, and the cells can be restricted to a region and a
+// temperature window.
+//
+// Inputs:
+//
+//   ns.rxn_paths      = C N           # traced elements
+//   ns.rxn_paths_int  = 10            # output interval, coarse steps
+//   ns.rxn_paths_file = paths
+//   ns.rxn_paths_lo   = 0.0 0.0 0.0   # region, default the domain
+//   ns.rxn_paths_hi   = 0.1 0.1 0.2
+//   ns.rxn_paths_Tmin = 1000          # temperature window, default all
+//   ns.rxn_paths_Tmax = 2200
+//
+#include <winstd.H>
+
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include <iomanip>
+
+#include <ParmParse.H>
+#include <Utility.H>
+#include <HeatTransfer.H>
+
+Array<ChemDriver::Edge> HeatTransfer::rxn_paths_edges;
+Array<std::string>      HeatTransfer::rxn_paths_edge_elt;
+Array<Real>             HeatTransfer::rxn_paths_R;
+Real                    HeatTransfer::rxn_paths_t0   = -1;
+int                     HeatTransfer::rxn_paths_int  = 10;
+std::string             HeatTransfer::rxn_paths_file = "paths";
+Real                    HeatTransfer::rxn_paths_Tmin = -DBL_MAX;
+Real                    HeatTransfer::rxn_paths_Tmax = DBL_MAX;
+Array<Real>             HeatTransfer::rxn_paths_lo;
+Array<Real>             HeatTransfer::rxn_paths_hi;
+
+void
+HeatTransfer::read_rxn_paths_params ()
+{
+    ParmParse pp("ns");
+
+    rxn_paths_edges.clear();
+    rxn_paths_edge_elt.clear();
+    rxn_paths_R.clear();
+
+    const int nelts = pp.countval("rxn_paths");
+
+    if (nelts == 0)
+        return;
+
+    Array<std::string> elts(nelts);
+    pp.getarr("rxn_paths",elts);
+
+    pp.query("rxn_paths_int",rxn_paths_int);
+    pp.query("rxn_paths_file",rxn_paths_file);
+    pp.query("rxn_paths_Tmin",rxn_paths_Tmin);
+    pp.query("rxn_paths_Tmax",rxn_paths_Tmax);
+
+    if (rxn_paths_int <= 0)
+        BoxLib::Error("HeatTransfer::read_rxn_paths_params: rxn_paths_int must be > 0");
+
+    rxn_paths_lo.resize(BL_SPACEDIM,-DBL_MAX);
+    rxn_paths_hi.resize(BL_SPACEDIM, DBL_MAX);
+    if (pp.contains("rxn_paths_lo"))
+        pp.getarr("rxn_paths_lo",rxn_paths_lo,0,BL_SPACEDIM);
+    if (pp.contains("rxn_paths_hi"))
+        pp.getarr("rxn_paths_hi",rxn_paths_hi,0,BL_SPACEDIM);
+    //
+    // The edges of each element, with the edges between the same two
+    // species merged.
+    //
+    for (int i = 0; i < nelts; i++)
+    {
+        const std::list<ChemDriver::Edge> edges = getChemSolve().getEdges(elts[i]);
+
+        const int first = rxn_paths_edges.size();
+
+        for (std::list<ChemDriver::Edge>::const_iterator it = edges.begin(); it != edges.end(); ++it)
+        {
+            bool merged = false;
+
+            for (int e = first; e < rxn_paths_edges.size() && !merged; e++)
+            {
+                const int sgn = rxn_paths_edges[e].equivSign(*it);
+                if (sgn != 0)
+                {
+                    rxn_paths_edges[e].combine(*it,sgn);
+                    merged = true;
+                }
+            }
+
+            if (!merged)
+            {
+                rxn_paths_edges.push_back(*it);
+                rxn_paths_edge_elt.push_back(elts[i]);
+            }
+        }
+    }
+
+    rxn_paths_R.resize(getChemSolve().numReactions(),0);
+}
+
+//
+// diag holds the rates of progress of the reactions integrated over the
+// chemistry step in box, in mol/m^3; it is overwritten.  S holds the state
+// after the step, with the temperature in Tcomp.  Cells of box in covered
+// are under a finer level.
+//
+void
+HeatTransfer::rxn_paths_accum (FArrayBox&       diag,
+                               const FArrayBox& S,
+                               const Box&       box,
+                               int              Tcomp,
+                               const BoxArray&  covered)
+{
+    if (rxn_paths_t0 < 0)
+        rxn_paths_t0 = state[State_Type].prevTime();
+
+    const Real* dx  = geom.CellSize();
+    const Real* plo = geom.ProbLo();
+
+    FArrayBox w;
+    geom.GetVolume(w,box);
+
+    for (IntVect iv = box.smallEnd(); iv <= box.bigEnd(); box.next(iv))
+    {
+        const Real T = S(iv,Tcomp);
+
+        bool in = T >= rxn_paths_Tmin && T <= rxn_paths_Tmax;
+
+        for (int d = 0; d < BL_SPACEDIM && in; d++)
+        {
+            const Real x = plo[d] + (iv[d] + 0.5) * dx[d];
+            in = x >= rxn_paths_lo[d] && x <= rxn_paths_hi[d];
+        }
+
+        if (!in) w(iv) = 0;
+    }
+
+    std::vector< std::pair<int,Box> > isects;
+
+    covered.intersections(box,isects);
+
+    for (int i = 0, N = isects.size(); i < N; i++)
+        w.setVal(0,isects[i].second,0,1);
+
+    for (int r = 0; r < rxn_paths_R.size(); r++)
+    {
+        diag.mult(w,box,0,r,1);
+        rxn_paths_R[r] += diag.sum(box,r);
+    }
+}
+
+void
+HeatTransfer::rxn_paths_write ()
+{
+    BL_ASSERT(level == 0);
+
+    const int  IOProc = ParallelDescriptor::IOProcessorNumber();
+    const Real time   = state[State_Type].curTime();
+    const int  nedges = rxn_paths_edges.size();
+    //
+    // Moles of atoms moved along each edge, from its left to its right
+    // species.
+    //
+    Array<Real> flux(nedges,0);
+
+    for (int e = 0; e < nedges; e++)
+    {
+        const Array<std::pair<int,Real> >& rwl = rxn_paths_edges[e].rwl();
+
+        for (int i = 0; i < rwl.size(); i++)
+            flux[e] += rwl[i].second * rxn_paths_R[rwl[i].first];
+    }
+
+    ParallelDescriptor::ReduceRealSum(flux.dataPtr(),nedges,IOProc);
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        std::ofstream os(rxn_paths_file.c_str(), std::ios::out|std::ios::app);
+
+        os << "# time " << std::setprecision(12) << rxn_paths_t0 << ' ' << time << '\n';
+
+        for (int e = 0; e < nedges; e++)
+            os << rxn_paths_edge_elt[e]         << ' '
+               << rxn_paths_edges[e].left()     << ' '
+               << rxn_paths_edges[e].right()    << ' '
+               << std::setprecision(8) << flux[e] << '\n';
+
+        if (!os.good())
+            BoxLib::FileOpenFailed(rxn_paths_file);
+    }
+
+    std::fill(rxn_paths_R.begin(),rxn_paths_R.end(),0);
+
+    rxn_paths_t0 = time;
+}
+
+//
+// Drop what has been accumulated, and restart the interval at the next
+// chemistry step.  post_init calls this once the initial iterations, whose
+// chemistry is thrown away, are done.
+//
+void
+HeatTransfer::rxn_paths_reset ()
+{
+    std::fill(rxn_paths_R.begin(),rxn_paths_R.end(),0);
+
+    rxn_paths_t0 = -1;
+}
@@ -0,0 +1,322 @@
+//
+// In-situ statistics.
+//
+// Instead of writing plotfiles for offline statistics, each statistics set
+// accumulates volume-weighted moments of a list of derived quantities,
+// binned on a conditioning quantity, every ns.stats_int coarse steps.  The
+// conditioning quantity is a derived quantity (e.g. temp, or tracer used as
+// a mixture fraction), "progress" (a sum of species mass fractions), or a
+// coordinate x, y or z, which gives slab averages.  All levels contribute,
+// with the cells covered by a finer level masked out.
+//
+// Every ns.stats_out_int coarse steps the sums of all sets are reduced onto
+// the IO processor with one collective, appended as one record to the
+// binary file <ns.stats_file>_<set>, and reset.  A record is
+//
+//   time, nsamples, then for each bin:  W, (W q_n, W q^2_n) for each var
+//
+// in Reals, where W is the volume summed over samples.  <ns.stats_file>_<set>.hdr
+// describes the layout.
+//
+// Inputs:
+//
+//   ns.stats          = flame slab           # names of the sets
+//   ns.stats_int      = 10                   # sample interval, coarse steps
+//   ns.stats_out_int  = 100                  # output interval, coarse steps
+//   ns.stats_file     = stats
+//
+//   stats.flame.cond    = progress
+//   stats.flame.species = H2O                # for cond = progress
+//   stats.flame.range   = 0 0.25
+//   stats.flame.nbins   = 50
+//   stats.flame.vars    = temp Y(OH) mag_vort
+//
+//   stats.slab.cond     = z                  # range and nbins default to
+//   stats.slab.vars     = density temp       # the level 0 domain and cells
+//
+#include <winstd.H>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include <ParmParse.H>
+#include <Utility.H>
+#include <HeatTransfer.H>
+#include <SLABSTAT_HT_F.H>
+
+Array<HeatTransfer::StatsSet> HeatTransfer::stats_sets;
+int                           HeatTransfer::stats_int      = 0;
+int                           HeatTransfer::stats_out_int  = 0;
+int                           HeatTransfer::stats_nsamples = 0;
+std::string                   HeatTransfer::stats_file     = "stats";
+
+void
+HeatTransfer::read_stats_params ()
+{
+    ParmParse pp("ns");
+
+    pp.query("stats_int",stats_int);
+    pp.query("stats_out_int",stats_out_int);
+    pp.query("stats_file",stats_file);
+
+    stats_sets.clear();
+    stats_nsamples = 0;
+
+    const int nsets = pp.countval("stats");
+
+    if (stats_int <= 0 || nsets == 0)
+    {
+        stats_int = 0;
+        return;
+    }
+
+    if (stats_out_int <= 0)
+        stats_out_int = stats_int;
+
+    Array<std::string> names(nsets);
+    pp.getarr("stats",names);
+
+    for (int i = 0; i < nsets; i++)
+    {
+        ParmParse pps("stats." + names[i]);
+
+        StatsSet s;
+
+        s.name  = names[i];
+        s.cdir  = -1;
+        s.lo    = 0;
+        s.hi    = 0;
+        s.nbins = 0;
+
+        pps.get("cond",s.cond);
+
+        for (int d = 0; d < BL_SPACEDIM; d++)
+            if (s.cond == std::string(1,"xyz"[d]))
+                s.cdir = d;
+
+        if (s.cond == "progress")
+        {
+            const int nsp = pps.countval("species");
+            if (nsp == 0)
+                BoxLib::Error("HeatTransfer::read_stats_params: progress needs species");
+            Array<std::string> spec(nsp);
+            pps.getarr("species",spec);
+            for (int n = 0; n < nsp; n++)
+            {
+                const int idx = getChemSolve().index(spec[n]);
+                if (idx < 0)
+                    BoxLib::Error("HeatTransfer::read_stats_params: unknown species " + spec[n]);
+                s.species.push_back(idx);
+            }
+        }
+
+        if (s.cdir < 0 || pps.contains("range"))
+        {
+            Array<Real> range(2);
+            pps.getarr("range",range,0,2);
+            s.lo = range[0];
+            s.hi = range[1];
+            if (s.hi <= s.lo)
+                BoxLib::Error("HeatTransfer::read_stats_params: empty range for " + s.name);
+        }
+
+        pps.query("nbins",s.nbins);
+        if (s.cdir < 0 && s.nbins <= 0)
+            s.nbins = 100;
+
+        const int nvars = pps.countval("vars");
+        if (nvars == 0)
+            BoxLib::Error("HeatTransfer::read_stats_params: no vars for " + s.name);
+        s.vars.resize(nvars);
+        pps.getarr("vars",s.vars);
+
+        stats_sets.push_back(s);
+    }
+}
+
+void
+HeatTransfer::stats_sample ()
+{
+    BL_ASSERT(level == 0);
+    BL_PROFILE("HeatTransfer::stats_sample()");
+
+    const int finest_level = parent->finestLevel();
+    //
+    // Slab sets default to the level 0 domain and cells.
+    //
+    for (int i = 0; i < stats_sets.size(); i++)
+    {
+        StatsSet& s = stats_sets[i];
+
+        if (s.sums.size() == 0)
+        {
+            if (s.cdir >= 0 && s.hi <= s.lo)
+            {
+                s.lo = geom.ProbLo(s.cdir);
+                s.hi = geom.ProbHi(s.cdir);
+            }
+            if (s.nbins <= 0)
+                s.nbins = geom.Domain().length(s.cdir);
+
+            s.sums.resize(s.nbins*(1+2*s.vars.size()),0);
+        }
+    }
+
+    for (int lev = 0; lev <= finest_level; lev++)
+    {
+        HeatTransfer&   ht   = getLevel(lev);
+        const BoxArray& grds = ht.grids;
+        const Real      time = ht.state[State_Type].curTime();
+        const Real*     dx   = ht.geom.CellSize();
+        const Real*     plo  = ht.geom.ProbLo();
+        //
+        // Cell weights: the volume, zero under the next finer level.
+        //
+        MultiFab w(grds,1,0);
+        MultiFab::Copy(w,ht.volume,0,0,1,0);
+
+        if (lev < finest_level)
+        {
+            BoxArray baf = getLevel(lev+1).boxArray();
+
+            baf.coarsen(parent->refRatio(lev));
+
+            std::vector< std::pair<int,Box> > isects;
+
+            for (MFIter mfi(w); mfi.isValid(); ++mfi)
+            {
+                baf.intersections(grds[mfi.index()],isects);
+
+                for (int ii = 0, N = isects.size(); ii < N; ii++)
+                    w[mfi].setVal(0,isects[ii].second,0,1);
+            }
+        }
+
+        for (int i = 0; i < stats_sets.size(); i++)
+        {
+            StatsSet& s  = stats_sets[i];
+            const int nq = s.vars.size();
+
+            MultiFab Q(grds,nq,0);
+
+            for (int n = 0; n < nq; n++)
+            {
+                MultiFab* q = ht.derive(s.vars[n],time,0);
+                MultiFab::Copy(Q,*q,0,n,1,0);
+                delete q;
+            }
+
+            MultiFab* cond = 0;
+
+            if (s.cond == "progress")
+            {
+                const MultiFab& S = ht.get_new_data(State_Type);
+
+                cond = new MultiFab(grds,1,0);
+
+                for (MFIter mfi(*cond); mfi.isValid(); ++mfi)
+                {
+                    const Box& bx = mfi.validbox();
+                    FArrayBox& c  = (*cond)[mfi];
+
+                    c.setVal(0,bx,0,1);
+                    for (int n = 0; n < s.species.size(); n++)
+                        c.plus(S[mfi],bx,first_spec+s.species[n],0,1);
+                    c.divide(S[mfi],bx,Density,0,1);
+                }
+            }
+            else if (s.cdir < 0)
+            {
+                cond = ht.derive(s.cond,time,0);
+            }
+
+            for (MFIter mfi(Q); mfi.isValid(); ++mfi)
+            {
+                const Box&       bx = mfi.validbox();
+                const FArrayBox& q  = Q[mfi];
+                const FArrayBox& c  = cond ? (*cond)[mfi] : Q[mfi];
+                const FArrayBox& wt = w[mfi];
+
+                FORT_HT_CONDSTATS(bx.loVect(),bx.hiVect(),
+                                  c.dataPtr(),ARLIM(c.loVect()),ARLIM(c.hiVect()),
+                                  &s.cdir,
+                                  q.dataPtr(),ARLIM(q.loVect()),ARLIM(q.hiVect()),&nq,
+                                  wt.dataPtr(),ARLIM(wt.loVect()),ARLIM(wt.hiVect()),
+                                  plo,dx,&s.lo,&s.hi,&s.nbins,s.sums.dataPtr());
+            }
+
+            delete cond;
+        }
+    }
+
+    stats_nsamples++;
+}
+
+void
+HeatTransfer::stats_write ()
+{
+    BL_ASSERT(level == 0);
+    BL_PROFILE("HeatTransfer::stats_write()");
+
+    const int IOProc = ParallelDescriptor::IOProcessorNumber();
+    const Real time  = state[State_Type].curTime();
+    //
+    // One reduction for all the sets.
+    //
+    Array<Real> buf;
+
+    for (int i = 0; i < stats_sets.size(); i++)
+        buf.insert(buf.end(),stats_sets[i].sums.begin(),stats_sets[i].sums.end());
+
+    ParallelDescriptor::ReduceRealSum(buf.dataPtr(),buf.size(),IOProc);
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        static bool header_written = false;
+
+        long off = 0;
+
+        for (int i = 0; i < stats_sets.size(); i++)
+        {
+            const StatsSet&   s     = stats_sets[i];
+            const std::string fname = stats_file + "_" + s.name;
+
+            if (!header_written)
+            {
+                std::ofstream hdr((fname + ".hdr").c_str());
+                hdr << "cond "  << s.cond << '\n'
+                    << "range " << std::setprecision(17) << s.lo << ' ' << s.hi << '\n'
+                    << "nbins " << s.nbins << '\n'
+                    << "vars  " << s.vars.size();
+                for (int n = 0; n < s.vars.size(); n++)
+                    hdr << ' ' << s.vars[n];
+                hdr << '\n'
+                    << "real_size " << sizeof(Real) << '\n'
+                    << "record time nsamples [W [Wq Wq^2]*nvars]*nbins\n";
+            }
+
+            const Real head[2] = { time, Real(stats_nsamples) };
+
+            std::ofstream os(fname.c_str(), std::ios::out|std::ios::app|std::ios::binary);
+            os.write((const char*) head, sizeof(head));
+            os.write((const char*) &buf[off], s.sums.size()*sizeof(Real));
+
+            if (!os.good())
+                BoxLib::FileOpenFailed(fname);
+
+            off += s.sums.size();
+        }
+
+        header_written = true;
+
+        if (verbose)
+            std::cout << "HeatTransfer::stats_write: " << stats_nsamples
+                      << " samples at time " << time << '\n';
+    }
+
+    for (int i = 0; i < stats_sets.size(); i++)
+        std::fill(stats_sets[i].sums.begin(),stats_sets[i].sums.end(),0);
+
+    stats_nsamples = 0;
+}
@@ -158,6 +158,10 @@ Real HeatTransfer::htt_tempmax;
 Real HeatTransfer::htt_hmixTYP;
 int  HeatTransfer::siegel_test;
 int  HeatTransfer::zeroBndryVisc;
+int  HeatTransfer::edge_state_ncomp;
+Real HeatTransfer::diffusivity_lag_tol;
+int  HeatTransfer::diffusivity_lag_max;
+int  HeatTransfer::diffusivity_lag_tile;
 int  HeatTransfer::do_add_nonunityLe_corr_to_rhoh_adv_flux;
 int  HeatTransfer::do_check_divudt;
 int  HeatTransfer::hack_nochem;
@@ -232,6 +236,10 @@ HeatTransfer::Initialize ()
     HeatTransfer::htt_hmixTYP               = -1.;
     HeatTransfer::siegel_test               = 0;
     HeatTransfer::zeroBndryVisc             = 0;
+    HeatTransfer::edge_state_ncomp          = 8;
+    HeatTransfer::diffusivity_lag_tol       = 0;
+    HeatTransfer::diffusivity_lag_max       = 10;
+    HeatTransfer::diffusivity_lag_tile      = 16;
     HeatTransfer::chemSolve                 = 0;
     HeatTransfer::do_check_divudt           = 1;
     HeatTransfer::hack_nochem               = 0;
@@ -349,6 +357,16 @@ HeatTransfer::Initialize ()
 
     pp.query("siegel_test",siegel_test);
     pp.query("zeroBndryVisc",zeroBndryVisc);
+    pp.query("edge_state_ncomp",edge_state_ncomp);
+    //
+    // Transport coefficients are kept on tiles of diffusivity_lag_tile cells
+    // where neither T (relative) nor Y (absolute) has moved by more than
+    // diffusivity_lag_tol since they were computed, for at most
+    // diffusivity_lag_max evaluations in a row.  0 turns this off.
+    //
+    pp.query("diffusivity_lag_tol",diffusivity_lag_tol);
+    pp.query("diffusivity_lag_max",diffusivity_lag_max);
+    pp.query("diffusivity_lag_tile",diffusivity_lag_tile);
     //
     // Set variability/visc for velocities.
     //
@@ -383,6 +401,9 @@ HeatTransfer::Initialize ()
 #ifdef PARTICLES
     read_particle_params ();
 #endif
+
+    read_stats_params ();
+    read_rxn_paths_params ();
         
     if (verbose && ParallelDescriptor::IOProcessor())
     {
@@ -611,6 +632,14 @@ HeatTransfer::HeatTransfer ()
     SpecDiffusionFluxnp1   = 0;
     FillPatchedOldState_ok = true;
     FillPatchedNewState_ok = true;
+
+    for (int w = 0; w < 2; w++)
+    {
+        diff_lag[w]      = 0;
+        diff_lag_coef[w] = 0;
+        diff_lag_pamb[w] = 0;
+    }
+    diff_lag_nrefresh = diff_lag_nreuse = 0;
 }
 
 HeatTransfer::HeatTransfer (Amr&            papa,
@@ -643,12 +672,21 @@ HeatTransfer::HeatTransfer (Amr&            papa,
     if (!have_dsdt)
         BoxLib::Abort("have_dsdt MUST be true");
 
+    for (int w = 0; w < 2; w++)
+    {
+        diff_lag[w]      = 0;
+        diff_lag_coef[w] = 0;
+        diff_lag_pamb[w] = 0;
+    }
+    diff_lag_nrefresh = diff_lag_nreuse = 0;
+
     define_data();
 }
 
 HeatTransfer::~HeatTransfer ()
 {
-    ;
+    delete diff_lag[0];
+    delete diff_lag[1];
 }
 
 void
@@ -1563,6 +1601,20 @@ void
 HeatTransfer::post_timestep (int crse_iteration)
 {
     NavierStokesBase::post_timestep(crse_iteration);
+
+    if (level == 0 && stats_int > 0)
+    {
+        const int nstep = parent->levelSteps(0);
+
+        if (nstep % stats_int == 0)
+            stats_sample();
+
+        if (stats_nsamples > 0 && nstep % stats_out_int == 0)
+            stats_write();
+    }
+
+    if (level == 0 && rxn_paths_R.size() > 0 && parent->levelSteps(0) % rxn_paths_int == 0)
+        rxn_paths_write();
     
     if (plot_reactions && level == 0)
     {
@@ -1815,6 +1867,11 @@ HeatTransfer::post_init (Real stop_time)
     //
     post_init_press(dt_init, nc_save, dt_save);
     //
+    // The reaction path fluxes start with the first real step, not the
+    // chemistry of the divu and pressure iterations above.
+    //
+    rxn_paths_reset();
+    //
     // Compute the initial estimate of conservation.
     //
     if (sum_interval > 0)
@@ -2337,34 +2394,36 @@ HeatTransfer::differential_spec_diffusion_update (Real dt,
         return;
     }
     //
-    // Build single component edge-centered array of MultiFabs for fluxes
-    //
-    MultiFab** fluxSCn;
-    MultiFab** fluxSCnp1;
-    const int nGrow   = 0;
-    const int nCompSC = 1;
-    const int sCompSC = 0;
-    FluxBoxes fb_fluxSCn  (this, nCompSC, nGrow);
-    FluxBoxes fb_fluxSCnp1(this, nCompSC, nGrow);
-    fluxSCn   = fb_fluxSCn.get();
-    fluxSCnp1 = fb_fluxSCnp1.get();
-    //
     // Set diffusion solve mode
     //
     Diffusion::SolveMode solve_mode = Diffusion::PREDICTOR;
     //
-    // Do implicit c-n solve for each scalar...but dont reflux.
-    // Save the fluxes, coeffs and source term, we need 'em for later
+    // Do implicit c-n solve for each species...but dont reflux.
+    // Save the fluxes, coeffs and source term, we need 'em for later.
+    //
+    // What diffuse_scalar_setup would do species by species is done here
+    // for all of them at once: every species has rho_flag = 2, no alpha and
+    // a zero delta_rhs, and the edge diffusivities of all species come from
+    // one getDiffusivity call per time level.  The solves write their
+    // fluxes straight into the species diffusion flux arrays.
     //
+    const int nGrow  = 0;
     const int sCompY = first_spec;
     const int nCompY = nspecies;
-    MultiFab* alpha = 0; // Allocate lazily
+    MultiFab* alpha = 0;
     MultiFab delta_rhs(grids, nCompY, nGrow);
+    delta_rhs.setVal(0);
     FluxBoxes fb_betan  (this, nCompY, nGrow);
     FluxBoxes fb_betanp1(this, nCompY, nGrow);
     MultiFab **betan   = fb_betan.get();
     MultiFab **betanp1 = fb_betanp1.get();
-    Array<int> rho_flag(nCompY,0);
+    Array<int> rho_flag(nCompY,2);
+
+    const Real prev_time = state[State_Type].prevTime();
+    const Real cur_time  = state[State_Type].curTime();
+
+    getDiffusivity(betan,   prev_time,    sCompY, 0, nCompY);
+    getDiffusivity(betanp1, prev_time+dt, sCompY, 0, nCompY);
     
     const MultiFab& RhoHalftime = get_rho_half_time();
 
@@ -2372,70 +2431,13 @@ HeatTransfer::differential_spec_diffusion_update (Real dt,
     {
 	const int state_ind = sCompY + sigma;
 
-	MultiFab* alphaSC;
-	MultiFab* delta_rhsSC;
-	FluxBoxes fb_betanSC, fb_betanp1SC;
-
-	// delta_rhsSC is zero coming out of this
-	diffuse_scalar_setup(dt, state_ind, rho_flag[sigma], delta_rhsSC,
-			     alphaSC, fb_betanSC, fb_betanp1SC);
-	
-	MultiFab** betanSC = fb_betanSC.get();
-	MultiFab** betanp1SC = fb_betanp1SC.get();
-
-	if (state_ind == sCompY && alphaSC)
-	{
-	    alpha = new MultiFab(grids, nCompY, nGrow);
-	}
-	else
-	{
-	    if ((!alphaSC) ^ !alpha)
-		BoxLib::Error("All diff-diffusion must be of same form");
-	}   
-	//    
-	// Nab a copy of the coeffs, call diffuser
-	//
-	if (alphaSC)
-	    MultiFab::Copy(*alpha,*alphaSC,sCompSC,sigma,nCompSC,nGrow);
-	
-	for (int d=0; d<BL_SPACEDIM; ++d)
-	{
-	    if (betanSC)
-		MultiFab::Copy(  *betan[d],  *betanSC[d],sCompSC,sigma,nCompSC,nGrow);
-	    if (betanp1SC)
-		MultiFab::Copy(*betanp1[d],*betanp1SC[d],sCompSC,sigma,nCompSC,nGrow);
-	}
-	//
-	// Make sure we've got a place for delta_rhs...predictor will dump any
-	// explicit updates taken before this routine into delta_rhs for later.
-	//
-	if (delta_rhsSC)
-	{
-	    MultiFab::Copy(delta_rhs,*delta_rhsSC,sCompSC,sigma,nCompSC,nGrow);
-	}
-	else
-	{
-	    delta_rhs.setVal(0,sigma,1);
-	}
-
-	delete delta_rhsSC;
-	delete alphaSC;
-
 	diffusion->diffuse_scalar(dt,state_ind,be_cn_theta,RhoHalftime,rho_flag[sigma],
-                                  fluxSCn,fluxSCnp1,0,&delta_rhs,sigma,alpha,sigma,
+                                  SpecDiffusionFluxn,SpecDiffusionFluxnp1,sigma,
+                                  &delta_rhs,sigma,alpha,sigma,
                                   betan,betanp1,sigma,solve_mode);
-	//
-	// Pull fluxes into flux array
-	//
-	for (int d = 0; d < BL_SPACEDIM; ++d)
-        {
-	    MultiFab::Copy(*SpecDiffusionFluxn[d],  *fluxSCn[d],  sCompSC,sigma,nCompSC,nGrow);
-	    MultiFab::Copy(*SpecDiffusionFluxnp1[d],*fluxSCnp1[d],sCompSC,sigma,nCompSC,nGrow);
-        }
+
 	spec_diffusion_flux_computed[sigma] = HT_Diffusion;
     }
-    fb_fluxSCn.clear();
-    fb_fluxSCnp1.clear();
     //
     // Modify update/fluxes to preserve flux sum = 0, compute new update and
     // leave modified fluxes in level data.  Do this in two stages, first for
@@ -2443,8 +2445,6 @@ HeatTransfer::differential_spec_diffusion_update (Real dt,
     // second one...).
     //
     const int  dataComp  = 0;
-    const Real prev_time = state[State_Type].prevTime();
-    const Real cur_time  = state[State_Type].curTime();
 
     // conservatively correct fluxes at time n, then set new = old + (dt/2)*fluxes^old
     // the 1/2 was added in differential_spec_diffusion_update in compflux (b)
@@ -2462,8 +2462,6 @@ HeatTransfer::differential_spec_diffusion_update (Real dt,
                                  alpha,betanp1);
 
     fb_betanp1.clear();
-    if (alpha)
-	delete alpha;
     //
     // Now do reflux with new, improved fluxes
     //
@@ -4024,6 +4022,8 @@ HeatTransfer::advance (Real time,
                   << " with dt = "         << dt << '\n';
     }
 
+    diff_lag_nrefresh = diff_lag_nreuse = 0;
+
     advance_setup(time,dt,iteration,ncycle);
 
     if (level==0 && reset_typical_vals_int>0)
@@ -4125,6 +4125,14 @@ HeatTransfer::advance (Real time,
     // parallel copy.  It doesn't happen by default (like you might think)
     // due to not being recached appropriately after regridding.
     //
+    // The boxes of aux_boundary_data_old are the grow cells not covered by
+    // any valid box on this level (nor its periodic images), so the ghost
+    // chemistry below only ever sees coarse/fine and physical boundary
+    // cells; the rest of the ghosts come from S_old by FillPatch later.
+    // Those on a physical boundary lie wholly outside the domain, and the
+    // extrapolating and reflecting boundary fills need the interior cells
+    // next to them, so fill a grown copy of S_old and copy them out of it.
+    //
     {
         MultiFab tmpFABs;
 
@@ -4259,6 +4267,19 @@ HeatTransfer::advance (Real time,
         //
         MultiFab::Copy(*diffnp1_cc,*diffn_cc,0,0,nScalDiffs,diffn_cc->nGrow());
 
+        if (diffusivity_lag_tol > 0)
+        {
+            //
+            // The tnp1 coeffs now come from the tn state, but not the viscosity.
+            //
+            Real p_amb;
+            FORT_GETPAMB(&p_amb);
+            MultiFab& lag_n   = *diffusivity_lag(AmrOldTime,p_amb);
+            MultiFab& lag_np1 = *diffusivity_lag(AmrNewTime,p_amb);
+            MultiFab::Copy(lag_np1,lag_n,0,0,nspecies+2,lag_n.nGrow());
+            lag_np1.setVal(0,nspecies+2,1,lag_np1.nGrow());
+        }
+
 	// Eq (13) in DayBell
 	// Here, predict n+1 coeffs using n coeffs
 	// results in Ttilde^np1*
@@ -4489,6 +4510,15 @@ HeatTransfer::advance (Real time,
     //
     dt_test = std::min(dt_test, estTimeStep());
 
+    if (verbose && diffusivity_lag_tol > 0)
+    {
+        long counts[2] = { diff_lag_nrefresh, diff_lag_nreuse };
+        ParallelDescriptor::ReduceLongSum(counts,2);
+        if (ParallelDescriptor::IOProcessor())
+            std::cout << "HeatTransfer::advance(): transport coefficients recomputed on "
+                      << counts[0] << " tiles, reused on " << counts[1] << '\n';
+    }
+
     if (verbose && ParallelDescriptor::IOProcessor())
         std::cout << "HeatTransfer::advance(): at end of time step\n";
 
@@ -4787,6 +4817,24 @@ HeatTransfer::strang_chem (MultiFab&  mf,
             ydot_tmp->copy(mf,ycomp,dCompYdot,nspecies);
 
         FArrayBox* chemDiag = 0;
+        //
+        // For the reaction path fluxes the integrated rates of progress are
+        // taken for each box, added into the REACTIONS diagnostic if there
+        // is one, then reduced over the box.  Only the REACTIONS diagnostic
+        // has the integration split into sub-steps; the path fluxes alone
+        // take the rates at the ends of the usual one, so that the state is
+        // the same with and without them.
+        //
+        const bool do_paths = rxn_paths_R.size() > 0 && ngrow == 0;
+
+        BoxArray  covered;
+        FArrayBox pathDiag;
+
+        if (do_paths && level < parent->finestLevel())
+        {
+            covered = getLevel(level+1).boxArray();
+            covered.coarsen(parent->refRatio(level));
+        }
 
         if (do_not_use_funccount)
         {
@@ -4806,12 +4854,27 @@ HeatTransfer::strang_chem (MultiFab&  mf,
                     chemDiag = &( (*auxDiag["REACTIONS"])[Smfi] );
                 }
 
-                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,chemDiag);
+                if (do_paths)
+                {
+                    pathDiag.resize(bx,rxn_paths_R.size());
+                    pathDiag.setVal(0);
+                }
+
+                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,
+                                                        do_paths ? &pathDiag : chemDiag,
+                                                        true, chemDiag != 0);
 
 		if (!ok) {
 		  BoxLib::Abort("ChemDriver::solveTransient failed");
 		}
 
+                if (do_paths)
+                {
+                    if (chemDiag)
+                        chemDiag->plus(pathDiag,bx,0,0,pathDiag.nComp());
+
+                    rxn_paths_accum(pathDiag,fb,bx,Tcomp,covered);
+                }
             }
             //
             // When ngrow>0 this does NOT properly update FuncCount_Type since parallel
@@ -4877,12 +4940,27 @@ HeatTransfer::strang_chem (MultiFab&  mf,
                 FArrayBox& fc = fcnCntTemp[Smfi];
                 chemDiag = (do_diag ? &(diagTemp[Smfi]) : 0);
 
-                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,chemDiag);
+                if (do_paths)
+                {
+                    pathDiag.resize(bx,rxn_paths_R.size());
+                    pathDiag.setVal(0);
+                }
+
+                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,
+                                                        do_paths ? &pathDiag : chemDiag,
+                                                        true, chemDiag != 0);
 
 		if (!ok) {
 		  BoxLib::Abort("ChemDriver::solveTransient failed");
 		}
 
+                if (do_paths)
+                {
+                    if (chemDiag)
+                        chemDiag->plus(pathDiag,bx,0,0,pathDiag.nComp());
+
+                    rxn_paths_accum(pathDiag,fb,bx,Tcomp,covered);
+                }
             }
 
             mf.copy(tmp); // Parallel copy.
@@ -4944,6 +5022,58 @@ HeatTransfer::strang_chem (MultiFab&  mf,
     }
 }
 
+void
+HeatTransfer::edge_state_setup (int              i,
+                                Real             dt,
+                                const FArrayBox& URho,
+                                const MultiFab*  vel_visc_terms,
+                                const MultiFab&  Gp,
+                                FArrayBox&       U,
+                                FArrayBox&       Rho,
+                                FArrayBox&       tvelforces,
+                                FArrayBox        edge[BL_SPACEDIM])
+{
+    //
+    // Per-grid part of the edge state predictor that every component group
+    // needs: U, Rho, the transverse velocity forcing and the godunov workspace.
+    //
+    const Real prev_time = state[State_Type].prevTime();
+    const int  nGrowF    = 1;
+
+    Rho.resize(URho.box(),1);
+    U.resize(URho.box(),BL_SPACEDIM);
+
+    Rho.copy(URho,Density,0,1);
+    U.copy(URho,Xvel,0,BL_SPACEDIM);
+    //
+    // Get the spec forces based on CC data (forces on EC data in getViscTerms)
+    //
+    if (vel_visc_terms)
+    {
+        NavierStokesBase::getForce(tvelforces,i,nGrowF,Xvel,BL_SPACEDIM,
+#ifdef GENGETFORCE
+                                   prev_time,
+#endif		 
+                                   Rho);
+        godunov->Sum_tf_gp_visc(tvelforces,(*vel_visc_terms)[i],Gp[i],Rho);
+    }
+    //
+    // Set up the workspace for the godunov Box (also resize "edge" for later)
+    //
+    Array<int> u_bc[BL_SPACEDIM];
+    D_TERM(u_bc[0] = getBCArray(State_Type,i,0,1);,
+           u_bc[1] = getBCArray(State_Type,i,1,1);,
+           u_bc[2] = getBCArray(State_Type,i,2,1);)
+
+    godunov->Setup(grids[i], geom.CellSize(), dt, 0,
+                   edge[0], u_bc[0].dataPtr(),
+                   edge[1], u_bc[1].dataPtr(),
+#if (BL_SPACEDIM == 3)
+                   edge[2], u_bc[2].dataPtr(),
+#endif
+                   U, Rho, tvelforces);
+}
+
 void
 HeatTransfer::compute_edge_states (Real              dt,
                                    std::vector<int>* state_comps_to_compute)
@@ -4956,6 +5086,15 @@ HeatTransfer::compute_edge_states (Real              dt,
     // NOTE: Ordering is important here, must do rho.Y and Temp BEFORE RhoH and
     //       Density, but then it doesn't matter.
     //
+    // To keep the peak memory down, the components are done a group at a
+    // time: velocity, then the species edge_state_ncomp at a time, then
+    // everything past the species.  Each group fills only its own components
+    // and holds only its own viscous terms, except that for Le != 1 the
+    // species viscous terms come as one block.  Velocity and density are
+    // filled once, and the velocity viscous terms, which enter the
+    // transverse forcing of every group, are kept throughout.
+    // edge_state_ncomp <= 0 does all the species together.
+    //
     if (verbose && ParallelDescriptor::IOProcessor())
         std::cout << "... computing edge states\n";
     //
@@ -4964,12 +5103,8 @@ HeatTransfer::compute_edge_states (Real              dt,
     const Real* dx             = geom.CellSize();
     const Real  prev_time      = state[State_Type].prevTime();
     const Real  prev_pres_time = state[Press_Type].prevTime();
-    //
-    // NOTE: Massive memory bloat here...how many MultiFab can we waste??
-    // Get viscous forcing on the ones we need, don't bother allocating others
-    //
-    const int nState = desc_lst[State_Type].nComp();
-    PArray<MultiFab> visc_terms(nState,PArrayManage);
+    const int   nState         = desc_lst[State_Type].nComp();
+    const int   nGrowS         = Godunov::hypgrow();
 
     const int use_forces_in_trans = godunov->useForcesInTrans();
     //
@@ -5028,99 +5163,44 @@ HeatTransfer::compute_edge_states (Real              dt,
 
     create_mac_rhs(divu_fp,nGrowF,prev_time,dt);
 
-    MultiFab Gp;
+    MultiFab  Gp;
+    MultiFab* vel_visc_terms = 0;
 
     if (use_forces_in_trans || (do_mom_diff == 1))
     {
-        visc_terms.set(Xvel, new MultiFab(grids,BL_SPACEDIM,nGrowF));
-        getViscTerms(visc_terms[Xvel],Xvel,BL_SPACEDIM,prev_time);
+        vel_visc_terms = new MultiFab(grids,BL_SPACEDIM,nGrowF);
+        getViscTerms(*vel_visc_terms,Xvel,BL_SPACEDIM,prev_time);
 
         Gp.define(grids,BL_SPACEDIM,1,Fab_allocate);
         getGradP(Gp, prev_pres_time);
     }
-
-    if (compute_comp[first_spec])
-    {
-	visc_terms.set(first_spec, new MultiFab(grids,nspecies,nGrowF));
-	getViscTerms(visc_terms[first_spec],first_spec,nspecies,prev_time);
-    }
     //
-    // Get all the normal visc terms for everything but velocity
+    // FillPatch'd velocity and density, used by every group.
     //
-    for (int sigma=BL_SPACEDIM; sigma<nState; ++sigma)
-    {
-        if (do_predict[sigma] && compute_comp[sigma])
-        {
-            BL_ASSERT( sigma < first_spec || sigma > last_spec );
-            visc_terms.set(sigma, new MultiFab(grids,1,nGrowF));
-            if (be_cn_theta == 1.0)
-            {
-                visc_terms[sigma].setVal(0.0,0,1,nGrowF);
-            }
-            else
-            {
-                getViscTerms(visc_terms[sigma],sigma,1,prev_time);
-            }
-        }
-    }
+    BL_ASSERT(Density == Xvel+BL_SPACEDIM);
+
+    FillPatchIterator URho_fpi(*this,divu_fp,nGrowS,prev_time,State_Type,Xvel,BL_SPACEDIM+1);
+    const MultiFab& URho = URho_fpi.get_mf();
     //
-    // Loop on grids, and compute edge fluxes
+    // Work space, reused by all grids and groups.
     //
-    FArrayBox edge[BL_SPACEDIM],Rho,U,state,tforces,tvelforces,vel,h,spec;
+    FArrayBox edge[BL_SPACEDIM],Rho,U,state,tforces,tvelforces,vel,h,spec,junkDivu;
+
+    const int velpred = 0; // Already have edge velocities for transverse derivative
     //
-    // FillPatch'd state data.
+    // Velocity.
     //
-    for (FillPatchIterator S_fpi(*this,divu_fp,Godunov::hypgrow(),prev_time,State_Type,0,nState);
-         S_fpi.isValid();
-         ++S_fpi)
+    if (do_mom_diff == 1)
     {
-        //
-        // Gonna need this array on a per-grid basis
-        //
-        std::vector<int> this_edge_state_computed(nState,false);
-
-        const int i = S_fpi.index();
-
-        Rho.resize(S_fpi().box(),1);
-        U.resize(S_fpi().box(),BL_SPACEDIM);
-
-        Rho.copy(S_fpi(),Density,0,1);
-        U.copy(S_fpi(),Xvel,0,BL_SPACEDIM);
-        //
-        // Get the spec forces based on CC data (forces on EC data in getViscTerms)
-        //
-        if (use_forces_in_trans || (do_mom_diff == 1))
+        for (MFIter mfi(URho); mfi.isValid(); ++mfi)
         {
-            NavierStokesBase::getForce(tvelforces,i,nGrowF,Xvel,BL_SPACEDIM,
-#ifdef GENGETFORCE
-				       prev_time,
-#endif		 
-				       Rho);
-            godunov->Sum_tf_gp_visc(tvelforces,visc_terms[Xvel][S_fpi],Gp[S_fpi],Rho);
-        }
-        //
-        // Set up the workspace for the godunov Box (also resize "edge" for later)
-        //
-        Array<int> u_bc[BL_SPACEDIM];
-        D_TERM(u_bc[0] = getBCArray(State_Type,i,0,1);,
-               u_bc[1] = getBCArray(State_Type,i,1,1);,
-               u_bc[2] = getBCArray(State_Type,i,2,1);)
-
-        godunov->Setup(grids[i], dx, dt, 0,
-                       edge[0], u_bc[0].dataPtr(),
-                       edge[1], u_bc[1].dataPtr(),
-#if (BL_SPACEDIM == 3)
-                       edge[2], u_bc[2].dataPtr(),
-#endif
-                       U, Rho, tvelforces);
+            const int i = mfi.index();
 
-        const int velpred = 0; // Already have edge velocities for transverse derivative
+            edge_state_setup(i,dt,URho[mfi],vel_visc_terms,Gp,U,Rho,tvelforces,edge);
 
-        if (do_mom_diff == 1) 
-        {
-            vel.resize(S_fpi().box(),BL_SPACEDIM);
+            vel.resize(URho[mfi].box(),BL_SPACEDIM);
 
-            vel.copy(S_fpi(),0,0,BL_SPACEDIM);
+            vel.copy(URho[mfi],Xvel,0,BL_SPACEDIM);
             //
             // Loop over the velocity components.
             //
@@ -5128,7 +5208,7 @@ HeatTransfer::compute_edge_states (Real              dt,
             {
                 if (predict_mom_together == 1) 
                 {
-                    vel.mult(Rho,S_fpi().box(),S_fpi().box(),0,comp,1);
+                    vel.mult(Rho,vel.box(),vel.box(),0,comp,1);
                     tvelforces.mult(Rho,tvelforces.box(),tvelforces.box(),0,comp,1);
                 }
                 Array<int> bc = getBCArray(State_Type,i,comp,1);
@@ -5137,113 +5217,159 @@ HeatTransfer::compute_edge_states (Real              dt,
                 FArrayBox divu_dummy;
 
                 godunov->edge_states(grids[i], dx, dt, velpred,
-                                     u_mac[0][S_fpi], edge[0],
-                                     u_mac[1][S_fpi], edge[1],
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM == 3)             
-                                     u_mac[2][S_fpi], edge[2],
+                                     u_mac[2][mfi], edge[2],
 #endif
                                      U,vel,tvelforces,divu_dummy,
                                      comp,comp,bc.dataPtr(),
                                      iconserv_dummy,PRE_MAC);
 
                 for (int d=0; d<BL_SPACEDIM; ++d)
-                    (*EdgeState[d])[S_fpi].copy(edge[d],0,comp,1);
-
-                this_edge_state_computed[comp] = true;
+                    (*EdgeState[d])[mfi].copy(edge[d],0,comp,1);
             }
         }
-        //
-        // Get spec edge states.
-        // FIXME: Fab copy reqd, force sum below pulls state and forces from same comp
-        //
-        if (compute_comp[first_spec])
+    }
+    //
+    // Get spec edge states, a chunk of species at a time.  With unity_Le the
+    // viscous terms are computed per chunk too.  For Le != 1 the species
+    // fluxes are corrected together, so getViscTerms needs them all at once
+    // and spec_visc_all holds the block for the whole loop.
+    // FIXME: Fab copy reqd, force sum below pulls state and forces from same comp
+    //
+    if (compute_comp[first_spec])
+    {
+        const int nchunk = (edge_state_ncomp > 0) ? std::min(edge_state_ncomp,nspecies) : nspecies;
+
+        MultiFab* spec_visc_all = 0;
+        if (!unity_Le)
         {
-            spec.resize(S_fpi().box(),nspecies);
-            spec.copy(S_fpi(),first_spec,0,nspecies);
+            spec_visc_all = new MultiFab(grids,nspecies,nGrowF);
+            getViscTerms(*spec_visc_all,first_spec,nspecies,prev_time);
+        }
 
-            NavierStokesBase::getForce(tforces,i,nGrowF,first_spec,nspecies,
-#ifdef GENGETFORCE
-				       prev_time,
-#endif		 
-				       Rho);
+        for (int c0 = 0; c0 < nspecies; c0 += nchunk)
+        {
+            const int nc = std::min(nchunk,nspecies-c0);
 
-            for (int comp = 0 ; comp < nspecies ; comp++)
+            MultiFab  spec_visc_chunk;
+            MultiFab* spec_visc = spec_visc_all;
+            int       vcomp0    = c0;
+            if (spec_visc_all == 0)
             {
-                int state_ind = first_spec + comp;
-                int use_conserv_diff = 
-                      (advectionType[state_ind] == Conservative) ? true : false;
-                Array<int> bc = getBCArray(State_Type,i,state_ind,1);
+                spec_visc_chunk.define(grids,nc,nGrowF,Fab_allocate);
+                getViscTerms(spec_visc_chunk,first_spec+c0,nc,prev_time);
+                spec_visc = &spec_visc_chunk;
+                vcomp0    = 0;
+            }
+            MultiFab& spec_visc_terms = *spec_visc;
+
+            FillPatchIterator Y_fpi(*this,divu_fp,nGrowS,prev_time,State_Type,first_spec+c0,nc);
+            const MultiFab& Ymf = Y_fpi.get_mf();
+
+            for (MFIter mfi(Ymf); mfi.isValid(); ++mfi)
+            {
+                const int i = mfi.index();
+
+                edge_state_setup(i,dt,URho[mfi],vel_visc_terms,Gp,U,Rho,tvelforces,edge);
+
+                spec.resize(Ymf[mfi].box(),nc);
+                spec.copy(Ymf[mfi],0,0,nc);
+
+                NavierStokesBase::getForce(tforces,i,nGrowF,first_spec+c0,nc,
+#ifdef GENGETFORCE
+                                           prev_time,
+#endif		 
+                                           Rho);
 
-                AdvectionScheme adv_scheme = FPU;
-                if (adv_scheme == PRE_MAC)
+                for (int comp = 0 ; comp < nc ; comp++)
                 {
-                    godunov->Sum_tf_divu_visc(spec, tforces, comp, 1,
-                                              visc_terms[first_spec][S_fpi], comp,
-                                              divu_fp[S_fpi], Rho, use_conserv_diff);
+                    int state_ind = first_spec + c0 + comp;
+                    int use_conserv_diff = 
+                        (advectionType[state_ind] == Conservative) ? true : false;
+                    Array<int> bc = getBCArray(State_Type,i,state_ind,1);
+
+                    AdvectionScheme adv_scheme = FPU;
+                    if (adv_scheme == PRE_MAC)
+                    {
+                        godunov->Sum_tf_divu_visc(spec, tforces, comp, 1,
+                                                  spec_visc_terms[mfi], vcomp0+comp,
+                                                  divu_fp[mfi], Rho, use_conserv_diff);
                     
-                    int iconserv_dummy = 0;
-                    godunov->edge_states(grids[i], dx, dt, velpred,
-                                         u_mac[0][S_fpi], edge[0],
-                                         u_mac[1][S_fpi], edge[1],
+                        int iconserv_dummy = 0;
+                        godunov->edge_states(grids[i], dx, dt, velpred,
+                                             u_mac[0][mfi], edge[0],
+                                             u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM==3)
-                                         u_mac[2][S_fpi], edge[2],
+                                             u_mac[2][mfi], edge[2],
 #endif
-                                         U,spec,tforces,divu_fp[S_fpi],
-                                         comp,state_ind,bc.dataPtr(),
-                                         iconserv_dummy,PRE_MAC);
-                }
-                else
-                {
-                    FArrayBox junkDivu(tforces.box(),1);
-                    junkDivu.setVal(0.);
-                    godunov->Sum_tf_divu_visc(spec, tforces, comp, 1,
-                                              visc_terms[first_spec][S_fpi], comp,
-                                              junkDivu, Rho, use_conserv_diff);
+                                             U,spec,tforces,divu_fp[mfi],
+                                             comp,state_ind,bc.dataPtr(),
+                                             iconserv_dummy,PRE_MAC);
+                    }
+                    else
+                    {
+                        junkDivu.resize(tforces.box(),1);
+                        junkDivu.setVal(0.);
+                        godunov->Sum_tf_divu_visc(spec, tforces, comp, 1,
+                                                  spec_visc_terms[mfi], vcomp0+comp,
+                                                  junkDivu, Rho, use_conserv_diff);
                     
-                    godunov->edge_states(grids[i], dx, dt, velpred,
-                                         u_mac[0][S_fpi], edge[0],
-                                         u_mac[1][S_fpi], edge[1],
+                        godunov->edge_states(grids[i], dx, dt, velpred,
+                                             u_mac[0][mfi], edge[0],
+                                             u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM==3)
-                                         u_mac[2][S_fpi], edge[2],
+                                             u_mac[2][mfi], edge[2],
 #endif
-                                         U,spec,tforces,divu_fp[S_fpi],
-                                         comp,state_ind,bc.dataPtr(), 
-                                         use_conserv_diff,FPU);
-                }
-
-                for (int d=0; d<BL_SPACEDIM; ++d)
-                    (*EdgeState[d])[S_fpi].copy(edge[d],0,state_ind,1);
+                                             U,spec,tforces,divu_fp[mfi],
+                                             comp,state_ind,bc.dataPtr(), 
+                                             use_conserv_diff,FPU);
+                    }
 
-                this_edge_state_computed[state_ind] = true;
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        (*EdgeState[d])[mfi].copy(edge[d],0,state_ind,1);
+                }
             }
         }
-        //
-        // Get density edge states
-        //
-        if (compute_comp[Density])
+
+        delete spec_visc_all;
+    }
+    //
+    // Everything past the species: Temp and the normally predicted ones,
+    // then Density and RhoH from the species and Temp edge states.
+    //
+    const int sCompR = last_spec+1;
+    const int nCompR = nState-sCompR;
+
+    BL_ASSERT(Temp >= sCompR);
+
+    PArray<MultiFab> visc_terms(nState,PArrayManage);
+
+    for (int sigma=sCompR; sigma<nState; ++sigma)
+    {
+        if (do_predict[sigma] && compute_comp[sigma])
         {
-            if (do_set_rho_to_species_sum)
+            visc_terms.set(sigma, new MultiFab(grids,1,nGrowF));
+            if (be_cn_theta == 1.0)
             {
-                for (int d=0; d<BL_SPACEDIM; ++d)
-                {
-                    (*EdgeState[d])[S_fpi].setVal(0.0,edge[d].box(),Density,1);
-                    for (int sigma=first_spec; sigma<=last_spec; ++sigma)
-                        (*EdgeState[d])[S_fpi].plus((*EdgeState[d])[S_fpi],
-                                                edge[d].box(), sigma,Density,1);
-                }
-                this_edge_state_computed[Density] = true;
+                visc_terms[sigma].setVal(0.0,0,1,nGrowF);
             }
             else
             {
-                BoxLib::Error("No code yet for rho != sum(rho.Y)");
+                getViscTerms(visc_terms[sigma],sigma,1,prev_time);
             }
-
-            if (do_mom_diff == 1 && predict_mom_together == 0)
-               for (int icomp = 0; icomp < BL_SPACEDIM; icomp++)
-                  for (int d=0; d<BL_SPACEDIM; ++d)
-                    (*EdgeState[d])[S_fpi].mult((*EdgeState[d])[S_fpi],(*EdgeState[d])[S_fpi].box(),
-                                            (*EdgeState[d])[S_fpi].box(),Density,icomp,1);
         }
+    }
+
+    FillPatchIterator R_fpi(*this,divu_fp,nGrowS,prev_time,State_Type,sCompR,nCompR);
+    const MultiFab& Rmf = R_fpi.get_mf();
+
+    for (MFIter mfi(Rmf); mfi.isValid(); ++mfi)
+    {
+        const int i = mfi.index();
+
+        edge_state_setup(i,dt,URho[mfi],vel_visc_terms,Gp,U,Rho,tvelforces,edge);
 
         if (compute_comp[Temp])
         {
@@ -5253,9 +5379,9 @@ HeatTransfer::compute_edge_states (Real              dt,
             const int comp = 0;
             const int state_ind = Temp;
             int use_conserv_diff = (advectionType[state_ind] == Conservative) ? true : false;
-            state.resize(S_fpi().box(),1);
-            state.copy(S_fpi(),state_ind,0,1);
-            FArrayBox& vt = visc_terms[state_ind][S_fpi];
+            state.resize(Rmf[mfi].box(),1);
+            state.copy(Rmf[mfi],state_ind-sCompR,0,1);
+            FArrayBox& vt = visc_terms[state_ind][mfi];
             int vtComp = 0;
 
             NavierStokesBase::getForce(tforces,i,nGrowF,state_ind,1,
@@ -5271,43 +5397,67 @@ HeatTransfer::compute_edge_states (Real              dt,
             {
                 godunov->Sum_tf_divu_visc(state, tforces,  comp, 1,
                                           vt, vtComp,
-                                          divu_fp[S_fpi], Rho, use_conserv_diff);
+                                          divu_fp[mfi], Rho, use_conserv_diff);
 
                 int iconserv_dummy = 0;
                 godunov->edge_states(grids[i], dx, dt, velpred,
-                                     u_mac[0][S_fpi], edge[0],
-                                     u_mac[1][S_fpi], edge[1],
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM==3)
-                                     u_mac[2][S_fpi], edge[2],
+                                     u_mac[2][mfi], edge[2],
 #endif
-                                     U, state, tforces, divu_fp[S_fpi],
+                                     U, state, tforces, divu_fp[mfi],
                                      comp, state_ind, bc.dataPtr(),
                                      iconserv_dummy, PRE_MAC);
 
             }
             else
             {
-                FArrayBox junkDivu(tforces.box(),1);
+                junkDivu.resize(tforces.box(),1);
                 junkDivu.setVal(0);
                 godunov->Sum_tf_divu_visc(state, tforces,  comp, 1,
                                           vt, vtComp,
                                           junkDivu, Rho, use_conserv_diff);
 
                 godunov->edge_states(grids[i], dx, dt, velpred,
-                                     u_mac[0][S_fpi], edge[0],
-                                     u_mac[1][S_fpi], edge[1],
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM==3)
-                                     u_mac[2][S_fpi], edge[2],
+                                     u_mac[2][mfi], edge[2],
 #endif
-                                     U, state, tforces, divu_fp[S_fpi],
+                                     U, state, tforces, divu_fp[mfi],
                                      comp, state_ind, bc.dataPtr(), 
                                      use_conserv_diff, FPU);
             }
 
             for (int d=0; d<BL_SPACEDIM; ++d)
-                (*EdgeState[d])[S_fpi].copy(edge[d],0,state_ind,1);
+                (*EdgeState[d])[mfi].copy(edge[d],0,state_ind,1);
+        }
+        //
+        // Get density edge states
+        //
+        if (compute_comp[Density])
+        {
+            if (do_set_rho_to_species_sum)
+            {
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                {
+                    (*EdgeState[d])[mfi].setVal(0.0,edge[d].box(),Density,1);
+                    for (int sigma=first_spec; sigma<=last_spec; ++sigma)
+                        (*EdgeState[d])[mfi].plus((*EdgeState[d])[mfi],
+                                                  edge[d].box(), sigma,Density,1);
+                }
+            }
+            else
+            {
+                BoxLib::Error("No code yet for rho != sum(rho.Y)");
+            }
 
-            this_edge_state_computed[state_ind] = true;
+            if (do_mom_diff == 1 && predict_mom_together == 0)
+               for (int icomp = 0; icomp < BL_SPACEDIM; icomp++)
+                  for (int d=0; d<BL_SPACEDIM; ++d)
+                    (*EdgeState[d])[mfi].mult((*EdgeState[d])[mfi],(*EdgeState[d])[mfi].box(),
+                                              (*EdgeState[d])[mfi].box(),Density,icomp,1);
         }
 
         if (compute_comp[RhoH])
@@ -5317,36 +5467,33 @@ HeatTransfer::compute_edge_states (Real              dt,
             //
             for (int d=0; d<BL_SPACEDIM; ++d)
             {
-                (*EdgeState[d])[S_fpi].setVal(0.0,edge[d].box(),RhoH,1);
+                (*EdgeState[d])[mfi].setVal(0.0,edge[d].box(),RhoH,1);
                 h.resize(edge[d].box(),nspecies);
-                getChemSolve().getHGivenT(h,(*EdgeState[d])[S_fpi],
+                getChemSolve().getHGivenT(h,(*EdgeState[d])[mfi],
                                           edge[d].box(),Temp,0);
-                h.mult((*EdgeState[d])[S_fpi],edge[d].box(),first_spec,0,
+                h.mult((*EdgeState[d])[mfi],edge[d].box(),first_spec,0,
                        nspecies);
                 
-                (*EdgeState[d])[S_fpi].setVal(0.0,edge[d].box(),RhoH,1);
+                (*EdgeState[d])[mfi].setVal(0.0,edge[d].box(),RhoH,1);
                 for (int comp=0; comp<nspecies; ++comp)
-                    (*EdgeState[d])[S_fpi].plus(h,edge[d].box(),comp,RhoH,1);
+                    (*EdgeState[d])[mfi].plus(h,edge[d].box(),comp,RhoH,1);
             }
-            this_edge_state_computed[RhoH] = true;
         }
         //
         // Now do the rest as normal
         //
-        state.resize(S_fpi().box(),1);
+        state.resize(Rmf[mfi].box(),1);
 
-        for (int state_ind=0; state_ind<nState; ++state_ind)
+        for (int state_ind=sCompR; state_ind<nState; ++state_ind)
         {
-            if (do_predict[state_ind]                &&
-                !this_edge_state_computed[state_ind] &&
-                compute_comp[state_ind])
+            if (do_predict[state_ind] && state_ind != Temp && compute_comp[state_ind])
             {
                 int use_conserv_diff =
                     (advectionType[state_ind] == Conservative) ? true : false;
                 //
                 // Do it the old-fashioned way.
                 //
-                state.copy(S_fpi(),state_ind,0,1);
+                state.copy(Rmf[mfi],state_ind-sCompR,0,1);
                 const int comp = 0;
                 NavierStokesBase::getForce(tforces,i,nGrowF,state_ind,1,
 #ifdef GENGETFORCE
@@ -5354,28 +5501,28 @@ HeatTransfer::compute_edge_states (Real              dt,
 #endif		 
 					   Rho);
                 godunov->Sum_tf_divu_visc(state, tforces, comp, 1,
-                                          visc_terms[state_ind][S_fpi], 0,
-                                          divu_fp[S_fpi], Rho,
+                                          visc_terms[state_ind][mfi], 0,
+                                          divu_fp[mfi], Rho,
                                           use_conserv_diff);
                 Array<int> bc = getBCArray(State_Type,i,state_ind,1);
                 int iconserv_dummy = 0;
                 godunov->edge_states(grids[i], dx, dt, velpred,
-                                     u_mac[0][S_fpi], edge[0],
-                                     u_mac[1][S_fpi], edge[1],
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
 #if (BL_SPACEDIM==3)
-                                     u_mac[2][S_fpi], edge[2],
+                                     u_mac[2][mfi], edge[2],
 #endif
-                                     U,state,tforces,divu_fp[S_fpi],
+                                     U,state,tforces,divu_fp[mfi],
                                      comp,state_ind,bc.dataPtr(),
                                      iconserv_dummy,PRE_MAC);
 
                 for (int d=0; d<BL_SPACEDIM; ++d)
-                    (*EdgeState[d])[S_fpi].copy(edge[d],0,state_ind,1);
-
-                this_edge_state_computed[state_ind] = true;
+                    (*EdgeState[d])[mfi].copy(edge[d],0,state_ind,1);
             }
         }
     }
+
+    delete vel_visc_terms;
 }
 
 void
@@ -6825,6 +6972,8 @@ HeatTransfer::calcDiffusivity (const Real time,
     const int  last_comp      = offset + num_comp - 1;
     const bool has_spec       = offset < last_spec && last_comp > first_spec;
     const int  non_spec_comps = std::max(0,first_spec-offset) + std::max(0,last_comp-last_spec);
+    const int  iskip          = nspecies+1; // Components of the lag data
+    const int  ivisc          = nspecies+2;
     MultiFab&  visc           = (whichTime == AmrOldTime) ? (*diffn_cc) : (*diffnp1_cc);
     MultiFab&  beta           = (whichTime == AmrOldTime) ? (*viscn_cc) : (*viscnp1_cc);
 
@@ -6834,11 +6983,13 @@ HeatTransfer::calcDiffusivity (const Real time,
 
     MultiFab& S_new = get_new_data(State_Type);
 
-    FArrayBox bcen, temp, rhospec, cpmix;
+    FArrayBox bcen, temp, rhospec, cpmix, work;
 
     Real p_amb;
     FORT_GETPAMB(&p_amb);
 
+    MultiFab* lag = (diffusivity_lag_tol > 0) ? diffusivity_lag(whichTime,p_amb) : 0;
+
     for (FillPatchIterator Rho_and_spec_fpi(*this,S_new,nGrow,time,State_Type,Density,nspecies+1),
              Temp_fpi(*this,S_new,nGrow,time,State_Type,Temp,1);
          Rho_and_spec_fpi.isValid() && Temp_fpi.isValid();
@@ -6862,46 +7013,148 @@ HeatTransfer::calcDiffusivity (const Real time,
         rhospec.copy(Rho_and_spec_fpi(),0,0,nspecies+1);
 
         temp.copy(Temp_fpi(),0,0,1);
-
-        FORT_SPECTEMPVISC(gbx.loVect(),gbx.hiVect(),
-                          ARLIM(temp.loVect()),ARLIM(temp.hiVect()),
-                          temp.dataPtr(),
-                          ARLIM(rhospec.loVect()),ARLIM(rhospec.hiVect()),
-                          rhospec.dataPtr(1),
-                          ARLIM(bcen.loVect()),ARLIM(bcen.hiVect()),bcen.dataPtr(),
-                          &nc_bcen, &P1atm_MKS, &dotemp, &vflag, &p_amb);
-
-        visc[Rho_and_spec_fpi].copy(bcen,0,first_spec-offset,nspecies);
-        visc[Rho_and_spec_fpi].copy(bcen,nspecies,Temp-offset,1);
-
-        if (do_VelVisc)
-            beta[Rho_and_spec_fpi].copy(bcen,nspecies+1,0,1);
         //
-        // Now get the rest.
+        // With lagging on, the coefficients are evaluated tile by tile, and
+        // only where T or Y have moved since they were last computed.
         //
-        for (int icomp = offset; icomp <= last_comp; icomp++)
+        BoxArray tiles(gbx);
+        if (lag)
+            tiles.maxSize(diffusivity_lag_tile);
+
+        for (int t = 0; t < tiles.size(); t++)
         {
-            const bool is_spec = icomp >= first_spec && icomp <= last_spec;
+            const Box& tbx = tiles[t];
 
-            if (!is_spec)
+            if (lag)
             {
-                if (icomp == RhoH)
+                FArrayBox& lfab  = (*lag)[Rho_and_spec_fpi];
+                const Real nskip = lfab(tbx.smallEnd(),iskip);
+
+                if (nskip >= 0                                              &&
+                    (diffusivity_lag_max <= 0 || nskip < diffusivity_lag_max) &&
+                    (!do_VelVisc || lfab(tbx.smallEnd(),ivisc) > 0)          &&
+                    diffusivity_lag_change(lfab,temp,rhospec,tbx,work) <= diffusivity_lag_tol)
                 {
-                    visc[Rho_and_spec_fpi].copy(visc[Rho_and_spec_fpi],Temp-offset,RhoH-offset,1);
-                    cpmix.resize(gbx,1);
-                    const int sCompT = 0, sCompY = 1, sCompCp = 0;
-                    getChemSolve().getCpmixGivenTY(cpmix,temp,rhospec,gbx,sCompT,sCompY,sCompCp);
-                    visc[Rho_and_spec_fpi].divide(cpmix,0,RhoH-offset,1);
+                    lfab.plus(1,tbx,iskip,1);
+                    diff_lag_nreuse++;
+                    continue;
                 }
-                else if (icomp == Trac || icomp == RhoRT)
+
+                lfab.copy(temp,tbx,0,tbx,0,1);
+                lfab.copy(rhospec,tbx,1,tbx,1,nspecies);
+                lfab.setVal(0,tbx,iskip,1);
+                lfab.setVal(vflag,tbx,ivisc,1);
+            }
+            diff_lag_nrefresh++;
+
+            FORT_SPECTEMPVISC(tbx.loVect(),tbx.hiVect(),
+                              ARLIM(temp.loVect()),ARLIM(temp.hiVect()),
+                              temp.dataPtr(),
+                              ARLIM(rhospec.loVect()),ARLIM(rhospec.hiVect()),
+                              rhospec.dataPtr(1),
+                              ARLIM(bcen.loVect()),ARLIM(bcen.hiVect()),bcen.dataPtr(),
+                              &nc_bcen, &P1atm_MKS, &dotemp, &vflag, &p_amb);
+
+            visc[Rho_and_spec_fpi].copy(bcen,tbx,0,tbx,first_spec-offset,nspecies);
+            visc[Rho_and_spec_fpi].copy(bcen,tbx,nspecies,tbx,Temp-offset,1);
+
+            if (do_VelVisc)
+                beta[Rho_and_spec_fpi].copy(bcen,tbx,nspecies+1,tbx,0,1);
+            //
+            // Now get the rest.
+            //
+            for (int icomp = offset; icomp <= last_comp; icomp++)
+            {
+                const bool is_spec = icomp >= first_spec && icomp <= last_spec;
+
+                if (!is_spec)
                 {
-                    visc.setVal(trac_diff_coef, icomp-offset, 1, nGrow);
+                    if (icomp == RhoH)
+                    {
+                        visc[Rho_and_spec_fpi].copy(visc[Rho_and_spec_fpi],tbx,Temp-offset,tbx,RhoH-offset,1);
+                        cpmix.resize(tbx,1);
+                        const int sCompT = 0, sCompY = 1, sCompCp = 0;
+                        getChemSolve().getCpmixGivenTY(cpmix,temp,rhospec,tbx,sCompT,sCompY,sCompCp);
+                        visc[Rho_and_spec_fpi].divide(cpmix,tbx,0,RhoH-offset,1);
+                    }
+                    else if (icomp == Trac || icomp == RhoRT)
+                    {
+                        visc[Rho_and_spec_fpi].setVal(trac_diff_coef,tbx,icomp-offset,1);
+                    }
                 }
             }
         }
     }
 }
 
+MultiFab*
+HeatTransfer::diffusivity_lag (TimeLevel whichTime,
+                               Real      p_amb)
+{
+    //
+    // The lag data follows the coefficient MultiFab it describes, so that it
+    // survives the old and new coefficients being swapped.  It is thrown
+    // away when it can no longer describe them: new grids, a coefficient
+    // MultiFab we have not seen, or a change in the ambient pressure.
+    //
+    const MultiFab* coef  = (whichTime == AmrOldTime) ? diffn_cc : diffnp1_cc;
+    const MultiFab* other = (whichTime == AmrOldTime) ? diffnp1_cc : diffn_cc;
+
+    int w;
+    if      (diff_lag_coef[0] == coef)  w = 0;
+    else if (diff_lag_coef[1] == coef)  w = 1;
+    else if (diff_lag_coef[0] == other) w = 1;
+    else                                w = 0;
+
+    if (diff_lag[w] == 0 || diff_lag[w]->boxArray() != grids)
+    {
+        delete diff_lag[w];
+        diff_lag[w] = new MultiFab(grids,nspecies+3,1);
+        diff_lag_coef[w] = 0;
+    }
+
+    if (diff_lag_coef[w] != coef ||
+        std::abs(p_amb-diff_lag_pamb[w]) > diffusivity_lag_tol*std::abs(p_amb))
+    {
+        diff_lag[w]->setVal(-1,nspecies+1,1,1);
+        diff_lag_coef[w] = coef;
+        diff_lag_pamb[w] = p_amb;
+    }
+
+    return diff_lag[w];
+}
+
+Real
+HeatTransfer::diffusivity_lag_change (const FArrayBox& lag,
+                                      const FArrayBox& temp,
+                                      const FArrayBox& spec,
+                                      const Box&       box,
+                                      FArrayBox&       work) const
+{
+    //
+    // Max over box of the relative change in T and the absolute change in Y
+    // since lag was saved.  Y is in components 1..nspecies of spec.
+    //
+    work.resize(box,1);
+
+    work.copy(temp,box,0,box,0,1);
+    work.minus(lag,box,box,0,0,1);
+    work.abs();
+    work.divide(lag,box,box,0,0,1);
+
+    Real dmax = work.max(box,0);
+
+    for (int n = 1; n <= nspecies; n++)
+    {
+        work.copy(spec,box,n,box,0,1);
+        work.minus(lag,box,box,n,0,1);
+        work.abs();
+        dmax = std::max(dmax,work.max(box,0));
+    }
+
+    return dmax;
+}
+
 void
 HeatTransfer::getViscosity (MultiFab*  beta[BL_SPACEDIM],
                             const Real time)
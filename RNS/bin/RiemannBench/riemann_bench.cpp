@@ -0,0 +1,84 @@
+//
+// Timings of the RNS Riemann solvers on random face states.
+//
+// Each solver is run over bench.npencils pencils of bench.nfaces faces,
+// bench.nrep times, with the null EOS.  JBB and HLLC are also timed with
+// their flux blended with HLL by bench.HLL_factor.  Every run is done with
+// bc_flag = 1 and with bc_flag = 0 (zero-velocity faces at both ends of
+// each pencil).
+//
+
+#include <iostream>
+#include <iomanip>
+
+#include <REAL.H>
+#include <BoxLib.H>
+#include <ParmParse.H>
+#include <ParallelDescriptor.H>
+
+#include "RiemannBench_F.H"
+
+int
+main (int argc, char* argv[])
+{
+    BoxLib::Initialize(argc,argv);
+
+    ParmParse pp("bench");
+
+    int  nfaces     = 128;
+    int  npencils   = 2048;
+    int  nrep       = 20;
+    Real HLL_factor = 0.1;
+
+    pp.query("nfaces",     nfaces);
+    pp.query("npencils",   npencils);
+    pp.query("nrep",       nrep);
+    pp.query("HLL_factor", HLL_factor);
+
+    BL_FORT_PROC_CALL(RIEMANN_BENCH_INIT,riemann_bench_init)
+        (BL_SPACEDIM, nfaces, npencils);
+
+    static const char* name[] = { "HLL", "JBB", "HLLC" };
+
+    const Real nface = Real(nfaces+1) * npencils * nrep;
+
+    std::cout << std::setprecision(6);
+
+    for (int solver = 0; solver < 3; solver++)
+    {
+        for (int blend = 0; blend < 2; blend++)
+        {
+            //
+            // HLL blended with itself is just HLL.
+            //
+            if (blend && (solver == 0 || HLL_factor <= 0))
+                continue;
+
+            const Real hf = blend ? HLL_factor : 0;
+
+            for (int bc = 1; bc >= 0; bc--)
+            {
+                Real checksum;
+
+                const Real strt = ParallelDescriptor::second();
+
+                BL_FORT_PROC_CALL(RIEMANN_BENCH_RUN,riemann_bench_run)
+                    (solver, hf, bc, nrep, checksum);
+
+                const Real run_time = ParallelDescriptor::second() - strt;
+
+                std::cout << std::setw(5) << name[solver]
+                          << "  HLL_factor = " << std::setw(4) << hf
+                          << "  bc_flag = "    << bc
+                          << "  time = "       << std::setw(12) << run_time
+                          << "  ns/face = "    << std::setw(12) << 1.e9*run_time/nface
+                          << "  checksum = "   << std::setprecision(15) << checksum
+                          << std::setprecision(6) << '\n';
+            }
+        }
+    }
+
+    BL_FORT_PROC_CALL(RIEMANN_BENCH_FINALIZE,riemann_bench_finalize)();
+
+    BoxLib::Finalize();
+}
@@ -0,0 +1,154 @@
+module riemann_bench_module
+
+  implicit none
+
+  integer, save :: nf, npen
+  double precision, allocatable, save :: UL(:,:,:), UR(:,:,:), flx(:,:)
+
+  ! scale of each flux component in the checksum
+  double precision, allocatable, save :: fscale(:)
+
+end module riemann_bench_module
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+! Set up the state layout for dm dimensions with the null EOS's two
+! species, and fill npencils pencils of nfaces faces with random left and
+! right states: density and pressure within a factor of three and velocities
+! up to the sound speed, so that all the wave patterns are hit.
+subroutine riemann_bench_init(dm, nfaces, npencils)
+
+  use meth_params_module
+  use eos_module, only : eos_init
+  use riemann_bench_module
+
+  implicit none
+
+  integer, intent(in) :: dm, nfaces, npencils
+
+  integer :: i, m, nseed
+  integer, allocatable :: seed(:)
+  double precision :: r(7), rho, p, v(3), c
+
+  double precision, parameter :: gamma = 1.4d0, rho0 = 1.2d-3, p0 = 1.d6
+
+  ndim = dm
+  NSPEC = 2
+  URHO = 1
+  UMX = 2
+  UMY = 0
+  UMZ = 0
+  if (dm .ge. 2) UMY = 3
+  if (dm .eq. 3) UMZ = 4
+  UEDEN = dm + 2
+  UTEMP = dm + 3
+  UFS   = dm + 4
+  NVAR  = UFS + NSPEC - 1
+
+  call eos_init(gamma_in=gamma)
+
+  nf = nfaces
+  npen = npencils
+
+  ! the same states on every run
+  call random_seed(size=nseed)
+  allocate(seed(nseed))
+  seed = 12345
+  call random_seed(put=seed)
+  deallocate(seed)
+
+  allocate(UL(nf+1,NVAR,npen))
+  allocate(UR(nf+1,NVAR,npen))
+  allocate(flx(nf+1,NVAR))
+  allocate(fscale(NVAR))
+
+  do m=1,npen
+     do i=1,nf+1
+        call state(UL(i,:,m))
+        call state(UR(i,:,m))
+     end do
+  end do
+
+  ! the largest state times the largest sound speed, so that every
+  ! component weighs about alike; UTEMP has no flux
+  c = sqrt(gamma*1.5d0*p0/(0.5d0*rho0))
+  do i=1,NVAR
+     fscale(i) = c * max(maxval(abs(UL(:,i,:))), maxval(abs(UR(:,i,:))), tiny(1.d0))
+  end do
+
+contains
+
+  subroutine state(U)
+    double precision, intent(out) :: U(NVAR)
+    call random_number(r)
+    rho = rho0*(0.5d0+r(1))
+    p   = p0  *(0.5d0+r(2))
+    c   = sqrt(gamma*p/rho)
+    v   = c*(r(3:5)-0.5d0)*2.d0
+    if (dm .lt. 3) v(3) = 0.d0
+    if (dm .lt. 2) v(2) = 0.d0
+    U(URHO) = rho
+    U(UMX) = rho*v(1)
+    if (dm .ge. 2) U(UMY) = rho*v(2)
+    if (dm .eq. 3) U(UMZ) = rho*v(3)
+    U(UEDEN) = p/(gamma-1.d0) + 0.5d0*rho*(v(1)**2+v(2)**2+v(3)**2)
+    U(UTEMP) = 300.d0
+    U(UFS  ) = rho*r(6)
+    U(UFS+1) = rho*(1.d0-r(6))
+  end subroutine state
+
+end subroutine riemann_bench_init
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+! Solve all the pencils nrep times, cycling the direction through 1..ndim,
+! with bc_flag = bc at both ends of every pencil (0 for the zero-velocity
+! boundary faces of JBB).  checksum is the sum of all the fluxes of the
+! last sweep, each component divided by its fscale, to compare runs.
+subroutine riemann_bench_run(solver, HLL_factor_in, bc, nrep, checksum)
+
+  use meth_params_module
+  use riemann_module, only : riemann
+  use riemann_bench_module
+
+  implicit none
+
+  integer, intent(in) :: solver, bc, nrep
+  double precision, intent(in) :: HLL_factor_in
+  double precision, intent(out) :: checksum
+
+  integer :: irep, m, n, dir, bc_flag(2)
+
+  riemann_solver = solver
+  HLL_factor = HLL_factor_in
+
+  bc_flag = bc
+  checksum = 0.d0
+
+  do irep=1,nrep
+     do m=1,npen
+        dir = mod(m-1,ndim) + 1
+        call riemann(1, nf, UL(:,:,m), UR(:,:,m), 1, nf+1, flx, 1, nf+1, dir, bc_flag)
+        if (irep .eq. nrep) then
+           do n=1,NVAR
+              checksum = checksum + sum(flx(:,n))/fscale(n)
+           end do
+        end if
+     end do
+  end do
+
+end subroutine riemann_bench_run
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+subroutine riemann_bench_finalize()
+  use riemann_bench_module
+  implicit none
+  deallocate(UL, UR, flx, fscale)
+end subroutine riemann_bench_finalize
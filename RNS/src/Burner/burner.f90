@@ -2,6 +2,7 @@ module burner_module
 
   use chemistry_module, only : nspecies, spec_names, molecular_weight, inv_mwt
   use meth_params_module, only : use_vode
+  use chem_capture_module, only : capture_on, cap_conv, chem_capture_cell, chem_capture_flush
 
   implicit none
 
@@ -12,7 +13,7 @@ module burner_module
 
   private
 
-  public :: burn, compute_rhodYdt, splitburn, beburn
+  public :: burn, compute_rhodYdt, splitburn, beburn, burn_box_done
 
 contains
 
@@ -48,7 +49,7 @@ contains
     integer, parameter :: itask=1, iopt=1
     integer :: MF, istate, ifail
 
-    double precision :: time
+    double precision :: time, YT0(nspecies+1)
     integer :: g
 
     if (force_new_J) then
@@ -64,6 +65,8 @@ contains
 
        if (always_new_j) call setfirst(.true.)
 
+       if (capture_on) YT0 = YT(:,g)
+
        MF = vode_MF  ! vode might change its sign!
        call dvode(f_rhs, nspecies+1, YT(:,g), time, dt, itol, rtol, atol, itask, &
             istate, iopt, voderwork, lvoderwork, vodeiwork, lvodeiwork, &
@@ -71,6 +74,11 @@ contains
 
        nstep = vodeiwork(11)
 
+       if (capture_on) then
+          call chem_capture_cell(cap_conv, min(istate,0), dt, dble(vodeiwork(12)), &
+               YT0(nspecies+1), rho(g), YT0)
+       end if
+
        if (verbose .ge. 1) then
           write(6,*) '......dvode done:'
           write(6,*) ' last successful step size = ',voderwork(11)
@@ -116,7 +124,7 @@ contains
     use bdf
     use bdf_data, only : ts, reuse_jac
     use passinfo_module, only : time
-    use feval, only : f_rhs, f_jac, rho
+    use cv_feval, only : f_rhs, f_jac, rho
     integer, intent(in) :: np
     double precision, intent(in   ) :: rho_in(np), dt
     double precision, intent(inout) :: YT(nspecies+1,np)
@@ -124,7 +132,8 @@ contains
     integer, intent(out), optional :: ierr
 
     double precision :: t0, t1, y1(nspecies+1,np)
-    integer :: neq, np_bdf, i, p, ierr_bdf
+    double precision :: y0b(nspecies+1,ts%npt), y1b(nspecies+1,ts%npt)
+    integer :: neq, np_bdf, nb, i, p, ierr_bdf
     logical :: reset, reuse_J
 
     neq = nspecies+1
@@ -134,59 +143,75 @@ contains
 
     reset = .true.
 
-    if (mod(np,np_bdf) .ne. 0) then
-
-       print *, "ERROR: Either np or np_bdf has wrong value", np, np_bdf
-       call bl_error("ERROR: either np ot np_bdf has wrong value")
-
+    if (force_new_J) then
+       reuse_J = .false.
     else
+       reuse_J = reuse_jac
+    end if
 
-       if (force_new_J) then
-          reuse_J = .false.
-       else
-          reuse_J = reuse_jac
-       end if
+    ! Points go through BDF np_bdf at a time.  A short last batch is padded
+    ! with copies of its last point.
+    do i = 1, np, np_bdf
 
-       do i = 1, np, np_bdf
+       nb = min(np_bdf, np-i+1)
 
-          rho(1:np_bdf) = rho_in(i:i+np_bdf-1)
+       rho(1:nb) = rho_in(i:i+nb-1)
+       y0b(:,1:nb) = YT(:,i:i+nb-1)
+       do p = nb+1, np_bdf
+          rho(p) = rho(nb)
+          y0b(:,p) = y0b(:,nb)
+       end do
 
-          call bdf_advance(ts, f_rhs, f_jac, neq, np_bdf, YT(:,i:i+np_bdf-1), t0,  &
-               y1(:,i:i+np_bdf-1), t1, dt, reset, reuse_J, ierr_bdf)
+       call bdf_advance(ts, f_rhs, f_jac, neq, np_bdf, y0b, t0,  &
+            y1b, t1, dt, reset, reuse_J, ierr_bdf)
 
-          nstep = ts%n - 1
+       nstep = ts%n - 1
 
-          reuse_J = reuse_jac
+       reuse_J = reuse_jac
 
-          if (ierr_bdf .ne. 0) then
-             print *, 'chemsolv: BDF failed:', errors(ierr_bdf)
-             print *, 'BDF rtol:', minval(ts%rtol), maxval(ts%rtol)
-             print *, 'BDF atol:', minval(ts%atol), maxval(ts%atol)
-             print *, 'BDF y:'
-             do p = 1, ts%npt
-                print *, p, ts%y(:,p)
-             end do
-             print *, 'BDF y0:'
-             print *, YT(:,i:i+np_bdf-1)
-             if (present(ierr)) then
-                ierr = 1
-                return
-             else
-                call bl_error("ERROR in burn: BDF failed")
-             end if
+       if (capture_on) then
+          do p = 1, nb
+             call chem_capture_cell(cap_conv, ierr_bdf, dt, dble(ts%nfe), &
+                  y0b(nspecies+1,p), rho(p), y0b(:,p))
+          end do
+       end if
+
+       if (ierr_bdf .ne. 0) then
+          print *, 'chemsolv: BDF failed:', errors(ierr_bdf)
+          print *, 'BDF rtol:', minval(ts%rtol), maxval(ts%rtol)
+          print *, 'BDF atol:', minval(ts%atol), maxval(ts%atol)
+          print *, 'BDF y:'
+          do p = 1, ts%npt
+             print *, p, ts%y(:,p)
+          end do
+          print *, 'BDF y0:'
+          print *, y0b(:,1:nb)
+          if (present(ierr)) then
+             ierr = 1
+             return
+          else
+             call bl_error("ERROR in burn: BDF failed")
           end if
+       end if
 
-       end do
+       y1(:,i:i+nb-1) = y1b(:,1:nb)
 
-    end if
+    end do
 
     YT = y1
-    
+
     if (present(ierr)) ierr = 0
 
   end subroutine burn_bdf
 
 
+  ! Called after the burns of a box: its most expensive cells go to the
+  ! capture corpus, if there is one.
+  subroutine burn_box_done()
+    call chem_capture_flush()
+  end subroutine burn_box_done
+
+
   subroutine compute_rhodYdt(np, rho, T, Y, rdYdt)
     integer, intent(in) :: np
     double precision, intent(in) :: rho(np), T(np), Y(np,nspecies)
@@ -4,7 +4,7 @@ module burner_module
 
   private
 
-  public :: burn, compute_rhodYdt, splitburn, beburn
+  public :: burn, compute_rhodYdt, splitburn, beburn, burn_box_done
 
 contains
 
@@ -19,6 +19,11 @@ contains
   end subroutine burn
 
 
+  subroutine burn_box_done()
+    return
+  end subroutine burn_box_done
+
+
   subroutine compute_rhodYdt(np, rho, T, Y, rdYdt)
     integer, intent(in) :: np
     double precision :: rho(np), T(np), Y(*)
@@ -1,6 +1,7 @@
 module eos_module 
 
   use chemistry_module, only : nspecies, Ru, inv_mwt
+  use tinv_module, only : tinv_init, tinv_T_given_eY, tinv_ttol_eY, tinv_itmax_eY
 
   implicit none
 
@@ -16,7 +17,7 @@ module eos_module
 
   logical, save, private :: initialized = .false.
 
-  private :: nspecies, Ru, inv_mwt
+  private :: nspecies, Ru, inv_mwt, tinv_init, tinv_T_given_eY, tinv_ttol_eY, tinv_itmax_eY
 
 contains
 
@@ -57,6 +58,8 @@ contains
        eref = 0.d0
     end if
 
+    call tinv_init()
+
     initialized = .true.
     
   end subroutine eos_init
@@ -121,6 +124,33 @@ contains
   end subroutine eos_get_T
 
 
+  ! eos_get_T for the np cells of a row, with Y(i,:) the mass fractions of
+  ! cell i.  The row goes through the batched solver of tinv_module, to the
+  ! tolerance of get_T_given_eY; the cells it hands back are solved
+  ! pointwise.  ierr(i) is set as by eos_get_T.
+  subroutine eos_get_T_row(np, T, e, Y, ierr)
+    integer, intent(in) :: np
+    double precision, intent(inout) :: T(np)
+    double precision, intent(in) :: e(np), Y(np,nspecies)
+    integer, intent(out) :: ierr(np)
+    integer :: i, iwrk, niter(np)
+    double precision :: rwrk, Yt(nspecies)
+    call tinv_T_given_eY(np, e, Y, T, 0.d0, tinv_ttol_eY, tinv_itmax_eY, .false., niter)
+    do i = 1, np
+       ierr(i) = 0
+       if (niter(i) .lt. 0) then
+          Yt = Y(i,:)
+          call get_T_given_eY(e(i), Yt, iwrk, rwrk, T(i), ierr(i))
+          if (ierr(i) .ne. 0) then
+             print *, 'EOS: get_T failed, T, e, Y = ', T(i), e(i), Yt
+             cycle
+          end if
+       end if
+       T(i) = max(T(i), smallt)
+    end do
+  end subroutine eos_get_T_row
+
+
   subroutine eos_get_p(p, rho, T, Y, pt_index)
     double precision, intent(out) :: p
     double precision, intent(in) :: rho, T, Y(nspecies)
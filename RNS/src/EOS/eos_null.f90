@@ -103,6 +103,16 @@ contains
   end subroutine eos_get_T
 
 
+  subroutine eos_get_T_row(np, T, e, Y, ierr)
+    integer, intent(in) :: np
+    double precision, intent(out) :: T(np)
+    double precision, intent(in ) :: e(np), Y(np,2)
+    integer, intent(out) :: ierr(np)
+    T = e/cv
+    ierr = 0
+  end subroutine eos_get_T_row
+
+
   subroutine eos_get_p(p, rho, T, Y, pt_index)
     double precision, intent(out) :: p
     double precision, intent(in) :: rho, T, Y(2)
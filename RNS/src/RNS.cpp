@@ -159,10 +159,17 @@ int          RNS::do_chemistry        = 1;
 int          RNS::use_vode            = 0;
 int          RNS::new_J_cell          = 1; // new Jacobian for each cell?
 int          RNS::chem_do_weno        = 1;
+Real         RNS::chem_adapt_tol      = 0.0; // burn smooth cells at one point instead of at Gauss points
 RNS::ChemSolverType RNS::chem_solver  = RNS::CC_BURNING;
 int          RNS::f2comp_simple_dUdt  = 0; // set dUdt = \Delta U / \Delta t in f2comp?
 int          RNS::f2comp_nbdf         = 1; // only use bdf/vode for the first ? times on each node for each time step
 
+Real         RNS::trans_lag_tol       = 0.0;  // reuse transport coefficients if T and X change less than this
+int          RNS::trans_lag_max       = 10;   // but recompute them at least every ? evaluations
+int          RNS::mc_diff_iters       = 0;    // multicomponent diffusion with ? Stefan-Maxwell sweeps
+
+int          RNS::dt_from_advance     = 0;    // estimate dt from the state of the last advection-diffusion evaluation
+
 // this will be reset upon restart
 Real         RNS::previousCPUTimeUsed = 0.0;
 Real         RNS::startCPUTime = 0.0;
@@ -335,6 +342,7 @@ RNS::read_params ()
     pp.query("use_vode", use_vode);
     pp.query("new_J_cell", new_J_cell);
     pp.query("chem_do_weno", chem_do_weno);
+    pp.query("chem_adapt_tol", chem_adapt_tol);
     {
 	int chem_solver_i;
 	if (pp.query("chem_solver", chem_solver_i)) {
@@ -350,6 +358,13 @@ RNS::read_params ()
     pp.query("f2comp_simple_dUdt", f2comp_simple_dUdt);
     pp.query("f2comp_nbdf", f2comp_nbdf);
 
+    pp.query("trans_lag_tol", trans_lag_tol);
+    pp.query("trans_lag_max", trans_lag_max);
+
+    pp.query("mc_diff_iters", mc_diff_iters);
+
+    pp.query("dt_from_advance", dt_from_advance);
+
     // Inform BoxLib boundary functions are thread safe.
     StateDescriptor::setBndryFuncThreadSafety(1);
 }
@@ -360,6 +375,12 @@ RNS::RNS ()
     chemstatus = 0;
     RK_k = 0;
     flux_reg_RK = 0;
+    want_dt_bound = have_dt_bound = false;
+    dt_bound_node = -1;
+#ifdef USE_SDCLIB
+    sdc_interp = 0;
+    sdc_restrict_flx = 0;
+#endif
 }
 
 RNS::RNS (Amr&            papa,
@@ -388,9 +409,17 @@ RNS::RNS (Amr&            papa,
       chemstatus->setVal(0.0,1);
     }
 
+    // Lagged transport coefficients saved for the old grids are of no use.
+    BL_FORT_PROC_CALL(RNS_TRANS_LAG_RESET,rns_trans_lag_reset)(level);
+
     RK_k = 0;
     flux_reg_RK = 0;
-#ifndef USE_SDCLIB
+    want_dt_bound = have_dt_bound = false;
+    dt_bound_node = -1;
+#ifdef USE_SDCLIB
+    sdc_interp = 0;
+    sdc_restrict_flx = 0;
+#else
     if (RK_order > 2) {
 	RK_k = new MultiFab[RK_order];
 	for (int i=0; i<RK_order; i++) {
@@ -414,6 +443,10 @@ RNS::~RNS ()
     delete chemstatus;
     delete [] RK_k;
     delete flux_reg_RK;
+#ifdef USE_SDCLIB
+    delete sdc_interp;
+    delete sdc_restrict_flx;
+#endif
 
 #if 0
     cout << "Number of AD evals:   " << Level() << " " << num_ad_evals << endl;
@@ -549,19 +582,41 @@ RNS::estTimeStep (Real /*dt_old*/)
 
     // This is just a dummy value to start with
     Real estdt  = 1.0e+20;
+#ifndef NULLCHEMISTRY
+    Real estdt_diff = 1.e+20;
+#endif
 
     const Real* dx    = geom.CellSize();
     const MultiFab& stateMF = get_new_data(State_Type);
 
-    for (MFIter mfi(stateMF); mfi.isValid(); ++mfi)
+    if (have_dt_bound)
     {
-	const Box& box = mfi.validbox();
-	Real dt = estdt;
-	BL_FORT_PROC_CALL(RNS_ESTDT,rns_estdt)
-	    (BL_TO_FORTRAN(stateMF[mfi]),
-	     box.loVect(),box.hiVect(),dx,&dt);
-
-	estdt = std::min(estdt,dt);
+	// picked up during the last advection-diffusion evaluation
+	estdt = dt_bound[0];
+#ifndef NULLCHEMISTRY
+	estdt_diff = dt_bound[1];
+#endif
+	have_dt_bound = false;
+    }
+    else
+    {
+	for (MFIter mfi(stateMF); mfi.isValid(); ++mfi)
+	{
+	    const Box& box = mfi.validbox();
+	    Real dt = estdt;
+#ifdef NULLCHEMISTRY
+	    BL_FORT_PROC_CALL(RNS_ESTDT,rns_estdt)
+		(BL_TO_FORTRAN(stateMF[mfi]),
+		 box.loVect(),box.hiVect(),dx,&dt);
+#else
+	    Real dt_diff = estdt_diff;
+	    BL_FORT_PROC_CALL(RNS_ESTDT_AD,rns_estdt_ad)
+		(BL_TO_FORTRAN(stateMF[mfi]),
+		 box.loVect(),box.hiVect(),dx,&dt,&dt_diff);
+	    estdt_diff = std::min(estdt_diff,dt_diff);
+#endif
+	    estdt = std::min(estdt,dt);
+	}
     }
     estdt *= cfl;
 
@@ -576,17 +631,6 @@ RNS::estTimeStep (Real /*dt_old*/)
 
 #else
 
-    Real estdt_diff = 1.e+20;
-    for (MFIter mfi(stateMF); mfi.isValid(); ++mfi)
-    {
-	const Box& box = mfi.validbox();
-	Real dt = estdt_diff;
-	BL_FORT_PROC_CALL(RNS_ESTDT_DIFF,rns_estdt_diff)
-	    (BL_TO_FORTRAN(stateMF[mfi]),
-	     box.loVect(),box.hiVect(),dx,&dt);
-
-	estdt_diff = std::min(estdt_diff,dt);
-    }
     estdt_diff *= diff_cfl;
 
     Real estdts[2];
@@ -787,6 +831,8 @@ RNS::postCoarseTimeStep (Real cumtime)
 	int nstep = parent->levelSteps(0);
 	if (nstep % sum_int == 0) {
 	    sum_conserved_variables();
+	    if (trans_lag_tol > 0.0) sum_trans_lag();
+	    if (chem_adapt_tol > 0.0 && chemstatus) sum_chem_adapt();
 	}
     }
 }
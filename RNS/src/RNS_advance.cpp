@@ -428,6 +428,13 @@ RNS::dUdt_AD(MultiFab& U, MultiFab& Uprime, Real time, int fill_boundary_type,
     const int*  domain_lo = geom.Domain().loVect();
     const int*  domain_hi = geom.Domain().hiVect();
 
+    // A partial update does not see the whole level.
+    bool get_dt_bound = dt_from_advance && want_dt_bound && !partialUpdate;
+    want_dt_bound = false;
+    if (get_dt_bound) {
+	BL_FORT_PROC_CALL(RNS_DT_BOUND_START,rns_dt_bound_start)();
+    }
+
     for (MFIter mfi(Uprime); mfi.isValid(); ++mfi)
     {
 	int i = mfi.index();
@@ -478,6 +485,11 @@ RNS::dUdt_AD(MultiFab& U, MultiFab& Uprime, Real time, int fill_boundary_type,
 	}
     }
 
+    if (get_dt_bound) {
+	BL_FORT_PROC_CALL(RNS_DT_BOUND_FINISH,rns_dt_bound_finish)(dt_bound[0], dt_bound[1]);
+	have_dt_bound = true;
+    }
+
     if (do_reflux && fine)
     {
 	for (int idim = 0; idim < BL_SPACEDIM ; idim++)
@@ -654,6 +666,7 @@ RNS::advance_AD(MultiFab& Unew, Real time, Real dt, int iteration, int ncycle)
 
 	// Step 2 of RK2
 	int fill_boundary_type = use_FillCoarsePatch;
+	want_dt_bound = true;
 	dUdt_AD(Unew, Uprime, time+0.5*dt, fill_boundary_type, fine, current, dt);
 	update_rk(Unew, U0, dt, Uprime); // Unew = U0 + dt*Uprime
 	post_update(Unew);
@@ -718,6 +731,7 @@ RNS::advance_AD(MultiFab& Unew, Real time, Real dt, int iteration, int ncycle)
 	if (fine_RK) {
 	    fine_RK->setVal(0.0);
 	}
+	want_dt_bound = true;
 	dUdt_AD(Unew, RK_k[stage], time+0.5*dt, fill_boundary_type, fine_RK, current, dt*(2./3.));
 	if (fine_RK) {
 	    (*fine) += (*fine_RK);
@@ -806,6 +820,7 @@ RNS::advance_AD(MultiFab& Unew, Real time, Real dt, int iteration, int ncycle)
 	if (fine_RK) {
 	    fine_RK->setVal(0.0);
 	}
+	want_dt_bound = true;
 	dUdt_AD(Unew, RK_k[stage], time+dt, fill_boundary_type, fine_RK, current, dt/6.);
 	if (fine_RK) {
 	    (*fine) += (*fine_RK);
@@ -859,6 +874,9 @@ void sdc_f1eval(void *Fp, void *Qp, double t, sdc_state *state, void *ctx)
                             // (i.e., this is a fine level)
   }
 
+  // the last node is the state the next time step starts from
+  rns.want_dt_bound = (state->node == rns.dt_bound_node);
+
   rns.dUdt_AD(U, Uprime, t, RNS::use_FillBoundary, F.crse_flux, F.fine_flux, 1.0,
 	      partialUpdate);
 
@@ -18,7 +18,8 @@ subroutine set_method_params(dm,Density,Xmom,Eden,Temp,FirstSpec, &
      NUM_STATE, NumSpec, small_dens_in, small_temp_in, small_pres_in, &
      gamma_in, grav_dir_in, grav_in, Tref_in, riemann_in, difmag_in, HLL_factor_in, blocksize, &
      do_weno_in, do_mdcd_weno_in, weno_p_in, weno_eps_in, weno_gauss_phi_in, &
-     use_vode_in, new_J_cell_in, chem_solver_in, chem_do_weno_in)
+     use_vode_in, new_J_cell_in, chem_solver_in, chem_do_weno_in, chem_adapt_tol_in, &
+     trans_lag_tol_in, trans_lag_max_in, mc_diff_iters_in)
 
   use meth_params_module
   use weno_module, only : init_weno
@@ -30,9 +31,11 @@ subroutine set_method_params(dm,Density,Xmom,Eden,Temp,FirstSpec, &
   integer, intent(in) :: dm
   integer, intent(in) :: Density, Xmom, Eden, Temp, FirstSpec, NUM_STATE, NumSpec, &
        riemann_in, blocksize(*), do_weno_in, do_mdcd_weno_in, weno_p_in, &
-       use_vode_in, new_J_cell_in, chem_solver_in, chem_do_weno_in, grav_dir_in
+       use_vode_in, new_J_cell_in, chem_solver_in, chem_do_weno_in, grav_dir_in, &
+       trans_lag_max_in, mc_diff_iters_in
   double precision, intent(in) :: small_dens_in, small_temp_in, small_pres_in, &
-       gamma_in, grav_in, Tref_in, difmag_in, HLL_factor_in, weno_eps_in, weno_gauss_phi_in
+       gamma_in, grav_in, Tref_in, difmag_in, HLL_factor_in, weno_eps_in, weno_gauss_phi_in, &
+       chem_adapt_tol_in, trans_lag_tol_in
   
   ndim = dm
 
@@ -118,6 +121,12 @@ subroutine set_method_params(dm,Density,Xmom,Eden,Temp,FirstSpec, &
   new_J_cell = (new_J_cell_in .ne. 0)
   chem_solver = chem_solver_in
   chem_do_weno = (chem_do_weno_in .ne. 0)
+  chem_adapt_tol = chem_adapt_tol_in
+
+  trans_lag_tol = trans_lag_tol_in
+  trans_lag_max = trans_lag_max_in
+
+  mc_diff_iters = mc_diff_iters_in
 
 end subroutine set_method_params
 
@@ -187,3 +196,42 @@ subroutine rns_passinfo(lev,iter,t)
   if (iter >= 0) iteration = iter
   if (t >= 0.d0) time = t
 end subroutine rns_passinfo
+
+! ::: 
+! ::: ----------------------------------------------------------------
+! ::: 
+
+subroutine rns_trans_lag_reset(lev)
+  use trans_lag_module, only : trans_lag_reset
+  integer, intent(in) :: lev
+  call trans_lag_reset(lev)
+end subroutine rns_trans_lag_reset
+
+subroutine rns_trans_lag_counts(lev, nrefresh, nreuse)
+  use trans_lag_module, only : trans_lag_counts
+  integer, intent(in) :: lev
+  integer(8), intent(out) :: nrefresh, nreuse
+  call trans_lag_counts(lev, nrefresh, nreuse)
+end subroutine rns_trans_lag_counts
+
+subroutine rns_chem_adapt_counts(lev, ngauss, naverage)
+  use chem_adapt_module, only : chem_adapt_counts
+  integer, intent(in) :: lev
+  integer, intent(out) :: ngauss, naverage
+  call chem_adapt_counts(lev, ngauss, naverage)
+end subroutine rns_chem_adapt_counts
+
+subroutine rns_dt_bound_start()
+  use dt_bound_module
+  dt_bound_adv  = 1.d50
+  dt_bound_diff = 1.d50
+  dt_bound_on = .true.
+end subroutine rns_dt_bound_start
+
+subroutine rns_dt_bound_finish(dt, dtdiff)
+  use dt_bound_module
+  double precision, intent(out) :: dt, dtdiff
+  dt_bound_on = .false.
+  dt     = dt_bound_adv
+  dtdiff = dt_bound_diff
+end subroutine rns_dt_bound_finish
@@ -187,7 +187,8 @@ RNS::variableSetUp ()
 	 small_dens, small_temp, small_pres, gamma, gravity_dir, gravity, Treference,
 	 riemann, difmag, HLL_factor, &blocksize[0], 
 	 do_weno, do_mdcd_weno, weno_p, weno_eps, weno_gauss_phi,
-	 use_vode, new_J_cell, chem_solver_i, chem_do_weno);
+	 use_vode, new_J_cell, chem_solver_i, chem_do_weno, chem_adapt_tol,
+	 trans_lag_tol, trans_lag_max, mc_diff_iters);
     
     int coord_type = Geometry::Coord();
     const Real* prob_lo   = Geometry::ProbLo();
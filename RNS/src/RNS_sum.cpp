@@ -95,3 +95,55 @@ RNS::sum_chemstatus()
 	}			
     }
 }
+
+void
+RNS::sum_trans_lag()
+{
+    int finest_level = parent->finestLevel();
+
+    //
+    // The counts are since the last report.
+    //
+    Array<long> nrefresh(finest_level+1), nreuse(finest_level+1);
+    for (int lev=0; lev<=finest_level; lev++) {
+	BL_FORT_PROC_CALL(RNS_TRANS_LAG_COUNTS,rns_trans_lag_counts)(lev, nrefresh[lev], nreuse[lev]);
+    }
+
+    ParallelDescriptor::ReduceLongSum(nrefresh.dataPtr(), finest_level+1, ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceLongSum(nreuse.dataPtr(), finest_level+1, ParallelDescriptor::IOProcessorNumber());
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+	for (int lev=0; lev<=finest_level; lev++) {
+	    std::cout << "Transport coefficients on level " << lev << ": "
+		      << nrefresh[lev] << " block evaluations, "
+		      << nreuse[lev] << " reused" << std::endl;
+	}
+    }
+}
+
+void
+RNS::sum_chem_adapt()
+{
+    int finest_level = parent->finestLevel();
+
+    Array<long> ngauss(finest_level+1), naverage(finest_level+1);
+    for (int lev=0; lev<=finest_level; lev++) {
+	int ng, na;
+	BL_FORT_PROC_CALL(RNS_CHEM_ADAPT_COUNTS,rns_chem_adapt_counts)(lev, ng, na);
+	ngauss[lev] = ng;
+	naverage[lev] = na;
+    }
+
+    ParallelDescriptor::ReduceLongSum(ngauss.dataPtr(), finest_level+1, ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceLongSum(naverage.dataPtr(), finest_level+1, ParallelDescriptor::IOProcessorNumber());
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+	for (int lev=0; lev<=finest_level; lev++) {
+	    std::cout << "Chemistry on level " << lev << ": "
+		      << ngauss[lev] << " cells burned at Gauss points, "
+		      << naverage[lev] << " at the average" << std::endl;
+	}
+    }
+}
@@ -84,96 +84,145 @@
 using namespace std;
 
 /*
- * Spatial interpolation between MultiFabs.
+ * Build (or return) the coarse buffers, periodic ghost cell depth and
+ * per-FAB geometries used by Interpolate.  Everything here depends on
+ * the grids only: this level is rebuilt when its grids change, and the
+ * coarse grids are checked, so the data survive all SDC nodes and
+ * iterations between regrids.  Keeping UC (and hence ba_C) alive also
+ * lets FabArray::copy reuse its cached copy schedules.
  */
-void RNS::Interpolate(MLSDCAmrEncap& F, MLSDCAmrEncap& G, Real t, bool isCorrection, bool isFEval, MLSDCAmrLevel& _levelG)
+RNS::SDCInterpData& RNS::getSDCInterpData(const MultiFab& UF, const MultiFab& UG, RNS& levelG)
 {
-  BL_PROFILE("MLSDC_AMR_INTERPOLATE()");
+  if (sdc_interp != 0 && sdc_interp->ba_G == UG.boxArray())
+    return *sdc_interp;
 
-  MultiFab& UF     = *F.U;
-  MultiFab& UG     = *G.U;
-  RNS&      levelF = *this;
-  RNS&      levelG = dynamic_cast<RNS&>(_levelG);
+  BL_PROFILE("RNS::getSDCInterpData()");
+
+  delete sdc_interp;
+  sdc_interp = new SDCInterpData;
+
+  SDCInterpData& d = *sdc_interp;
 
   const IntVect&        ratio = levelG.fineRatio();
-  const DescriptorList& dl    = levelF.get_desc_lst();
+  const DescriptorList& dl    = get_desc_lst();
   const Array<BCRec>&   bcs   = dl[0].getBCs();
   const int             ncomp = dl[0].nComp();
   Interpolater&         map   = *dl[0].interp();
-  Array<BCRec>          bcr(ncomp);
 
   const Geometry& geomG = levelG.Geom();
 
-  RNS_SETNAN(UF);
+  d.ba_G = UG.boxArray();
 
-  // make a coarse version (UC) of the fine multifab (UF)
-  BoxArray ba_C(UF.size());
-  for (int i=0; i<ba_C.size(); i++)
-    ba_C.set(i, map.CoarseBox(UF.fabbox(i), ratio));
+  // coarse version of the fine grids
+  d.ba_C.resize(UF.size());
+  for (int i=0; i<d.ba_C.size(); i++)
+    d.ba_C.set(i, map.CoarseBox(UF.fabbox(i), ratio));
 
-  MultiFab UC(ba_C, ncomp, 0);
-  RNS_SETNAN(UC);
+  d.UC = new MultiFab(d.ba_C, ncomp, 0);
 
-  bool touch = false;
-  bool touch_periodic = false;
+  const BoxArray& ba_C = d.ba_C;
   const Box& crse_domain_box = levelG.Domain();
   if (geomG.isAnyPeriodic()) {
       for (int i=0; i < ba_C.size(); i++) {
 	  if (! crse_domain_box.contains(ba_C[i])) {
-	      touch = true;
+	      d.touch = true;
 	      for (int idim=0; idim<BL_SPACEDIM; idim++) {
 		  if (geomG.isPeriodic(i)   ||
 		      ba_C[i].bigEnd(idim) > crse_domain_box.bigEnd(idim) ||
 		      ba_C[i].smallEnd(idim) < crse_domain_box.smallEnd(idim) )
 		  {
-		      touch_periodic = true;
+		      d.touch_periodic = true;
 		      break;
 		  }
 	      }
 	  }
-	  if (touch_periodic) break;
+	  if (d.touch_periodic) break;
       }
   }
   else {
       for (int i=0; i < ba_C.size(); i++) {
 	  if (! crse_domain_box.contains(ba_C[i])) {
-	      touch = true;
+	      d.touch = true;
 	      break;
 	  }
       }
   }
 
-  if (!touch) {
+  if (d.touch_periodic) {
+      // Level F might touch only one of the periodic boundaries.
+      Box box_C = ba_C.minimalBox();
+      for (int idim=0; idim < BL_SPACEDIM; idim++) {
+	  int gap_hi = box_C.bigEnd(idim) - crse_domain_box.bigEnd(idim);
+	  int gap_lo = crse_domain_box.smallEnd(idim) - box_C.smallEnd(idim);
+	  d.ng_C = std::max(d.ng_C, gap_hi);
+	  d.ng_C = std::max(d.ng_C, gap_lo);
+      }
+
+      if (d.ng_C > UG.nGrow())
+	  d.UGG = new MultiFab(d.ba_G, ncomp, d.ng_C, Fab_allocate);
+
+      // FabArray::copy() copies only from valid regions, so the coarse
+      // data goes through a MultiFab whose valid boxes are the grown ones.
+      BoxArray ba_G2(d.ba_G.size());
+      for (int i=0; i<ba_G2.size(); i++)
+	  ba_G2.set(i, BoxLib::grow(d.ba_G[i],d.ng_C));
+
+      d.UG2 = new MultiFab(ba_G2, ncomp, 0);
+  }
+
+  d.crse_geom.resize(UF.size());
+  d.fine_geom.resize(UF.size());
+  d.bcr.resize(UF.size());
+  for (MFIter mfi(UF); mfi.isValid(); ++mfi) {
+    int i = mfi.index();
+    d.bcr[i].resize(ncomp);
+    BoxLib::setBC(UF[mfi].box(), Domain(), 0, 0, ncomp, bcs, d.bcr[i]);
+    d.fine_geom[i].define(UF[mfi].box());
+    d.crse_geom[i].define((*d.UC)[mfi].box());
+  }
+
+  return d;
+}
+
+/*
+ * Spatial interpolation between MultiFabs.
+ */
+void RNS::Interpolate(MLSDCAmrEncap& F, MLSDCAmrEncap& G, Real t, bool isCorrection, bool isFEval, MLSDCAmrLevel& _levelG)
+{
+  BL_PROFILE("MLSDC_AMR_INTERPOLATE()");
+
+  MultiFab& UF     = *F.U;
+  MultiFab& UG     = *G.U;
+  RNS&      levelF = *this;
+  RNS&      levelG = dynamic_cast<RNS&>(_levelG);
+
+  const IntVect&        ratio = levelG.fineRatio();
+  const DescriptorList& dl    = levelF.get_desc_lst();
+  const int             ncomp = dl[0].nComp();
+  Interpolater&         map   = *dl[0].interp();
+
+  RNS_SETNAN(UF);
+
+  SDCInterpData& d = levelF.getSDCInterpData(UF, UG, levelG);
+
+  // coarse version (UC) of the fine multifab (UF)
+  MultiFab& UC = *d.UC;
+  RNS_SETNAN(UC);
+
+  if (!d.touch) {
     // If level F does not touch physical boundaries, then AMR levels are
     // properly nested so that the valid rgions of UC are contained inside
     // the valid regions of UG.  So FabArray::copy is all we need.
     UC.copy(UG);
   }
-  else if (touch_periodic) {
-
-      // This case is more complicated because level F might touch only one
-      // of the periodic boundaries.
-      int ng_C = 0;
-      {
-	  Box box_C = ba_C.minimalBox();
-	  for (int idim=0; idim < BL_SPACEDIM; idim++) {
-	      int gap_hi = box_C.bigEnd(idim) - crse_domain_box.bigEnd(idim);
-	      int gap_lo = crse_domain_box.smallEnd(idim) - box_C.smallEnd(idim);
-	      ng_C = std::max(ng_C, gap_hi);
-	      ng_C = std::max(ng_C, gap_lo);
-	  }
-      }
-      int ng_G = UG.nGrow();
-      const BoxArray& ba_G = UG.boxArray();
+  else if (d.touch_periodic) {
 
       MultiFab* UG_safe;
-      MultiFab UGG;
 
-      if (ng_C > ng_G) {
-	  UGG.define(ba_G, ncomp, ng_C, Fab_allocate);
-	  RNS_SETNAN(UGG);
-	  MultiFab::Copy(UGG, UG, 0, 0, ncomp, 0);
-	  UG_safe = &UGG;
+      if (d.UGG != 0) {
+	  RNS_SETNAN(*d.UGG);
+	  MultiFab::Copy(*d.UGG, UG, 0, 0, ncomp, 0);
+	  UG_safe = d.UGG;
       }
       else {
 	  UG_safe = &UG;
@@ -183,17 +232,9 @@ void RNS::Interpolate(MLSDCAmrEncap& F, MLSDCAmrEncap& G, Real t, bool isCorrect
 
       levelG.fill_boundary(*UG_safe, t, RNS::use_FillBoundary, isCorrection, isFEval);
 
-      // We cannot do FabArray::copy() directly on UG because it copies only form
-      // valid regions.  So we need to make the ghost cells of UG valid.
-      BoxArray ba_G2(UG.size());
-      for (int i=0; i<ba_G2.size(); i++) {
-	  ba_G2.set(i, BoxLib::grow(ba_G[i],ng_C));
-      }
-
-      MultiFab UG2(ba_G2, ncomp, 0);
+      MultiFab& UG2 = *d.UG2;
       for (MFIter mfi(UG2); mfi.isValid(); ++mfi)
       {
-	  int i = mfi.index();
 	  UG2[mfi].copy((*UG_safe)[mfi]);  // Fab to Fab copy
       }
 
@@ -224,12 +265,9 @@ void RNS::Interpolate(MLSDCAmrEncap& F, MLSDCAmrEncap& G, Real t, bool isCorrect
   // now that UF is completely contained within UC, cycle through each
   // FAB in UF and interpolate from the corresponding FAB in UC
   for (MFIter mfi(UF); mfi.isValid(); ++mfi) {
-    BoxLib::setBC(UF[mfi].box(), levelF.Domain(), 0, 0, ncomp, bcs, bcr);
-    Geometry fine_geom(UF[mfi].box());
-    Geometry crse_geom(UC[mfi].box());
-
+    int i = mfi.index();
     map.interp(UC[mfi], 0, UF[mfi], 0, ncomp, UF[mfi].box(), ratio,
-               crse_geom, fine_geom, bcr, 0, 0);
+               d.crse_geom[i], d.fine_geom[i], d.bcr[i], 0, 0);
   }
 
 #if 0
@@ -267,7 +305,12 @@ void RNS::Restrict(MLSDCAmrEncap& F, MLSDCAmrEncap& G, Real t, MLSDCAmrLevel& _l
     FluxRegister& flxF       = *F.fine_flux;
     FluxRegister& flxG       = *G.crse_flux;
 
-    FluxRegister flx(UF.boxArray(), crse_ratio, levelF.Level(), UF.nComp());
+    // Scratch register, kept until this level is rebuilt.  Every face is
+    // overwritten below, so it needs no clearing.
+    if (levelF.sdc_restrict_flx == 0)
+      levelF.sdc_restrict_flx = new FluxRegister(UF.boxArray(), crse_ratio, levelF.Level(), UF.nComp());
+
+    FluxRegister& flx = *levelF.sdc_restrict_flx;
     for (OrientationIter face; face; ++face)
       for (FabSetIter bfsi(flxF[face()]); bfsi.isValid(); ++bfsi) {
         flx[face()][bfsi].copy(flxF[face()][bfsi]);
@@ -344,6 +387,7 @@ SDCAmr::coarseTimeStep (Real stop_time)
     RNS& rns  = *dynamic_cast<RNS*>(&getLevel(lev));
     rns.clearTouchFine();
     rns.reset_f2comp_timer(mg.sweepers[lev]->nset->nnodes);
+    rns.dt_bound_node = mg.sweepers[lev]->nset->nnodes - 1;
     rns.zeroChemStatus();
   }
 
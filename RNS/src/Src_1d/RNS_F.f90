@@ -7,6 +7,7 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   use meth_params_module, only : NVAR, gravity, URHO, UMX, UEDEN
   use hypterm_module, only : hypterm
   use difterm_module, only : difterm
+  use dt_bound_module, only : dt_bound_on, dt_bound_adv
   implicit none
 
   integer, intent(in) :: lo(1), hi(1), domlo(1), domhi(1)
@@ -36,6 +37,10 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
 
   call hypterm(lo,hi,domlo,domhi,U,Ulo,Uhi,flux, dx)
   call difterm(lo,hi,domlo,domhi,U,Ulo,Uhi,fdif, dx)
+
+  if (dt_bound_on) then
+     call rns_estdt(U,U_l1,U_h1,lo,hi,dx,dt_bound_adv)
+  end if
   
   do n=1, NVAR
      flux(lo(1),n) = flux(lo(1),n) + fdif(lo(1),n)
@@ -130,32 +135,38 @@ end subroutine rns_dUdt_chem
 
 subroutine rns_compute_temp(lo,hi,U,U_l1,U_h1)
   use meth_params_module, only : NVAR, URHO, UMX, UEDEN, UTEMP, UFS, NSPEC
-  use eos_module, only : eos_get_T
+  use eos_module, only : eos_get_T_row
   implicit none
   
   integer, intent(in) :: lo(1), hi(1)
   integer, intent(in) ::  U_l1,  U_h1
   double precision, intent(inout) :: U( U_l1: U_h1,NVAR)
 
-  integer :: i, pt_index(1), ierr
-  double precision :: rhoInv, e, v, Y(NSPEC)
+  integer :: i, n, ierr(lo(1):hi(1))
+  double precision :: rhoInv, v
+  double precision :: e(lo(1):hi(1)), T(lo(1):hi(1)), Y(lo(1):hi(1),NSPEC)
 
   do i=lo(1),hi(1)
-     pt_index(1) = i
-
      rhoInv = 1.0d0/U(i,URHO)
 
-     v  = U(i,UMX)*rhoInv     
-     e  = U(i,UEDEN)*rhoInv - 0.5d0*v*v
+     v    = U(i,UMX)*rhoInv     
+     e(i) = U(i,UEDEN)*rhoInv - 0.5d0*v*v
 
-     Y = U(i,UFS:UFS+NSPEC-1)*rhoInv
+     do n=1,NSPEC
+        Y(i,n) = U(i,UFS+n-1)*rhoInv
+     end do
 
-     call eos_get_T(U(i,UTEMP), e, Y, pt_index, ierr)
+     T(i) = U(i,UTEMP)
+  end do
+
+  call eos_get_T_row(hi(1)-lo(1)+1, T, e, Y, ierr)
 
-     if (ierr .ne. 0) then
+  do i=lo(1),hi(1)
+     if (ierr(i) .ne. 0) then
         print *, 'rns_compute_temp failed at ', i,U(i,:)
         call bl_error("rns_compute_temp failed")
      end if
+     U(i,UTEMP) = T(i)
   end do
 end subroutine rns_compute_temp
 
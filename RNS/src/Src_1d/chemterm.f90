@@ -1,11 +1,12 @@
 module chemterm_module
 
   use meth_params_module
-  use burner_module, only : burn, compute_rhodYdt, splitburn, beburn
+  use burner_module, only : burn, compute_rhodYdt, splitburn, beburn, burn_box_done
   use eos_module, only : eos_get_T
   use weno_module, only : cellavg2gausspt_1d
   use convert_module, only : cellavg2cc_1d, cc2cellavg_1d
   use renorm_module, only : floor_species
+  use chem_adapt_module, only : chem_adapt_select
   use passinfo_module, only : level
 
   implicit none
@@ -38,6 +39,8 @@ contains
           call bl_error("unknown chem_solver")
        end select
 
+    call burn_box_done()
+
   end subroutine chemterm
 
 
@@ -131,7 +134,7 @@ contains
     double precision, intent(inout) :: st(stlo(1):sthi(1))
     double precision, intent(in) :: dt
 
-    integer :: i, n, g, ierr
+    integer :: i, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(2), YT(nspec+1,2)
     double precision, allocatable :: UG(:,:,:)
@@ -161,8 +164,13 @@ contains
           end do
        end if
 
+       ng = 2
+       if (st(i) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+          call chem_adapt_select(2, rhot, Yt, ng)
+       end if
+
        if (st(i) .eq. 0.d0) then
-          call burn(2, rhot, Yt, dt, force_new_J)
+          call burn(ng, rhot(1:ng), Yt(:,1:ng), dt, force_new_J, ierr)
           if (ierr .ne. 0) then
              st(i) = -1.d0
              force_new_J = .true.
@@ -174,9 +182,9 @@ contains
        if (st(i) .eq. 0.d0) then
           
           U(i,UFS:UFS+nspec-1) = 0.d0 
-          do g=1,2
+          do g=1,ng
              do n=1,nspec
-                U(i,UFS+n-1) = U(i,UFS+n-1) + 0.5d0*rhot(g)*Yt(n,g)
+                U(i,UFS+n-1) = U(i,UFS+n-1) + rhot(g)*Yt(n,g)/ng
              end do
           end do
              
@@ -215,7 +223,7 @@ contains
     double precision, intent(inout) :: st(stlo(1):sthi(1))
     double precision, intent(in) :: dt
 
-    integer :: i, n, g, ierr
+    integer :: i, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(2), rho0(1)
     double precision :: Yt(nspec+1,2), YT0(nspec+1)
@@ -251,6 +259,11 @@ contains
           end do
        end if
 
+       ng = 2
+       if (st(i) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+          call chem_adapt_select(2, rhot, Yt, ng)
+       end if
+
        if (st(i) .eq. 0.d0) then
           call burn(1, rho0, YT0, dt, force_new_J, ierr)
           if (ierr .ne. 0) then
@@ -261,7 +274,14 @@ contains
           end if
        end if
 
-       if (st(i) .eq. 0.d0) then
+       if (st(i) .eq. 0.d0 .and. ng .eq. 1) then
+
+          ! smooth cell: keep the burned average
+          do n=1,nspec
+             U(i,UFS+n-1) = rho0(1)*YT0(n)
+          end do
+
+       else if (st(i) .eq. 0.d0) then
 
           call splitburn(2, rho0(1), YT0, rhot, Yt, dt) 
           ! Now Yt is \Delta Y and T
@@ -419,7 +439,7 @@ contains
     double precision, intent(in) :: dt
     double precision, intent(in), optional :: Up(lo(1):hi(1),NVAR)
 
-    integer :: i, n, g, ierr
+    integer :: i, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(2), rho0(1)
     double precision :: Yt(nspec+1,2), YT0(nspec+1), rhoY(nspec)
@@ -451,6 +471,11 @@ contains
           end do
        end if
        
+       ng = 2
+       if (st(i) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+          call chem_adapt_select(2, rhot, Yt, ng)
+       end if
+
        if (st(i) .eq. 0.d0) then
           
           if (present(Up)) then
@@ -476,7 +501,7 @@ contains
           call floor_species(nspec, YT0(1:nspec))
 
           rhoY = 0.d0
-          do g=1,2
+          do g=1,ng
              call beburn(rho0(1), YT0, rhot(g), Yt(:,g), dt, g, ierr)
              if (ierr .ne. 0) then ! beburn failed
                 st(i) = -1.d0
@@ -484,7 +509,7 @@ contains
                 exit
              end if
              do n=1,nspec
-                rhoY(n) = rhoY(n) + 0.5d0*rhot(g)*Yt(n,g)
+                rhoY(n) = rhoY(n) + rhot(g)*Yt(n,g)/ng
              end do
           end do
           
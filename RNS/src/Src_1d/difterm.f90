@@ -15,6 +15,7 @@ contains
     use convert_module, only : cellavg2cc_1d
     use variables_module, only : ctoprim
     use transport_properties, only : get_transport_properties
+    use dt_bound_module, only : dt_bound_on
 
     integer, intent(in) :: lo(1), hi(1), domlo(1), domhi(1), Ulo(1), Uhi(1)
     double precision, intent(in ) ::   U(Ulo(1):Uhi(1)  ,NVAR)
@@ -62,6 +63,11 @@ contains
     ! transport coefficients on face
     call get_transport_properties(Qflo,Qfhi, Qf, Qflo,Qfhi,QFVAR, mu, xi, lam, Ddia, Qflo,Qfhi)
 
+    ! In 1D the coefficients are only available on faces.
+    if (dt_bound_on) then
+       call diff_dt_bound(Qflo(1),Qfhi(1),Qf,Ddia,Qflo(1),Qfhi(1),dx)
+    end if
+
     call comp_diff_flux(flx, Qf, mu, xi, lam, Ddia, Qflo, Qfhi, Qc, Qclo, Qchi, dxinv, domlo, domhi)
 
     deallocate(Qc,Qf)
@@ -70,11 +76,48 @@ contains
   end subroutine difterm
 
 
+  ! Lower dt_bound_diff with the diffusive time step limit on lo:hi, computed
+  ! as in rns_estdt_ad from the state and coefficients.
+  subroutine diff_dt_bound(lo,hi,Q,Ddia,clo,chi,dx)
+    use meth_params_module, only : NSPEC, QFVAR, QRHO, QFX
+    use chemistry_module, only : molecular_weight, inv_mwt
+    use dt_bound_module, only : dt_bound_diff
+    integer, intent(in) :: lo, hi, clo, chi
+    double precision, intent(in) ::    Q(clo:chi,QFVAR)
+    double precision, intent(in) :: Ddia(clo:chi,NSPEC)
+    double precision, intent(in) :: dx(1)
+
+    integer :: i, n
+    double precision :: Wbar, D, dt
+
+    dt = 1.d50
+
+    do i=lo,hi
+       Wbar = 0.d0
+       do n=1,NSPEC
+          Wbar = Wbar + Q(i,QFX+n-1)*molecular_weight(n)
+       end do
+       D = 0.d0
+       do n=1,NSPEC
+          D = max(D, Ddia(i,n)*Wbar*inv_mwt(n))
+       end do
+       dt = min(dt, Q(i,QRHO)/D)
+    end do
+
+    dt = dt * 0.5d0*dx(1)**2
+
+    !$omp atomic
+    dt_bound_diff = min(dt_bound_diff, dt)
+
+  end subroutine diff_dt_bound
+
+
   subroutine comp_diff_flux(flx, Qf, mu, xi, lam, Ddia, Qflo, Qfhi, Qc, Qclo, Qchi, dxinv, domlo, domhi)
 
     use prob_params_module, only : physbc_lo, physbc_hi, NoSlipWall
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
 
     integer, intent(in) :: Qflo(1), Qfhi(1), Qclo(1), Qchi(1), domlo(1), domhi(1)
     double precision, intent(in) :: dxinv(1)
@@ -87,8 +130,9 @@ contains
     double precision, intent(out) ::  flx(Qflo(1):Qfhi(1),NVAR)
 
     integer :: i, n, UYN, QYN, QXN, QHN
-    double precision :: tauxx, dudx, dTdx, dXdx, Vd
+    double precision :: tauxx, dudx, dTdx, dXdx
     double precision, dimension(Qflo(1):Qfhi(1)) :: dlnpdx, Vc, msk
+    double precision, dimension(Qflo(1):Qfhi(1),NSPEC) :: dk, Vd
     double precision, parameter :: fourThirds = 4.d0/3.d0
 
     msk = 1.d0
@@ -129,7 +173,6 @@ contains
 
     do n=1,NSPEC
 
-       UYN = UFS+n-1
        QYN = QFY+n-1
        QXN = QFX+n-1
 
@@ -138,10 +181,20 @@ contains
           dXdx = dxinv(1) * (FD4(-2)*Qc(i-2,QXN) + FD4(-1)*Qc(i-1,QXN) &
             + FD4(0)*Qc(i,QXN) + FD4(1)*Qc(i+1,QXN))
 
-          Vd = -Ddia(i,n)*(dXdx + (Qf(i,QXN)-Qf(i,QYN))*dlnpdx(i)) * msk(i)
-          
-          flx(i,UYN) = Vd
-          Vc(i) = Vc(i) + Vd
+          dk(i,n) = (dXdx + (Qf(i,QXN)-Qf(i,QYN))*dlnpdx(i)) * msk(i)
+          Vd(i,n) = -Ddia(i,n)*dk(i,n)
+       end do
+    end do
+
+    if (mc_diff_iters .gt. 0) then
+       call get_mc_diff_flux(Qfhi(1)-Qflo(1)+1, Qf(:,QTEMP), Qf(:,QFX:QFX+NSPEC-1), dk, Vd)
+    end if
+
+    do n=1,NSPEC
+       UYN = UFS+n-1
+       do i = Qflo(1), Qfhi(1)
+          flx(i,UYN) = Vd(i,n)
+          Vc(i) = Vc(i) + Vd(i,n)
        end do
     end do
 
@@ -1,15 +1,17 @@
-subroutine rns_estdt_diff(u,u_l1,u_h1,lo,hi,dx,dt)
+! Advective and diffusive time step limits in one sweep over the state.
+subroutine rns_estdt_ad(u,u_l1,u_h1,lo,hi,dx,dt,dtdiff)
   use meth_params_module
+  use eos_module, only : eos_get_c
   use egz_module, only : egzini, egzpar, egzvr1
   use chemistry_module, only : inv_mwt
   integer, intent(in) :: u_l1,u_h1
   integer, intent(in) :: lo(1), hi(1)
   double precision, intent(in) :: u(u_l1:u_h1,NVAR)
   double precision, intent(in) :: dx(1)
-  double precision, intent(inout) :: dt
+  double precision, intent(inout) :: dt, dtdiff
 
   integer :: i, n, np, iwrk
-  double precision :: rwrk, Yt(NSPEC), Xt(NSPEC), rhoInv, Wbar, D, dx2
+  double precision :: rwrk, Yt(NSPEC), Xt(NSPEC), rhoInv, Wbar, D, dx2, ux, c
   double precision, allocatable :: DZ(:,:), XZ(:,:), CPZ(:,:)
   
   np = hi(1)-lo(1)+1
@@ -27,6 +29,11 @@ subroutine rns_estdt_diff(u,u_l1,u_h1,lo,hi,dx,dt)
   do i=lo(1),hi(1)
      rhoInv = 1.d0/u(i,URHO)
      Yt = u(i,UFS:UFS+nspec-1)*rhoInv
+
+     ux = u(i,UMX)*rhoInv
+     call eos_get_c(c,u(i,URHO),u(i,UTEMP),Yt)
+     dt = min(dt, dx(1)/(abs(ux)+c+1.d-50))
+
      call ckytx(Yt, iwrk, rwrk, Xt)
      XZ(i,:) = Xt
   end do
@@ -42,11 +49,10 @@ subroutine rns_estdt_diff(u,u_l1,u_h1,lo,hi,dx,dt)
      do n=1,nspec
         D = max(D, DZ(i,n)*Wbar*inv_mwt(n))
      end do
-     dt = min(dt, dx2/D*u(i,URHO))
+     dtdiff = min(dtdiff, dx2/D*u(i,URHO))
   end do
      
   deallocate(DZ,XZ,CPZ)
   
-end subroutine rns_estdt_diff
-
+end subroutine rns_estdt_ad
 
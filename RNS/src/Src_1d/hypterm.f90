@@ -64,124 +64,20 @@ contains
   end subroutine hypterm
 
   subroutine reconstruct(lo, hi, U, Ulo, Uhi, UL, UR, flo, fhi)
-    use meth_params_module, only : NVAR, URHO, UMX, UTEMP, UFS, UEDEN, NSPEC, NCHARV, CFS, do_mdcd
-    use eigen_module, only : get_eigen_matrices
-    use renorm_module, only : floor_species
-    use eos_module, only : eos_get_eref
-    use mdcd_module, only : mdcd
-    use weno_module, only : weno5_face
+    use meth_params_module, only : NVAR, UMX, UTEMP
+    use charrecon_module, only : char_recon_face
     integer, intent(in) :: lo, hi, Ulo, Uhi, flo, fhi
     double precision, intent(in) :: U(Ulo:Uhi,NVAR)
     double precision, intent(out) :: UL(flo:fhi,NVAR)
     double precision, intent(out) :: UR(flo:fhi,NVAR)
 
-    integer :: i, n, ii, ivar, m
-    double precision, allocatable :: Y(:,:), RoeW(:), v(:)
-    double precision :: rhoInv, rho0, Y0(nspec), T0, v0(3), fac, eref
-    double precision :: egv1(NCHARV,NCHARV), egv2(NCHARV,NCHARV), Uii(NCHARV), charv(-3:2,NCHARV)
-    double precision :: cvl(NCHARV), cvr(NCHARV)
+    integer :: i
 
-    allocate(Y(lo-3:hi+3,nspec))
-    allocate(RoeW(lo-3:hi+3))
-    allocate(v(lo-3:hi+3))
+    call char_recon_face(lo, hi, U, Ulo, Uhi, (/UMX, 0, 0/), UL, UR, flo, fhi)
 
-    v0 = 0.d0
-
-    UL = 0.d0
-    UR = 0.d0
-
-    do i=lo-3,hi+3
-       rhoInv = 1.d0/U(i,URHO)
-
-       RoeW(i) = sqrt(U(i,URHO))
-
-       do n=1,nspec
-          Y(i,n) = U(i,UFS+n-1)*rhoInv
-       end do
-
-       v(i) = U(i,UMX)*rhoInv
-    end do
-    
     do i=lo, hi+1
-       rho0 = RoeW(i-1)*RoeW(i)
-       fac = 1.d0 / (RoeW(i-1)+RoeW(i))
-       Y0 = (Y(i-1,:)*RoeW(i-1) + Y(i,:)*RoeW(i)) * fac
-       T0 = (U(i-1,UTEMP)*RoeW(i-1) + U(i,UTEMP)*RoeW(i)) * fac
-       v0(1) = (v(i-1)*RoeW(i-1) + v(i)*RoeW(i)) * fac
-
-       call floor_species(nspec, Y0)
-
-       ! egv1: left matrix;  egv2: right matrix
-       call get_eigen_matrices(rho0, Y0, T0, v0, egv1, egv2)
-
-       do ii=-3,2
-          Uii(1) = U(i+ii,UMX)
-          Uii(2) = 0.d0  ! because of 1d
-          Uii(3) = 0.d0
-          Uii(4) = U(i+ii,UEDEN)
-          
-          eref = eos_get_eref(Y(i+ii,:))
-          Uii(4) = Uii(4) - U(i+ii,URHO) * eref
-
-          do n=1,nspec
-             Uii(CFS+n-1) = U(i+ii,UFS+n-1)
-          end do
-
-          do n=1,NCHARV
-             charv(ii,n) = dot_product(egv1(:,n),Uii)
-          end do
-       end do
-
-       if (do_mdcd) then
-          do ivar=1,NCHARV
-             call mdcd(charv(:,ivar), cvl(ivar), cvr(ivar))
-          end do
-       else
-          do ivar=1,NCHARV
-             call weno5_face(charv(:,ivar), cvl(ivar), cvr(ivar))
-          end do
-       end if
-
-       egv1 = transpose(egv2)  ! egv1 now holds transposed right matrix
-
-       do n=1,NCHARV
-          UL(i,UMX  ) = UL(i,UMX  ) + cvl(n)*egv2(1,n)
-          UR(i,UMX  ) = UR(i,UMX  ) + cvr(n)*egv2(1,n)
-          UL(i,UEDEN) = UL(i,UEDEN) + cvl(n)*egv2(4,n)
-          UR(i,UEDEN) = UR(i,UEDEN) + cvr(n)*egv2(4,n)
-       end do
-
-       do m=1,nspec
-          UL(i,UFS+m-1) = UL(i,UFS+m-1) + dot_product(cvl, egv1(:,CFS+m-1))
-          UR(i,UFS+m-1) = UR(i,UFS+m-1) + dot_product(cvr, egv1(:,CFS+m-1))
-          UL(i,URHO   ) = UL(i,URHO) + UL(i,UFS+m-1)
-          UR(i,URHO   ) = UR(i,URHO) + UR(i,UFS+m-1)
-       end do
-
        UL(i,UTEMP) = U(i-1,UTEMP)
        UR(i,UTEMP) = U(i  ,UTEMP)
-          
-       rhoInv = 1.d0/UL(i,URHO)
-       do n=1,nspec
-          Y0(n) = UL(i,UFS+n-1) * rhoInv
-       end do
-       call floor_species(nspec, Y0)
-       eref = eos_get_eref(Y0)
-       UL(i,UEDEN) = UL(i,UEDEN) + UL(i,URHO) * eref
-       do n=1,nspec
-          UL(i,UFS+n-1) = UL(i,URHO)*Y0(n)
-       end do
-
-       rhoInv = 1.d0/UR(i,URHO)
-       do n=1,nspec
-          Y0(n) = UR(i,UFS+n-1) * rhoInv
-       end do
-       call floor_species(nspec, Y0)
-       eref = eos_get_eref(Y0)
-       UR(i,UEDEN) = UR(i,UEDEN) + UR(i,URHO) * eref
-       do n=1,nspec
-          UR(i,UFS+n-1) = UR(i,URHO)*Y0(n)
-       end do
     end do
 
   end subroutine reconstruct
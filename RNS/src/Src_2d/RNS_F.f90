@@ -10,6 +10,7 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   use hypterm_module, only : hypterm
   use difterm_module, only : difterm
   use threadbox_module, only : build_threadbox_2d, get_lo_hi
+  use dt_bound_module, only : dt_bound_on, dt_bound_adv
   implicit none
 
   integer, intent(in) :: lo(2), hi(2), domlo(2), domhi(2)
@@ -25,7 +26,7 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
 
   integer :: Ulo(2), Uhi(2), fxlo(2), fxhi(2), fylo(2), fyhi(2), tlo(2), thi(2)
   integer :: iblock, nblocks, i, j, n, ib, jb, nb(2), boxsize(2)
-  double precision :: dxinv(2)
+  double precision :: dxinv(2), dtb
   double precision, allocatable :: bxflx(:,:,:), byflx(:,:,:)
   integer, allocatable :: bxlo(:), bxhi(:), bylo(:), byhi(:)
 
@@ -61,9 +62,11 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
 
   nblocks = nb(1)*nb(2)
 
+  dtb = 1.d50
+
   !$omp parallel private(fxlo,fxhi,fylo,fyhi,tlo,thi,i,j,n,ib,jb,bxflx,byflx,iblock)
   
-  !$omp do
+  !$omp do reduction(min:dtb)
   do iblock = 0, nblocks-1
      
      jb = iblock / nb(1)
@@ -95,6 +98,10 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
         call hypterm(tlo,thi,domlo,domhi,U,Ulo,Uhi,bxflx,fxlo,fxhi,byflx,fylo,fyhi,dx)
      end if
      call difterm(tlo,thi,domlo,domhi,U,Ulo,Uhi,bxflx,fxlo,fxhi,byflx,fylo,fyhi,dx)
+
+     if (dt_bound_on) then
+        call rns_estdt_box(U,U_l1,U_l2,U_h1,U_h2,tlo,thi,dx,dtb)
+     end if
      
      ! Note that fluxes are on faces.  So don't double count!
      if (thi(1) .ne. hi(1)) fxhi(1) = fxhi(1) - 1
@@ -143,6 +150,8 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   
   !$omp end parallel
 
+  if (dt_bound_on) dt_bound_adv = min(dt_bound_adv, dtb)
+
   deallocate(bxlo,bxhi,bylo,byhi)
 
 end subroutine rns_dudt_ad
@@ -241,37 +250,42 @@ end subroutine rns_dUdt_chem
 
 subroutine rns_compute_temp(lo,hi,U,U_l1,U_l2,U_h1,U_h2)
   use meth_params_module, only : NVAR, URHO, UMX, UMY, UEDEN, UTEMP, UFS, NSPEC
-  use eos_module, only : eos_get_T
+  use eos_module, only : eos_get_T_row
   implicit none
   
   integer, intent(in) :: lo(2), hi(2)
   integer, intent(in) :: U_l1, U_l2, U_h1, U_h2
   double precision, intent(inout) :: U(U_l1:U_h1,U_l2:U_h2,NVAR)
 
-  integer :: i, j, pt_index(2), ierr
-  double precision :: rhoInv, e, vx, vy, Y(NSPEC)
+  integer :: i, j, n, ierr(lo(1):hi(1))
+  double precision :: rhoInv, vx, vy
+  double precision :: e(lo(1):hi(1)), T(lo(1):hi(1)), Y(lo(1):hi(1),NSPEC)
 
-  !$omp parallel do private(i,j,rhoInv,e,vx,vy,Y,pt_index,ierr)
+  !$omp parallel do private(i,j,n,rhoInv,vx,vy,e,T,Y,ierr)
   do j=lo(2),hi(2)
-  do i=lo(1),hi(1)
-     pt_index(1) = i
-     pt_index(2) = j
+     do i=lo(1),hi(1)
+        rhoInv = 1.0d0/U(i,j,URHO)
 
-     rhoInv = 1.0d0/U(i,j,URHO)
+        vx = U(i,j,UMX)*rhoInv     
+        vy = U(i,j,UMY)*rhoInv     
+        e(i) = U(i,j,UEDEN)*rhoInv - 0.5d0*(vx**2+vy**2)
 
-     vx = U(i,j,UMX)*rhoInv     
-     vy = U(i,j,UMY)*rhoInv     
-     e  = U(i,j,UEDEN)*rhoInv - 0.5d0*(vx**2+vy**2)
+        do n=1,NSPEC
+           Y(i,n) = U(i,j,UFS+n-1)*rhoInv
+        end do
 
-     Y = U(i,j,UFS:UFS+NSPEC-1)*rhoInv
+        T(i) = U(i,j,UTEMP)
+     end do
 
-     call eos_get_T(U(i,j,UTEMP), e, Y, pt_index, ierr)
+     call eos_get_T_row(hi(1)-lo(1)+1, T, e, Y, ierr)
 
-     if (ierr .ne. 0) then
-        print *, 'rns_compute_temp failed at ', i,j,U(i,j,:)
-        call bl_error("rns_compute_temp failed")
-     end if
-  end do
+     do i=lo(1),hi(1)
+        if (ierr(i) .ne. 0) then
+           print *, 'rns_compute_temp failed at ', i,j,U(i,j,:)
+           call bl_error("rns_compute_temp failed")
+        end if
+        U(i,j,UTEMP) = T(i)
+     end do
   end do
   !$omp end parallel do
 end subroutine rns_compute_temp
@@ -419,6 +433,33 @@ end subroutine rns_sum_cons
 ! :::
 
       subroutine rns_estdt(u,u_l1,u_l2,u_h1,u_h2,lo,hi,dx,dt)
+        use meth_params_module, only : NVAR
+        implicit none
+
+        integer u_l1,u_l2,u_h1,u_h2
+        integer lo(2), hi(2)
+        double precision u(u_l1:u_h1,u_l2:u_h2,NVAR)
+        double precision dx(2), dt
+
+        integer :: j, rlo(2), rhi(2)
+
+        !$omp parallel do private(j,rlo,rhi) reduction(min:dt)
+        do j = lo(2), hi(2)
+           rlo = (/ lo(1), j /)
+           rhi = (/ hi(1), j /)
+           call rns_estdt_box(u,u_l1,u_l2,u_h1,u_h2,rlo,rhi,dx,dt)
+        end do
+        !$omp end parallel do
+
+      end subroutine rns_estdt
+
+! :::
+! ::: ------------------------------------------------------------------
+! :::
+
+      ! rns_estdt on lo:hi by the calling thread alone, for callers that
+      ! are threaded already.
+      subroutine rns_estdt_box(u,u_l1,u_l2,u_h1,u_h2,lo,hi,dx,dt)
         use eos_module, only : eos_get_c
         use meth_params_module, only : NVAR, URHO, UMX, UMY, UEDEN, UTEMP, UFS, NSPEC
         implicit none
@@ -431,7 +472,6 @@ end subroutine rns_sum_cons
         integer :: i, j
         double precision :: rhoInv, vx, vy, T, e, c, Y(NSPEC)
 
-        !$omp parallel do private(i,j,rhoInv,vx,vy,T,e,c,Y) reduction(min:dt)
         do j = lo(2), hi(2)
         do i = lo(1), hi(1)
            rhoInv = 1.d0/u(i,j,URHO)
@@ -449,6 +489,5 @@ end subroutine rns_sum_cons
            dt = min(dt, dx(1)/(abs(vx)+c+1.d-50), dx(2)/(abs(vy)+c+1.d-50))
         end do
         end do
-        !$omp end parallel do
 
-      end subroutine rns_estdt
+      end subroutine rns_estdt_box
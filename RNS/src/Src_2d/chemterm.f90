@@ -1,9 +1,10 @@
 module chemterm_module
 
   use meth_params_module
-  use burner_module, only : burn, compute_rhodYdt, splitburn, beburn
+  use burner_module, only : burn, compute_rhodYdt, splitburn, beburn, burn_box_done
   use eos_module, only : eos_get_T
   use renorm_module, only : floor_species
+  use chem_adapt_module, only : chem_adapt_select
   use passinfo_module, only : level, iteration, time
 
   implicit none
@@ -36,6 +37,8 @@ contains
           call bl_error("unknown chem_solver")
        end select
 
+    call burn_box_done()
+
   end subroutine chemterm
 
 
@@ -158,7 +161,7 @@ contains
     double precision, intent(inout) :: st(stlo(1):sthi(1),stlo(2):sthi(2))
     double precision, intent(in) :: dt
 
-    integer :: i, j, n, g, ierr
+    integer :: i, j, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(4), Yt(nspec+1,4),fac
     double precision, allocatable :: UG(:,:,:,:)
@@ -184,7 +187,7 @@ contains
        !$omp end parallel do
     end if
 
-    !$omp parallel private(i,j,n,g,ierr,rhot,Yt,force_new_J)
+    !$omp parallel private(i,j,n,g,ng,ierr,rhot,Yt,force_new_J)
 
     force_new_J = .true.  ! always recompute Jacobian when a new FAB starts
 
@@ -203,8 +206,13 @@ contains
              end do
           end if
 
+          ng = 4
+          if (st(i,j) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+             call chem_adapt_select(4, rhot, Yt, ng)
+          end if
+
           if (st(i,j) .eq. 0.d0) then
-             call burn(4, rhot, Yt, dt, force_new_J)
+             call burn(ng, rhot(1:ng), Yt(:,1:ng), dt, force_new_J, ierr)
              if (ierr .ne. 0) then
                 st(i,j) = -1.d0
                 force_new_J = .true.
@@ -216,9 +224,9 @@ contains
           if (st(i,j) .eq. 0.d0) then
 
              U(i,j,UFS:UFS+nspec-1) = 0.d0 
-             do g=1,4
+             do g=1,ng
                 do n=1,nspec
-                   U(i,j,UFS+n-1) = U(i,j,UFS+n-1) + 0.25d0*rhot(g)*Yt(n,g)
+                   U(i,j,UFS+n-1) = U(i,j,UFS+n-1) + rhot(g)*Yt(n,g)/ng
                 end do
              end do
              
@@ -263,7 +271,7 @@ contains
     double precision, intent(inout) :: st(stlo(1):sthi(1),stlo(2):sthi(2))
     double precision, intent(in) :: dt
 
-    integer :: i, j, n, g, ierr
+    integer :: i, j, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(4), rho0(1), fac
     double precision :: Yt(nspec+1,4), YT0(nspec+1)
@@ -290,7 +298,7 @@ contains
        !$omp end parallel do
     end if
 
-    !$omp parallel private(i,j,n,g,ierr,rhot,Yt,force_new_J,rho0,YT0)
+    !$omp parallel private(i,j,n,g,ng,ierr,rhot,Yt,force_new_J,rho0,YT0)
 
     force_new_J = .true.  ! always recompute Jacobina when a new FAB starts
 
@@ -313,6 +321,11 @@ contains
              end do
           end if
 
+          ng = 4
+          if (st(i,j) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+             call chem_adapt_select(4, rhot, Yt, ng)
+          end if
+
           if (st(i,j) .eq. 0.d0) then
              call burn(1, rho0, YT0, dt, force_new_J, ierr)
              if (ierr .ne. 0) then
@@ -323,7 +336,14 @@ contains
              end if
           end if
 
-          if (st(i,j) .eq. 0.d0) then
+          if (st(i,j) .eq. 0.d0 .and. ng .eq. 1) then
+
+             ! smooth cell: keep the burned average
+             do n=1,nspec
+                U(i,j,UFS+n-1) = rho0(1)*YT0(n)
+             end do
+
+          else if (st(i,j) .eq. 0.d0) then
 
              call splitburn(4, rho0(1), YT0, rhot, Yt, dt) 
              ! Now Yt is \Delta Y and T
@@ -504,7 +524,7 @@ contains
     double precision, intent(in) :: dt
     double precision, intent(in), optional :: Up(lo(1):hi(1),lo(2):hi(2),NVAR)
 
-    integer :: i, j, n, g, ierr
+    integer :: i, j, n, g, ng, ierr
     logical :: force_new_J
     double precision :: rhot(4), rho0(1), fac
     double precision :: Yt(nspec+1,4), YT0(nspec+1), rhoY(nspec)
@@ -531,7 +551,7 @@ contains
        !$omp end parallel do
     end if
 
-    !$omp parallel private(i,j,n,g,ierr,rhot,Yt,force_new_J,rho0,YT0,rhoY)
+    !$omp parallel private(i,j,n,g,ng,ierr,rhot,Yt,force_new_J,rho0,YT0,rhoY)
 
     force_new_J = .true.  ! always recompute Jacobina when a new FAB starts
 
@@ -550,6 +570,11 @@ contains
              end do
           end if
 
+          ng = 4
+          if (st(i,j) .eq. 0.d0 .and. chem_adapt_tol .gt. 0.d0) then
+             call chem_adapt_select(4, rhot, Yt, ng)
+          end if
+
           if (st(i,j) .eq. 0.d0) then
 
              if (present(Up)) then
@@ -576,7 +601,7 @@ contains
              call floor_species(nspec, YT0(1:nspec))
 
              rhoY = 0.d0
-             do g=1,4
+             do g=1,ng
                 call beburn(rho0(1), YT0, rhot(g), Yt(:,g), dt, g, ierr)
                 if (ierr .ne. 0) then ! beburn failed
                    st(i,j) = -1.d0
@@ -584,7 +609,7 @@ contains
                    exit
                 end if
                 do n=1,nspec
-                   rhoY(n) = rhoY(n) + 0.25d0*rhot(g)*Yt(n,g)
+                   rhoY(n) = rhoY(n) + rhot(g)*Yt(n,g)/ng
                 end do
              end do
 
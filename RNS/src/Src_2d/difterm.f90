@@ -15,6 +15,7 @@ contains
     use polyinterp_module, only : cc2xface_2d, cc2yface_2d, cc2DxYface_2d, cc2DyXface_2d
     use variables_module, only : ctoprim
     use transport_properties, only : get_transport_properties
+    use dt_bound_module, only : dt_bound_on
 
     integer, intent(in) :: lo(2), hi(2), domlo(2), domhi(2), Ulo(2), Uhi(2), &
          fxlo(2), fxhi(2), fylo(2), fyhi(2)
@@ -64,6 +65,10 @@ contains
     call get_transport_properties(tlo,thi, Qcc,tlo,thi,QFVAR, &
          mucc,xicc,lamcc,Ddiacc, tlo,thi)
 
+    if (dt_bound_on) then
+       call diff_dt_bound(lo,hi,Qcc,Ddiacc,g2lo,g2hi,dx)
+    end if
+
     Qflo = lo
     Qfhi = hi+1
 
@@ -185,12 +190,51 @@ contains
   end subroutine difterm
 
 
+  ! Lower dt_bound_diff with the diffusive time step limit on lo:hi, computed
+  ! as in rns_estdt_ad from the cell-centered state and coefficients.
+  subroutine diff_dt_bound(lo,hi,Q,Ddia,clo,chi,dx)
+    use meth_params_module, only : NSPEC, QFVAR, QRHO, QFX
+    use chemistry_module, only : molecular_weight, inv_mwt
+    use dt_bound_module, only : dt_bound_diff
+    integer, intent(in) :: lo(2), hi(2), clo(2), chi(2)
+    double precision, intent(in) ::    Q(clo(1):chi(1),clo(2):chi(2),QFVAR)
+    double precision, intent(in) :: Ddia(clo(1):chi(1),clo(2):chi(2),NSPEC)
+    double precision, intent(in) :: dx(2)
+
+    integer :: i, j, n
+    double precision :: Wbar, D, dt
+
+    dt = 1.d50
+
+    do j=lo(2),hi(2)
+       do i=lo(1),hi(1)
+          Wbar = 0.d0
+          do n=1,NSPEC
+             Wbar = Wbar + Q(i,j,QFX+n-1)*molecular_weight(n)
+          end do
+          D = 0.d0
+          do n=1,NSPEC
+             D = max(D, Ddia(i,j,n)*Wbar*inv_mwt(n))
+          end do
+          dt = min(dt, Q(i,j,QRHO)/D)
+       end do
+    end do
+
+    dt = dt * 0.5d0*(min(dx(1),dx(2)))**2
+
+    !$omp atomic
+    dt_bound_diff = min(dt_bound_diff, dt)
+
+  end subroutine diff_dt_bound
+
+
   subroutine comp_diff_flux_x(lo, hi, flx, flo, fhi, &
        Qf, mu, xi, lam, Ddia, dvel, Qflo, Qfhi, &
        Qc, Qclo, Qchi, dxinv, fac, domlo, domhi)
 
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
 
     integer, intent(in) :: lo(2), hi(2), flo(2), fhi(2), Qflo(2), Qfhi(2), Qclo(2), Qchi(2), domlo(2), domhi(2)
     double precision, intent(in) :: dxinv(2), fac
@@ -205,9 +249,10 @@ contains
 
     integer :: i, j, n, UYN, QYN, QXN, QHN
     double precision :: tauxx, tauxy, dudx, dudy, dvdx, dvdy, divu
-    double precision :: dTdx, dXdx, Vd
+    double precision :: dTdx, dXdx
     double precision :: ek, rhovn
     double precision, dimension(lo(1):hi(1)) :: dlnpdx, Vc
+    double precision, dimension(lo(1):hi(1),NSPEC) :: dk, Vd
     double precision, parameter :: twoThirds = 2.d0/3.d0
 
     do j=lo(2),hi(2)
@@ -238,18 +283,28 @@ contains
        end do
 
        do n=1,NSPEC
-          UYN = UFS+n-1
           QYN = QFY+n-1
           QXN = QFX+n-1
-          QHN = QFH+n-1
           do i = lo(1), hi(1)
              dXdx = dxinv(1) * (FD4(-2)*Qc(i-2,j,QXN) + FD4(-1)*Qc(i-1,j,QXN) &
                   + FD4(0)*Qc(i,j,QXN) + FD4(1)*Qc(i+1,j,QXN))
-             Vd = -Ddia(i,j,n)*(dXdx + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdx(i))
-             
-             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd
-             Vc(i) = Vc(i) + Vd
-             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd*Qf(i,j,QHN)
+             dk(i,n) = dXdx + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdx(i)
+             Vd(i,n) = -Ddia(i,j,n)*dk(i,n)
+          end do
+       end do
+
+       if (mc_diff_iters .gt. 0) then
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk, Vd)
+       end if
+
+       do n=1,NSPEC
+          UYN = UFS+n-1
+          QHN = QFH+n-1
+          do i = lo(1), hi(1)
+             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd(i,n)
+             Vc(i) = Vc(i) + Vd(i,n)
+             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd(i,n)*Qf(i,j,QHN)
           end do
        end do
 
@@ -293,6 +348,7 @@ contains
     use prob_params_module, only : physbc_lo, physbc_hi, NoSlipWall
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
     use RNS_boundary_module, only : Twall
 
     integer, intent(in) :: lo(2), hi(2), flo(2), fhi(2), Qflo(2), Qfhi(2), Qclo(2), Qchi(2), domlo(2), domhi(2)
@@ -308,12 +364,15 @@ contains
 
     integer :: i, j, n, UYN, QYN, QXN, QHN, jstart
     double precision :: tauyy, tauxy, dudx, dudy, dvdx, dvdy, divu
-    double precision :: dTdy, dXdy, Vd
+    double precision :: dTdy, dXdy
     double precision :: ek, rhovn
     double precision :: dlnpdytmp, Vctmp, foo
-    double precision, allocatable :: dlnpdy(:,:), Vc(:,:)
+    double precision, allocatable :: dlnpdy(:,:), Vc(:,:), dk(:,:,:), Vd(:,:,:)
     double precision, parameter :: twoThirds = 2.d0/3.d0
 
+    allocate(dk(lo(1):hi(1),lo(2):hi(2),NSPEC))
+    allocate(Vd(lo(1):hi(1),lo(2):hi(2),NSPEC))
+
     jstart = lo(2)
 
     if (lo(2).eq.domlo(2) .and. physbc_lo(2).eq.NoSlipWall) then
@@ -363,21 +422,32 @@ contains
           dlnpdytmp = dxinv(2) * (Qc(i,lo(2)+1,QPRES) - Qc(i,lo(2),QPRES)) &
                / (0.5d0*(Qc(i,lo(2),QPRES) + Qc(i,lo(2)+1,QPRES)))
 
-          Vctmp = 0.d0
-
           do n=1,NSPEC
-             UYN = UFS+n-1
              QYN = QFY+n-1
              QXN = QFX+n-1
-             QHN = QFH+n-1
 
              dXdy = dxinv(2) * (Qc(i,lo(2)+1,QXN) - Qc(i,lo(2),QXN))
-             Vd = -Ddia(i,j,n)*(dXdy + dlnpdytmp* &
+             dk(i,j,n) = dXdy + dlnpdytmp* &
                   0.5d0*(Qc(i,lo(2),QXN)+Qc(i,lo(2)+1,QXN) &
-                  &    - Qc(i,lo(2),QYN)-Qc(i,lo(2)+1,QYN)) ) 
-             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd
-             Vctmp = Vctmp + Vd
-             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd*Qf(i,j,QHN)
+                  &    - Qc(i,lo(2),QYN)-Qc(i,lo(2)+1,QYN))
+             Vd(i,j,n) = -Ddia(i,j,n)*dk(i,j,n)
+          end do
+       end do
+
+       if (mc_diff_iters .gt. 0) then
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk(:,j,:), Vd(:,j,:))
+       end if
+
+       do i=lo(1),hi(1)
+          Vctmp = 0.d0
+
+          do n=1,NSPEC
+             UYN = UFS+n-1
+             QHN = QFH+n-1
+             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd(i,j,n)
+             Vctmp = Vctmp + Vd(i,j,n)
+             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd(i,j,n)*Qf(i,j,QHN)
           end do
 
           do n=1,NSPEC
@@ -423,19 +493,33 @@ contains
     end do
 
     do n=1,NSPEC
-       UYN = UFS+n-1
        QYN = QFY+n-1
        QXN = QFX+n-1
-       QHN = QFH+n-1
        do j = jstart, hi(2)
           do i = lo(1), hi(1)
              dXdy = dxinv(2) * (FD4(-2)*Qc(i,j-2,QXN) + FD4(-1)*Qc(i,j-1,QXN) &
                   + FD4(0)*Qc(i,j,QXN) + FD4(1)*Qc(i,j+1,QXN))
-             Vd = -Ddia(i,j,n)*(dXdy + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdy(i,j))
-             
-             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd
-             Vc(i,j) = Vc(i,j) + Vd
-             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd*Qf(i,j,QHN)
+             dk(i,j,n) = dXdy + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdy(i,j)
+             Vd(i,j,n) = -Ddia(i,j,n)*dk(i,j,n)
+          end do
+       end do
+    end do
+
+    if (mc_diff_iters .gt. 0) then
+       do j = jstart, hi(2)
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk(:,j,:), Vd(:,j,:))
+       end do
+    end if
+
+    do n=1,NSPEC
+       UYN = UFS+n-1
+       QHN = QFH+n-1
+       do j = jstart, hi(2)
+          do i = lo(1), hi(1)
+             flx(i,j,UYN) = flx(i,j,UYN) + fac*Vd(i,j,n)
+             Vc(i,j) = Vc(i,j) + Vd(i,j,n)
+             flx(i,j,UEDEN) = flx(i,j,UEDEN) + fac*Vd(i,j,n)*Qf(i,j,QHN)
           end do
        end do
     end do
@@ -452,7 +536,7 @@ contains
        end do
     end do
 
-    deallocate(dlnpdy,Vc)
+    deallocate(dlnpdy,Vc,dk,Vd)
     
     if (.not. do_weno) then
        ! compute hyperbolic flux
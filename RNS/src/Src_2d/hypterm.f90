@@ -30,12 +30,8 @@ contains
 
   subroutine hypterm_x(lo,hi,domlo,domhi,U,Ulo,Uhi,fx,fxlo,fxhi,dx)
 
-    use meth_params_module, only : NVAR, URHO, UMX, UMY, UTEMP, UFS, UEDEN, NSPEC, NCHARV, CFS, do_mdcd
-    use eigen_module, only : get_eigen_matrices
-    use renorm_module, only : floor_species
-    use eos_module, only : eos_get_eref
-    use mdcd_module, only : mdcd
-    use weno_module, only : weno4_gauss, weno5_face
+    use meth_params_module, only : NVAR, UMX, UMY, UMZ
+    use charrecon_module, only : char_recon_face, char_recon_gauss
     use riemann_module, only : riemann
     use RNS_boundary_module, only : get_hyper_bc_flag
 
@@ -44,18 +40,11 @@ contains
     double precision, intent(in   ) ::  U( Ulo(1): Uhi(1), Ulo(2): Uhi(2),NVAR)
     double precision, intent(inout) :: fx(fxlo(1):fxhi(1),fxlo(2):fxhi(2),NVAR)
 
-    integer :: i, j, n, ii, jj, ivar, m, g, bc_flag(2)
-    double precision, allocatable :: Y(:,:), RoeW(:), v(:,:), flux(:,:)
+    integer :: i, j, n, g, bc_flag(2)
+    double precision, allocatable :: flux(:,:), Up(:,:), UG1p(:,:), UG2p(:,:)
     double precision, dimension(:,:,:), allocatable, target :: UG1,UG2
-    double precision, dimension(:,:)  , allocatable, target :: UL,UR
+    double precision, dimension(:,:)  , allocatable :: UL,UR
     double precision, dimension(:,:,:), pointer :: UG
-    double precision :: rhoInv, rho0, Y0(nspec), T0, v0(3), fac, eref
-    double precision :: egv1(NCHARV,NCHARV), egv2(NCHARV,NCHARV), Uch(NCHARV), charv(-3:2,NCHARV)
-    double precision :: cvl(NCHARV), cvr(NCHARV)
-
-    allocate(Y   (lo(1)-3:hi(1)+3,nspec))
-    allocate(RoeW(lo(1)-3:hi(1)+3))
-    allocate(v   (lo(1)-3:hi(1)+3,2))
 
     allocate(flux(lo(1):hi(1)+1,NVAR))
 
@@ -67,92 +56,34 @@ contains
     allocate(UL(lo(1):hi(1)+1,NVAR))
     allocate(UR(lo(1):hi(1)+1,NVAR))
 
-    UG1 = 0.d0
-    UG2 = 0.d0
-
-    do j = lo(2), hi(2)
-       do i = lo(1)-3, hi(1)+3
-          ! given U(i,j-2:j+2,:), compute UG1 and UG2
-          rho0 = U(i,j,URHO)
-          rhoInv = 1.d0/rho0
-          do n=1,nspec
-             Y0(n) = U(i,j,UFS+n-1)*rhoInv
-          end do
-          v0(1) = U(i,j,UMY) * rhoInv
-          v0(2) = U(i,j,UMX) * rhoInv
-          v0(3) = 0.d0
-          T0 = U(i,j,UTEMP)
-
-          ! egv1: left matrix;  egv2: right matrix
-          call get_eigen_matrices(rho0, Y0, T0, v0, egv1, egv2)
-
-          do jj=-2,2
-             Uch(1) = U(i,j+jj,UMY)
-             Uch(2) = U(i,j+jj,UMX)
-             Uch(3) = 0.d0
-             Uch(4) = U(i,j+jj,UEDEN)
-             rhoinV = 1.d0/U(i,j+jj,URHO)
-             do n=1,nspec
-                Uch(CFS+n-1) = U(i,j+jj,UFS+n-1)
-                Y0(n) = Uch(CFS+n-1)*rhoInv
-             end do
-             eref = eos_get_eref(Y0)
-             Uch(4) = Uch(4) - U(i,j+jj,URHO)*eref
+    ! y-pencils
+    allocate(Up  (lo(2)-2:hi(2)+2,NVAR))
+    allocate(UG1p(lo(2)  :hi(2)  ,NVAR))
+    allocate(UG2p(lo(2)  :hi(2)  ,NVAR))
 
-             do n=1,NCHARV
-                charv(jj,n) = dot_product(egv1(:,n),Uch)
-             end do
-          end do
-          
-          do ivar=1,NCHARV
-             call weno4_gauss(charv(-2:2,ivar), cvl(ivar), cvr(ivar))
+    do i = lo(1)-3, hi(1)+3
+       ! given U(i,j-2:j+2,:), compute UG1 and UG2
+       do n=1,NVAR
+          do j = lo(2)-2, hi(2)+2
+             Up(j,n) = U(i,j,n)
           end do
+       end do
 
-          egv1 = transpose(egv2)  ! egv1 now holds transposed right matrix
+       call char_recon_gauss(lo(2),hi(2), Up,lo(2)-2,hi(2)+2, (/UMY,UMX,UMZ/), &
+            UG1p,UG2p,lo(2),hi(2))
 
-          do n=1,NCHARV
-             UG1(i,j,UMY  ) = UG1(i,j,UMY  ) + cvl(n)*egv2(1,n)
-             UG2(i,j,UMY  ) = UG2(i,j,UMY  ) + cvr(n)*egv2(1,n)
-             UG1(i,j,UMX  ) = UG1(i,j,UMX  ) + cvl(n)*egv2(2,n)
-             UG2(i,j,UMX  ) = UG2(i,j,UMX  ) + cvr(n)*egv2(2,n)
-             UG1(i,j,UEDEN) = UG1(i,j,UEDEN) + cvl(n)*egv2(4,n)
-             UG2(i,j,UEDEN) = UG2(i,j,UEDEN) + cvr(n)*egv2(4,n)
-          end do
-          
-          do m=1,nspec
-             UG1(i,j,UFS+m-1) = UG1(i,j,UFS+m-1) + dot_product(cvl, egv1(:,CFS+m-1))
-             UG2(i,j,UFS+m-1) = UG2(i,j,UFS+m-1) + dot_product(cvr, egv1(:,CFS+m-1))
-             UG1(i,j,URHO   ) = UG1(i,j,URHO   ) + UG1(i,j,UFS+m-1)
-             UG2(i,j,URHO   ) = UG2(i,j,URHO   ) + UG2(i,j,UFS+m-1)
-          end do
-          
-          rhoInv = 1.d0/UG1(i,j,URHO)
-          do n=1,nspec
-             Y0(n) = UG1(i,j,UFS+n-1) * rhoInv
-          end do
-          call floor_species(nspec, Y0)
-          eref = eos_get_eref(Y0)
-          UG1(i,j,UEDEN) = UG1(i,j,UEDEN) + UG1(i,j,URHO) * eref
-          do n=1,nspec
-             UG1(i,j,UFS+n-1) = UG1(i,j,URHO)*Y0(n)
-          end do
-          
-          rhoInv = 1.d0/UG2(i,j,URHO)
-          do n=1,nspec
-             Y0(n) = UG2(i,j,UFS+n-1) * rhoInv
+       do n=1,NVAR
+          do j = lo(2), hi(2)
+             UG1(i,j,n) = UG1p(j,n)
+             UG2(i,j,n) = UG2p(j,n)
           end do
-          call floor_species(nspec, Y0)
-          eref = eos_get_eref(Y0)
-          UG2(i,j,UEDEN) = UG2(i,j,UEDEN) + UG2(i,j,URHO) * eref
-          do n=1,nspec
-             UG2(i,j,UFS+n-1) = UG2(i,j,URHO)*Y0(n)
-          end do
-          
-          UG1(i,j,UTEMP) = U(i,j,UTEMP)
-          UG2(i,j,UTEMP) = U(i,j,UTEMP)
        end do
     end do
 
+    deallocate(Up,UG1p,UG2p)
+
+    allocate(Up(lo(1)-3:hi(1)+3,NVAR))
+
     do g = 1, 2
        if (g.eq.1) then
           UG => UG1
@@ -162,104 +93,14 @@ contains
 
        do j = lo(2), hi(2)
           ! given UG(i-3:i+2,j,:), compute UL(i,:) and UR(i,:)
-          UL = 0.d0
-          UR = 0.d0
-
-          do i = lo(1)-3, hi(1)+3
-             rhoInv = 1.d0/UG(i,j,URHO)
-             RoeW(i) = sqrt(UG(i,j,URHO))
-             do n=1,nspec
-                Y(i,n) = UG(i,j,UFS+n-1)*rhoInv
+          do n=1,NVAR
+             do i = lo(1)-3, hi(1)+3
+                Up(i,n) = UG(i,j,n)
              end do
-             v(i,1) = UG(i,j,UMX)*rhoInv
-             v(i,2) = UG(i,j,UMY)*rhoInv
           end do
-          
-          do i = lo(1), hi(1)+1
-             rho0 = RoeW(i-1)*RoeW(i)
-             fac = 1.d0/(RoeW(i-1)+RoeW(i))
-             Y0 = (Y(i-1,:)*RoeW(i-1)+Y(i,:)*RoeW(i))*fac
-             T0 = (UG(i-1,j,UTEMP)*RoeW(i-1)+UG(i,j,UTEMP)*RoeW(i))*fac
-             v0(1) = (v(i-1,1)*RoeW(i-1)+v(i,1)*RoeW(i))*fac
-             v0(2) = (v(i-1,2)*RoeW(i-1)+v(i,2)*RoeW(i))*fac
-             v0(3) = 0.d0
-             
-             call floor_species(nspec,Y0)
-             
-             ! egv1: left matrix;  egv2: right matrix
-             call get_eigen_matrices(rho0, Y0, T0, v0, egv1, egv2)
-
-             do ii=-3,2
-                Uch(1) = UG(i+ii,j,UMX)
-                Uch(2) = UG(i+ii,j,UMY)
-                Uch(3) = 0.d0  ! because of 2d
-                Uch(4) = UG(i+ii,j,UEDEN)
-                
-                eref = eos_get_eref(Y(i+ii,:))
-                Uch(4) = Uch(4) - UG(i+ii,j,URHO) * eref
-                
-                do n=1,nspec
-                   Uch(CFS+n-1) = UG(i+ii,j,UFS+n-1)
-                end do
-                
-                do n=1,NCHARV
-                   charv(ii,n) = dot_product(egv1(:,n),Uch)
-                end do
-             end do
 
-             if (do_mdcd) then
-                do ivar=1,NCHARV
-                   call mdcd(charv(:,ivar), cvl(ivar), cvr(ivar))
-                end do
-             else
-                do ivar=1,NCHARV
-                   call weno5_face(charv(:,ivar), cvl(ivar), cvr(ivar))
-                end do
-             end if
-             
-             egv1 = transpose(egv2)  ! egv1 now holds transposed right matrix
-             
-             do n=1,NCHARV
-                UL(i,UMX  ) = UL(i,UMX  ) + cvl(n)*egv2(1,n)
-                UR(i,UMX  ) = UR(i,UMX  ) + cvr(n)*egv2(1,n)
-                UL(i,UMY  ) = UL(i,UMY  ) + cvl(n)*egv2(2,n)
-                UR(i,UMY  ) = UR(i,UMY  ) + cvr(n)*egv2(2,n)
-                UL(i,UEDEN) = UL(i,UEDEN) + cvl(n)*egv2(4,n)
-                UR(i,UEDEN) = UR(i,UEDEN) + cvr(n)*egv2(4,n)
-             end do
-             
-             do m=1,nspec
-                UL(i,UFS+m-1) = UL(i,UFS+m-1) + dot_product(cvl, egv1(:,CFS+m-1))
-                UR(i,UFS+m-1) = UR(i,UFS+m-1) + dot_product(cvr, egv1(:,CFS+m-1))
-                UL(i,URHO   ) = UL(i,URHO) + UL(i,UFS+m-1)
-                UR(i,URHO   ) = UR(i,URHO) + UR(i,UFS+m-1)
-             end do
-             
-             rhoInv = 1.d0/UL(i,URHO)
-             do n=1,nspec
-                Y0(n) = UL(i,UFS+n-1) * rhoInv
-             end do
-             call floor_species(nspec, Y0)
-             eref = eos_get_eref(Y0)
-             UL(i,UEDEN) = UL(i,UEDEN) + UL(i,URHO) * eref
-             do n=1,nspec
-                UL(i,UFS+n-1) = UL(i,URHO)*Y0(n)
-             end do
-             
-             rhoInv = 1.d0/UR(i,URHO)
-             do n=1,nspec
-                Y0(n) = UR(i,UFS+n-1) * rhoInv
-             end do
-             call floor_species(nspec, Y0)
-             eref = eos_get_eref(Y0)
-             UR(i,UEDEN) = UR(i,UEDEN) + UR(i,URHO) * eref
-             do n=1,nspec
-                UR(i,UFS+n-1) = UR(i,URHO)*Y0(n)
-             end do
-             
-             UL(i,UTEMP) = T0
-             UR(i,UTEMP) = T0
-          end do
+          call char_recon_face(lo(1),hi(1), Up,lo(1)-3,hi(1)+3, (/UMX,UMY,UMZ/), &
+               UL,UR,lo(1),hi(1)+1)
 
           call get_hyper_bc_flag(1,(/lo(1),j/),(/hi(1)+1,j/),domlo,domhi,dx,bc_flag)
 
@@ -275,7 +116,7 @@ contains
        Nullify(UG)
     end do
 
-    deallocate(Y, RoeW, v, flux)
+    deallocate(Up, flux)
     deallocate(UG1,UG2,UL,UR)
     
   end subroutine hypterm_x
@@ -283,12 +124,8 @@ contains
 
   subroutine hypterm_y(lo,hi,domlo,domhi,U,Ulo,Uhi,fy,fylo,fyhi,dx)
 
-    use meth_params_module, only : NVAR, URHO, UMX, UMY, UTEMP, UFS, UEDEN, NSPEC, NCHARV, CFS, do_mdcd
-    use eigen_module, only : get_eigen_matrices
-    use renorm_module, only : floor_species
-    use eos_module, only : eos_get_eref
-    use mdcd_module, only : mdcd
-    use weno_module, only : weno4_gauss, weno5_face
+    use meth_params_module, only : NVAR, UMX, UMY, UMZ
+    use charrecon_module, only : char_recon_face, char_recon_gauss
     use riemann_module, only : riemann
     use RNS_boundary_module, only : get_hyper_bc_flag
 
@@ -297,15 +134,11 @@ contains
     double precision, intent(in   ) ::  U( Ulo(1): Uhi(1), Ulo(2): Uhi(2),NVAR)
     double precision, intent(inout) :: fy(fylo(1):fyhi(1),fylo(2):fyhi(2),NVAR)
 
-    integer :: i, j, n, ii, jj, ivar, m, g, bc_flag(2)
-    double precision :: RoeWl, RoeWr, rhoInvl, rhoInvr
-    double precision, allocatable :: flux(:,:)
+    integer :: i, j, n, g, bc_flag(2)
+    double precision, allocatable :: flux(:,:), Up(:,:), UG1p(:,:), UG2p(:,:)
     double precision, dimension(:,:,:), allocatable, target :: UG1,UG2
-    double precision, dimension(:,:),   allocatable, target :: UL,UR
+    double precision, dimension(:,:),   allocatable :: UL,UR
     double precision, dimension(:,:,:), pointer :: UG
-    double precision :: rhoInv, rho0, Y0(nspec), T0, v0(3), fac, eref
-    double precision :: egv1(NCHARV,NCHARV), egv2(NCHARV,NCHARV), Uch(NCHARV), charv(-3:2,NCHARV)
-    double precision :: cvl(NCHARV), cvr(NCHARV)
     
     allocate(flux(lo(2):hi(2)+1,NVAR))
 
@@ -314,194 +147,51 @@ contains
     allocate(UL(lo(2):hi(2)+1,NVAR))
     allocate(UR(lo(2):hi(2)+1,NVAR))
 
-    UG1 = 0.d0
-    UG2 = 0.d0
-    
+    ! given U(i-2:i+2,j,:), compute UG1(i,j,:) and UG2(i,j,:)
+    allocate(Up  (lo(1)-2:hi(1)+2,NVAR))
+    allocate(UG1p(lo(1)  :hi(1)  ,NVAR))
+    allocate(UG2p(lo(1)  :hi(1)  ,NVAR))
+
     do j = lo(2)-3, hi(2)+3
-       do i = lo(1), hi(1)
-          ! given U(i-2:i+2,j,:), compute UG1(i,j,:) and UG2(i,j,:)
-          rho0 = U(i,j,URHO)
-          rhoInv = 1.d0/rho0
-          do n=1,nspec
-             Y0(n) = U(i,j,UFS+n-1)*rhoInv
-          end do
-          v0(1) = U(i,j,UMX)*rhoInv
-          v0(2) = U(i,j,UMY)*rhoInv
-          v0(3) = 0.d0
-          T0 = U(i,j,UTEMP)
-
-          ! egv1: left matrix;  egv2: right matrix
-          call get_eigen_matrices(rho0, Y0, T0, v0, egv1, egv2)
-
-          do ii=-2,2
-             Uch(1) = U(i+ii,j,UMX)
-             Uch(2) = U(i+ii,j,UMY)
-             Uch(3) = 0.d0   ! becuase of 2d 
-             Uch(4) = U(i+ii,j,UEDEN)
-             rhoInv = 1.d0/U(i+ii,j,URHO)
-             do n=1,nspec
-                Uch(CFS+n-1) = U(i+ii,j,UFS+n-1)
-                Y0(n) = Uch(CFS+n-1)*rhoInv
-             end do
-             eref = eos_get_eref(Y0)
-             Uch(4) = Uch(4) - U(i+ii,j,URHO)*eref
-             
-             do n=1,NCHARV
-                charv(ii,n) = dot_product(egv1(:,n),Uch)
-             enddo
-          enddo
-
-          do ivar=1,NCHARV
-             call weno4_gauss(charv(-2:2,ivar), cvl(ivar), cvr(ivar))
-          enddo
-
-          egv1 = transpose(egv2)  ! egv1 now holds transposed right matrix
-
-          do n=1,NCHARV
-             UG1(i,j,UMX  ) = UG1(i,j,UMX  ) + cvl(n)*egv2(1,n)
-             UG2(i,j,UMX  ) = UG2(i,j,UMX  ) + cvr(n)*egv2(1,n)
-             UG1(i,j,UMY  ) = UG1(i,j,UMY  ) + cvl(n)*egv2(2,n)
-             UG2(i,j,UMY  ) = UG2(i,j,UMY  ) + cvr(n)*egv2(2,n)
-             UG1(i,j,UEDEN) = UG1(i,j,UEDEN) + cvl(n)*egv2(4,n)
-             UG2(i,j,UEDEN) = UG2(i,j,UEDEN) + cvr(n)*egv2(4,n)
-          end do
-          
-          do m=1,nspec
-             UG1(i,j,UFS+m-1) = UG1(i,j,UFS+m-1) + dot_product(cvl, egv1(:,CFS+m-1))
-             UG2(i,j,UFS+m-1) = UG2(i,j,UFS+m-1) + dot_product(cvr, egv1(:,CFS+m-1))
-             UG1(i,j,URHO   ) = UG1(i,j,URHO   ) + UG1(i,j,UFS+m-1)
-             UG2(i,j,URHO   ) = UG2(i,j,URHO   ) + UG2(i,j,UFS+m-1)
+       do n=1,NVAR
+          do i = lo(1)-2, hi(1)+2
+             Up(i,n) = U(i,j,n)
           end do
-          
-          rhoInv = 1.d0/UG1(i,j,URHO)
-          do n=1,nspec
-             Y0(n) = UG1(i,j,UFS+n-1) * rhoInv
-          end do
-          call floor_species(nspec, Y0)
-          eref = eos_get_eref(Y0)
-          UG1(i,j,UEDEN) = UG1(i,j,UEDEN) + UG1(i,j,URHO) * eref
-          do n=1,nspec
-             UG1(i,j,UFS+n-1) = UG1(i,j,URHO)*Y0(n)
-          end do
-          
-          rhoInv = 1.d0/UG2(i,j,URHO)
-          do n=1,nspec
-             Y0(n) = UG2(i,j,UFS+n-1) * rhoInv
-          end do
-          call floor_species(nspec, Y0)
-          eref = eos_get_eref(Y0)
-          UG2(i,j,UEDEN) = UG2(i,j,UEDEN) + UG2(i,j,URHO) * eref
-          do n=1,nspec
-             UG2(i,j,UFS+n-1) = UG2(i,j,URHO)*Y0(n)
+       end do
+
+       call char_recon_gauss(lo(1),hi(1), Up,lo(1)-2,hi(1)+2, (/UMX,UMY,UMZ/), &
+            UG1p,UG2p,lo(1),hi(1))
+
+       do n=1,NVAR
+          do i = lo(1), hi(1)
+             UG1(i,j,n) = UG1p(i,n)
+             UG2(i,j,n) = UG2p(i,n)
           end do
-          
-          UG1(i,j,UTEMP) = U(i,j,UTEMP)
-          UG2(i,j,UTEMP) = U(i,j,UTEMP)
        end do
     end do
 
+    deallocate(Up,UG1p,UG2p)
+
+    allocate(Up(lo(2)-3:hi(2)+3,NVAR))
+
     do g = 1, 2
-       if (g .eq. 1) then
+       if (g.eq.1) then
           UG => UG1
        else
           UG => UG2
        end if
 
        do i = lo(1), hi(1)
-          UL = 0.d0
-          UR = 0.d0
-          do j = lo(2),hi(2)+1
-             ! given UG(i,j-3:j+2,:), compute UL(j,:) and UR(j,:)
-             rhoInvl = 1.d0/UG(i,j-1,URHO)
-             rhoInvr = 1.d0/UG(i,j  ,URHO)
-             RoeWl = sqrt(UG(i,j-1,URHO))
-             RoeWr = sqrt(UG(i,j  ,URHO))
-             rho0 = RoeWl*Roewr
-             fac = 1.d0/(RoeWl+RoeWr)
-             do n=1,nspec
-                Y0(n) = (UG(i,j-1,UFS+n-1)*rhoInvl*RoeWl+UG(i,j,UFS+n-1)*rhoInvr*RoeWr)*fac
-             end do
-             T0 = (UG(i,j-1,UTEMP)*RoeWl+UG(i,j,UTEMP)*RoeWr)*fac
-             v0(1) = (UG(i,j-1,UMY)*rhoInvl*RoeWl+UG(i,j,UMY)*rhoInvr*RoeWr)*fac
-             v0(2) = (UG(i,j-1,UMX)*rhoInvl*RoeWl+UG(i,j,UMX)*rhoInvr*RoeWr)*fac
-             v0(3) = 0.d0
-
-             call floor_species(nspec,Y0)
-
-             ! egv1: left matrix;  egv2: right matrix
-             call get_eigen_matrices(rho0, Y0, T0, v0, egv1, egv2)
-
-             do jj=-3,2
-                Uch(1) = UG(i,j+jj,UMY)
-                Uch(2) = UG(i,j+jj,UMX)
-                Uch(3) = 0d0
-                Uch(4) = UG(i,j+jj,UEDEN)
-                rhoInv = 1.d0/UG(i,j+jj,URHO)
-                do n=1,nspec
-                   Uch(CFS+n-1) = UG(i,j+jj,UFS+n-1)
-                   Y0(n) = Uch(CFS+n-1)*rhoInv
-                end do
-                eref = eos_get_eref(Y0)
-                Uch(4) = Uch(4) - UG(i,j+jj,URHO)*eref
-                do n=1,NCHARV
-                   charv(jj,n) = dot_product(egv1(:,n),Uch)
-                end do
-             end do
-             
-             if (do_mdcd) then
-                do ivar=1,NCHARV
-                   call mdcd(charv(:,ivar), cvl(ivar), cvr(ivar))
-                end do
-             else
-                do ivar=1,NCHARV
-                   call weno5_face(charv(:,ivar), cvl(ivar), cvr(ivar))
-                end do
-             end if
-             
-             egv1 = transpose(egv2)  ! egv1 now holds transposed right matrix
-
-             do n=1,NCHARV
-                UL(j,UMY  ) = UL(j,UMY  ) + cvl(n)*egv2(1,n)
-                UR(j,UMY  ) = UR(j,UMY  ) + cvr(n)*egv2(1,n)
-                UL(j,UMX  ) = UL(j,UMX  ) + cvl(n)*egv2(2,n)
-                UR(j,UMX  ) = UR(j,UMX  ) + cvr(n)*egv2(2,n)
-                UL(j,UEDEN) = UL(j,UEDEN) + cvl(n)*egv2(4,n)
-                UR(j,UEDEN) = UR(j,UEDEN) + cvr(n)*egv2(4,n)
-             end do
-             
-             do m=1,nspec
-                UL(j,UFS+m-1) = UL(j,UFS+m-1) + dot_product(cvl, egv1(:,CFS+m-1))
-                UR(j,UFS+m-1) = UR(j,UFS+m-1) + dot_product(cvr, egv1(:,CFS+m-1))
-                UL(j,URHO   ) = UL(j,URHO) + UL(j,UFS+m-1)
-                UR(j,URHO   ) = UR(j,URHO) + UR(j,UFS+m-1)
-             end do
-             
-             rhoInv = 1.d0/UL(j,URHO)
-             do n=1,nspec
-                Y0(n) = UL(j,UFS+n-1) * rhoInv
-             end do
-             call floor_species(nspec, Y0)
-             eref = eos_get_eref(Y0)
-             UL(j,UEDEN) = UL(j,UEDEN) + UL(j,URHO) * eref
-             do n=1,nspec
-                UL(j,UFS+n-1) = UL(j,URHO)*Y0(n)
-             end do
-             
-             rhoInv = 1.d0/UR(j,URHO)
-             do n=1,nspec
-                Y0(n) = UR(j,UFS+n-1) * rhoInv
-             end do
-             call floor_species(nspec, Y0)
-             eref = eos_get_eref(Y0)
-             UR(j,UEDEN) = UR(j,UEDEN) + UR(j,URHO) * eref
-             do n=1,nspec
-                UR(j,UFS+n-1) = UR(j,URHO)*Y0(n)
+          ! given UG(i,j-3:j+2,:), compute UL(j,:) and UR(j,:)
+          do n=1,NVAR
+             do j = lo(2)-3, hi(2)+3
+                Up(j,n) = UG(i,j,n)
              end do
-             
-             UL(j,UTEMP) = T0
-             UR(j,UTEMP) = T0
           end do
 
+          call char_recon_face(lo(2),hi(2), Up,lo(2)-3,hi(2)+3, (/UMY,UMX,UMZ/), &
+               UL,UR,lo(2),hi(2)+1)
+
           call get_hyper_bc_flag(2,(/i,lo(2)/),(/i,hi(2)+1/),domlo,domhi,dx,bc_flag)
 
           call riemann(lo(2),hi(2),UL,UR,lo(2),hi(2)+1,flux,lo(2),hi(2)+1, &
@@ -516,7 +206,7 @@ contains
        Nullify(UG)
     end do
 
-    deallocate(flux)
+    deallocate(Up, flux)
     deallocate(UG1,UG2,UL,UR)
     
   end subroutine hypterm_y
@@ -11,6 +11,7 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   use hypterm_module, only : hypterm
   use difterm_module, only : difterm
   use threadbox_module, only : build_threadbox_3d, get_lo_hi
+  use dt_bound_module, only : dt_bound_on, dt_bound_adv
   implicit none
 
   integer, intent(in) :: lo(3), hi(3), domlo(3), domhi(3)
@@ -29,7 +30,7 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   integer :: igrav
   integer :: Ulo(3),Uhi(3),fxlo(3),fxhi(3),fylo(3),fyhi(3),fzlo(3),fzhi(3),tlo(3),thi(3)
   integer :: iblock, nblocks, nblocksxy, iblockxy, i, j, k, n, ib, jb, kb, nb(3), boxsize(3)
-  double precision :: dxinv(3)
+  double precision :: dxinv(3), dtb
   integer, allocatable :: bxlo(:), bxhi(:), bylo(:), byhi(:), bzlo(:), bzhi(:)
   double precision, allocatable :: bxflx(:,:,:,:), byflx(:,:,:,:), bzflx(:,:,:,:)
 
@@ -71,10 +72,12 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   nblocksxy = nb(1)*nb(2)
   nblocks   = nb(1)*nb(2)*nb(3)
 
+  dtb = 1.d50
+
   !$omp parallel private(fxlo,fxhi,fylo,fyhi,fzlo,fzhi,tlo,thi) &
   !$omp private(iblock,iblockxy,i,j,k,n,ib,jb,kb,bxflx,byflx,bzflx)
 
-  !$omp do
+  !$omp do reduction(min:dtb)
   do iblock = 0, nblocks-1
 
      kb = iblock / nblocksxy
@@ -118,6 +121,10 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
         call hypterm(tlo,thi,domlo,domhi,U,Ulo,Uhi,bxflx,fxlo,fxhi,byflx,fylo,fyhi,bzflx,fzlo,fzhi,dx)
      end if
      call difterm(tlo,thi,domlo,domhi,U,Ulo,Uhi,bxflx,fxlo,fxhi,byflx,fylo,fyhi,bzflx,fzlo,fzhi,dx)
+
+     if (dt_bound_on) then
+        call rns_estdt_box(U,U_l1,U_l2,U_l3,U_h1,U_h2,U_h3,tlo,thi,dx,dtb)
+     end if
      
      ! Note that fluxes are on faces.  So don't double count!
      if (thi(1) .ne. hi(1)) fxhi(1) = fxhi(1) - 1
@@ -185,6 +192,8 @@ subroutine rns_dudt_ad (lo, hi, domlo, domhi, &
   
   !$omp end parallel
 
+  if (dt_bound_on) dt_bound_adv = min(dt_bound_adv, dtb)
+
 end subroutine rns_dudt_ad
 
 ! :::
@@ -299,40 +308,44 @@ end subroutine rns_dUdt_chem
 
 subroutine rns_compute_temp(lo,hi,U,U_l1,U_l2,U_l3,U_h1,U_h2,U_h3)
   use meth_params_module, only : NVAR, URHO, UMX, UMY, UMZ, UEDEN, UTEMP, UFS, NSPEC
-  use eos_module, only : eos_get_T
+  use eos_module, only : eos_get_T_row
   implicit none
   
   integer, intent(in) :: lo(3), hi(3)
   integer, intent(in) :: U_l1, U_l2, U_l3, U_h1, U_h2, U_h3
   double precision, intent(inout) :: U(U_l1:U_h1,U_l2:U_h2,U_l3:U_h3,NVAR)
 
-  integer :: i, j, k, pt_index(3), ierr
-  double precision :: rhoInv, e, vx, vy, vz, Y(NSPEC)
+  integer :: i, j, k, n, ierr(lo(1):hi(1))
+  double precision :: rhoInv, vx, vy, vz
+  double precision :: e(lo(1):hi(1)), T(lo(1):hi(1)), Y(lo(1):hi(1),NSPEC)
 
-  !$omp parallel do private(i,j,k,rhoInv,e,vx,vy,vz,Y,pt_index,ierr) collapse(2)
+  !$omp parallel do private(i,j,k,n,rhoInv,vx,vy,vz,e,T,Y,ierr) collapse(2)
   do k=lo(3),hi(3)
   do j=lo(2),hi(2)
-  do i=lo(1),hi(1)
-     pt_index(1) = i
-     pt_index(2) = j
-     pt_index(3) = k
+     do i=lo(1),hi(1)
+        rhoInv = 1.0d0/U(i,j,k,URHO)
 
-     rhoInv = 1.0d0/U(i,j,k,URHO)
+        vx = U(i,j,k,UMX)*rhoInv     
+        vy = U(i,j,k,UMY)*rhoInv     
+        vz = U(i,j,k,UMZ)*rhoInv     
+        e(i) = U(i,j,k,UEDEN)*rhoInv - 0.5d0*(vx**2+vy**2+vz**2)
 
-     vx = U(i,j,k,UMX)*rhoInv     
-     vy = U(i,j,k,UMY)*rhoInv     
-     vz = U(i,j,k,UMZ)*rhoInv     
-     e  = U(i,j,k,UEDEN)*rhoInv - 0.5d0*(vx**2+vy**2+vz**2)
+        do n=1,NSPEC
+           Y(i,n) = U(i,j,k,UFS+n-1)*rhoInv
+        end do
 
-     Y = U(i,j,k,UFS:UFS+NSPEC-1)*rhoInv
+        T(i) = U(i,j,k,UTEMP)
+     end do
 
-     call eos_get_T(U(i,j,k,UTEMP), e, Y, pt_index,ierr)
+     call eos_get_T_row(hi(1)-lo(1)+1, T, e, Y, ierr)
 
-     if (ierr .ne. 0) then
-        print *, 'rns_compute_temp failed at ', i,j,k,U(i,j,k,:)
-        call bl_error("rns_compute_temp failed")
-     end if
-  end do
+     do i=lo(1),hi(1)
+        if (ierr(i) .ne. 0) then
+           print *, 'rns_compute_temp failed at ', i,j,k,U(i,j,k,:)
+           call bl_error("rns_compute_temp failed")
+        end if
+        U(i,j,k,UTEMP) = T(i)
+     end do
   end do
   end do
   !$omp end parallel do
@@ -485,6 +498,35 @@ end subroutine rns_sum_cons
 ! :::
 
       subroutine rns_estdt(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
+        use meth_params_module, only : NVAR
+        implicit none
+
+        integer u_l1,u_l2,u_l3,u_h1,u_h2,u_h3
+        integer lo(3), hi(3)
+        double precision u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+        double precision dx(3), dt
+
+        integer :: j, k, rlo(3), rhi(3)
+
+        !$omp parallel do private(j,k,rlo,rhi) reduction(min:dt) collapse(2)
+        do k = lo(3), hi(3)
+        do j = lo(2), hi(2)
+           rlo = (/ lo(1), j, k /)
+           rhi = (/ hi(1), j, k /)
+           call rns_estdt_box(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,rlo,rhi,dx,dt)
+        end do
+        end do
+        !$omp end parallel do
+
+      end subroutine rns_estdt
+
+! :::
+! ::: ------------------------------------------------------------------
+! :::
+
+      ! rns_estdt on lo:hi by the calling thread alone, for callers that
+      ! are threaded already.
+      subroutine rns_estdt_box(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
         use eos_module, only : eos_get_c
         use meth_params_module, only : NVAR, URHO, UMX, UMY, UMZ, UEDEN, UTEMP, UFS, NSPEC
         implicit none
@@ -497,8 +539,6 @@ end subroutine rns_sum_cons
         integer :: i, j, k
         double precision :: rhoInv, vx, vy, vz, T, e, c, Y(NSPEC)
 
-        !$omp parallel do private(i,j,k,rhoInv,vx,vy,vz,T,e,c,Y) reduction(min:dt) &
-        !$omp collapse(2)
         do k = lo(3), hi(3)
         do j = lo(2), hi(2)
         do i = lo(1), hi(1)
@@ -521,6 +561,5 @@ end subroutine rns_sum_cons
         end do
         end do
         end do
-        !$omp end parallel do
 
-      end subroutine rns_estdt
+      end subroutine rns_estdt_box
@@ -13,6 +13,7 @@ contains
     use convert_module, only : cellavg2cc_3d
     use variables_module, only : ctoprim
     use transport_properties, only : get_transport_properties
+    use dt_bound_module, only : dt_bound_on
 
     integer, intent(in) :: lo(3), hi(3), domlo(3), domhi(3), Ulo(3), Uhi(3), &
          fxlo(3), fxhi(3), fylo(3), fyhi(3), fzlo(3), fzhi(3)
@@ -57,6 +58,10 @@ contains
     call get_transport_properties(g2lo,g2hi, Qcc,g2lo,g2hi,QFVAR, &
          mucc,xicc,lamcc,Ddiacc, g2lo,g2hi)
 
+    if (dt_bound_on) then
+       call diff_dt_bound(lo,hi,Qcc,Ddiacc,g2lo,g2hi,dx)
+    end if
+
     QzGlo(1:2) = g2lo(1:2)
     QzGlo(3) = lo(3)
     QzGhi(1:2) = g2hi(1:2)
@@ -195,6 +200,46 @@ contains
   end subroutine difterm
 
 
+  ! Lower dt_bound_diff with the diffusive time step limit on lo:hi, computed
+  ! as in rns_estdt_ad from the cell-centered state and coefficients.
+  subroutine diff_dt_bound(lo,hi,Q,Ddia,clo,chi,dx)
+    use meth_params_module, only : NSPEC, QFVAR, QRHO, QFX
+    use chemistry_module, only : molecular_weight, inv_mwt
+    use dt_bound_module, only : dt_bound_diff
+    integer, intent(in) :: lo(3), hi(3), clo(3), chi(3)
+    double precision, intent(in) ::    Q(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3),QFVAR)
+    double precision, intent(in) :: Ddia(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3),NSPEC)
+    double precision, intent(in) :: dx(3)
+
+    integer :: i, j, k, n
+    double precision :: Wbar, D, dt
+
+    dt = 1.d50
+
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+          do i=lo(1),hi(1)
+             Wbar = 0.d0
+             do n=1,NSPEC
+                Wbar = Wbar + Q(i,j,k,QFX+n-1)*molecular_weight(n)
+             end do
+             D = 0.d0
+             do n=1,NSPEC
+                D = max(D, Ddia(i,j,k,n)*Wbar*inv_mwt(n))
+             end do
+             dt = min(dt, Q(i,j,k,QRHO)/D)
+          end do
+       end do
+    end do
+
+    dt = dt * 0.5d0*(min(dx(1),dx(2),dx(3)))**2
+
+    !$omp atomic
+    dt_bound_diff = min(dt_bound_diff, dt)
+
+  end subroutine diff_dt_bound
+
+
   subroutine diff_xy(lo, hi, domlo, domhi, dveldz, Q, mu, xi, lam, Ddia, qlo, qhi, &
        fx, fxlo, fxhi, fy, fylo, fyhi, dx)
     
@@ -374,6 +419,7 @@ contains
 
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
 
     integer, intent(in) :: lo(2), hi(2), k, flo(3), fhi(3), Qflo(2), Qfhi(2), Qclo(2), Qchi(2), &
          domlo(3), domhi(3)
@@ -391,9 +437,10 @@ contains
     integer :: i, j, n, UYN, QYN, QXN, QHN
     double precision :: tauxx, tauxy, tauxz
     double precision :: dudx, dudy, dudz, dvdx, dvdy, dwdx, dwdz, divu
-    double precision :: dTdx, dXdx, Vd
+    double precision :: dTdx, dXdx
     double precision :: ek, rhovn
     double precision, dimension(lo(1):hi(1)) :: dlnpdx, Vc
+    double precision, dimension(lo(1):hi(1),NSPEC) :: dk, Vd
 
     do j=lo(2),hi(2)
        do i=lo(1),hi(1)
@@ -430,18 +477,28 @@ contains
        end do
 
        do n=1,NSPEC
-          UYN = UFS+n-1
           QYN = QFY+n-1
           QXN = QFX+n-1
-          QHN = QFH+n-1
           do i = lo(1), hi(1)
              dXdx = dxinv(1) * (FD4(-2)*Qc(i-2,j,QXN) + FD4(-1)*Qc(i-1,j,QXN) &
                   + FD4(0)*Qc(i,j,QXN) + FD4(1)*Qc(i+1,j,QXN))
-             Vd = -Ddia(i,j,n)*(dXdx + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdx(i))
-             
-             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd
-             Vc(i) = Vc(i) + Vd
-             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd*Qf(i,j,QHN)
+             dk(i,n) = dXdx + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdx(i)
+             Vd(i,n) = -Ddia(i,j,n)*dk(i,n)
+          end do
+       end do
+
+       if (mc_diff_iters .gt. 0) then
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk, Vd)
+       end if
+
+       do n=1,NSPEC
+          UYN = UFS+n-1
+          QHN = QFH+n-1
+          do i = lo(1), hi(1)
+             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd(i,n)
+             Vc(i) = Vc(i) + Vd(i,n)
+             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd(i,n)*Qf(i,j,QHN)
           end do
        end do
 
@@ -486,6 +543,7 @@ contains
     use prob_params_module, only : physbc_lo, physbc_hi, NoSlipWall
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
     use RNS_boundary_module, only : Twall
 
     integer, intent(in) :: lo(2), hi(2), k, flo(3), fhi(3), Qflo(2), Qfhi(2), Qclo(2), Qchi(2), &
@@ -504,10 +562,13 @@ contains
     integer :: i, j, n, UYN, QYN, QXN, QHN, jstart
     double precision :: tauyy, tauxy, tauyz
     double precision :: dudx, dudy, dvdx, dvdy, dvdz, dwdy, dwdz, divu
-    double precision :: dTdy, dXdy, Vd
+    double precision :: dTdy, dXdy
     double precision :: ek, rhovn
     double precision :: dlnpdytmp, Vctmp, foo
-    double precision, allocatable :: dlnpdy(:,:), Vc(:,:)
+    double precision, allocatable :: dlnpdy(:,:), Vc(:,:), dk(:,:,:), Vd(:,:,:)
+
+    allocate(dk(lo(1):hi(1),lo(2):hi(2),NSPEC))
+    allocate(Vd(lo(1):hi(1),lo(2):hi(2),NSPEC))
 
     jstart = lo(2)
 
@@ -568,21 +629,32 @@ contains
           ! compute dpdy
           dlnpdytmp = dxinv(2) * (Qc(i,lo(2)+1,QPRES) - Qc(i,lo(2),QPRES)) &
                / (0.5d0*(Qc(i,lo(2),QPRES) + Qc(i,lo(2)+1,QPRES)))
-          Vctmp = 0.d0
-
           do n=1,NSPEC
-             UYN = UFS+n-1
              QYN = QFY+n-1
              QXN = QFX+n-1
-             QHN = QFH+n-1
 
              dXdy = dxinv(2) * (Qc(i,lo(2)+1,QXN) - Qc(i,lo(2),QXN))
-             Vd = -Ddia(i,j,n)*(dXdy + dlnpdytmp* &
+             dk(i,j,n) = dXdy + dlnpdytmp* &
                   0.5d0*(Qc(i,lo(2),QXN)+Qc(i,lo(2)+1,QXN) &
-                  &    - Qc(i,lo(2),QYN)-Qc(i,lo(2)+1,QYN)) ) 
-             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd
-             Vctmp = Vctmp + Vd
-             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd*Qf(i,j,QHN)
+                  &    - Qc(i,lo(2),QYN)-Qc(i,lo(2)+1,QYN))
+             Vd(i,j,n) = -Ddia(i,j,n)*dk(i,j,n)
+          end do
+       end do
+
+       if (mc_diff_iters .gt. 0) then
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk(:,j,:), Vd(:,j,:))
+       end if
+
+       do i=lo(1),hi(1)
+          Vctmp = 0.d0
+
+          do n=1,NSPEC
+             UYN = UFS+n-1
+             QHN = QFH+n-1
+             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd(i,j,n)
+             Vctmp = Vctmp + Vd(i,j,n)
+             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd(i,j,n)*Qf(i,j,QHN)
           end do
 
           do n=1,NSPEC
@@ -635,19 +707,33 @@ contains
     end do
 
     do n=1,NSPEC
-       UYN = UFS+n-1
        QYN = QFY+n-1
        QXN = QFX+n-1
-       QHN = QFH+n-1
        do j = jstart, hi(2)
           do i = lo(1), hi(1)
              dXdy = dxinv(2) * (FD4(-2)*Qc(i,j-2,QXN) + FD4(-1)*Qc(i,j-1,QXN) &
                   + FD4(0)*Qc(i,j,QXN) + FD4(1)*Qc(i,j+1,QXN))
-             Vd = -Ddia(i,j,n)*(dXdy + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdy(i,j))
-             
-             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd
-             Vc(i,j) = Vc(i,j) + Vd
-             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd*Qf(i,j,QHN)
+             dk(i,j,n) = dXdy + (Qf(i,j,QXN)-Qf(i,j,QYN))*dlnpdy(i,j)
+             Vd(i,j,n) = -Ddia(i,j,n)*dk(i,j,n)
+          end do
+       end do
+    end do
+
+    if (mc_diff_iters .gt. 0) then
+       do j = jstart, hi(2)
+          call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,QTEMP), &
+               Qf(lo(1):hi(1),j,QFX:QFX+NSPEC-1), dk(:,j,:), Vd(:,j,:))
+       end do
+    end if
+
+    do n=1,NSPEC
+       UYN = UFS+n-1
+       QHN = QFH+n-1
+       do j = jstart, hi(2)
+          do i = lo(1), hi(1)
+             flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd(i,j,n)
+             Vc(i,j) = Vc(i,j) + Vd(i,j,n)
+             flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd(i,j,n)*Qf(i,j,QHN)
           end do
        end do
     end do
@@ -664,7 +750,7 @@ contains
        end do
     end do
 
-    deallocate(dlnpdy,Vc)
+    deallocate(dlnpdy,Vc,dk,Vd)
 
     if (.not. do_weno) then
        ! compute hyperbolic flux
@@ -757,6 +843,7 @@ contains
 
     use meth_params_module
     use derivative_stencil_module, only : FD4
+    use transport_properties, only : get_mc_diff_flux
 
     integer, intent(in) :: lo(3),hi(3),flo(3),fhi(3),Qflo(3),Qfhi(3),Qlo(3),Qhi(3),domlo(3),domhi(3)
     double precision, intent(in) :: dxinv(3), fac
@@ -773,9 +860,10 @@ contains
     integer :: i, j, k, n, UYN, QYN, QXN, QHN
     double precision :: tauzz, tauxz, tauyz
     double precision :: dudx, dudz, dvdy, dvdz, dwdx, dwdy, dwdz, divu
-    double precision :: dTdz, dXdz, Vd
+    double precision :: dTdz, dXdz
     double precision :: ek, rhovn
     double precision, dimension(lo(1):hi(1)) :: dlnpdz, Vc
+    double precision, dimension(lo(1):hi(1),NSPEC) :: dk, Vd
 
     do k      =lo(3),hi(3)
        do j   =lo(2),hi(2)
@@ -814,18 +902,28 @@ contains
           end do
 
           do n=1,NSPEC
-             UYN = UFS+n-1
              QYN = QFY+n-1
              QXN = QFX+n-1
-             QHN = QFH+n-1
              do i = lo(1), hi(1)
                 dXdz = dxinv(3) * (FD4(-2)*Q(i,j,k-2,QXN) + FD4(-1)*Q(i,j,k-1,QXN) &
                      + FD4(0)*Q(i,j,k,QXN) + FD4(1)*Q(i,j,k+1,QXN))
-                Vd = -Ddia(i,j,k,n)*(dXdz + (Qf(i,j,k,QXN)-Qf(i,j,k,QYN))*dlnpdz(i))
-                
-                flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd
-                Vc(i) = Vc(i) + Vd
-                flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd*Qf(i,j,k,QHN)
+                dk(i,n) = dXdz + (Qf(i,j,k,QXN)-Qf(i,j,k,QYN))*dlnpdz(i)
+                Vd(i,n) = -Ddia(i,j,k,n)*dk(i,n)
+             end do
+          end do
+
+          if (mc_diff_iters .gt. 0) then
+             call get_mc_diff_flux(hi(1)-lo(1)+1, Qf(lo(1):hi(1),j,k,QTEMP), &
+                  Qf(lo(1):hi(1),j,k,QFX:QFX+NSPEC-1), dk, Vd)
+          end if
+
+          do n=1,NSPEC
+             UYN = UFS+n-1
+             QHN = QFH+n-1
+             do i = lo(1), hi(1)
+                flx(i,j,k,UYN) = flx(i,j,k,UYN) + fac*Vd(i,n)
+                Vc(i) = Vc(i) + Vd(i,n)
+                flx(i,j,k,UEDEN) = flx(i,j,k,UEDEN) + fac*Vd(i,n)*Qf(i,j,k,QHN)
              end do
           end do
     
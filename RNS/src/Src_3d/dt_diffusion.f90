@@ -1,23 +1,25 @@
-subroutine rns_estdt_diff(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
+! Advective and diffusive time step limits in one sweep over the state.
+subroutine rns_estdt_ad(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt,dtdiff)
   use meth_params_module
+  use eos_module, only : eos_get_c
   use egz_module, only : egzini, egzpar, egzvr1
   use chemistry_module, only : inv_mwt
   integer, intent(in) :: u_l1,u_l2,u_l3,u_h1,u_h2,u_h3
   integer, intent(in) :: lo(3), hi(3)
   double precision, intent(in) :: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
   double precision, intent(in) :: dx(3)
-  double precision, intent(inout) :: dt
+  double precision, intent(inout) :: dt, dtdiff
 
   integer :: i, j, k, n, np, iwrk
-  double precision :: rwrk, Yt(NSPEC), Xt(NSPEC), rhoInv, Wbar, D, dx2
+  double precision :: rwrk, Yt(NSPEC), Xt(NSPEC), rhoInv, Wbar, D, dx2, vx, vy, vz, c
   double precision, allocatable :: DZ(:,:), XZ(:,:), CPZ(:,:)
   
   np = hi(1)-lo(1)+1
   
   dx2 = 0.5*(min(dx(1),dx(2),dx(3)))**2
   
-  !$omp parallel private(i,j,k,n,iwrk,rwrk,Yt,Xt,rhoInv,Wbar,D, DZ,XZ,CPZ) &
-  !$omp reduction(min:dt)
+  !$omp parallel private(i,j,k,n,iwrk,rwrk,Yt,Xt,rhoInv,Wbar,D,vx,vy,vz,c, DZ,XZ,CPZ) &
+  !$omp reduction(min:dt,dtdiff)
   
   allocate(DZ (lo(1):hi(1),nspec))
   allocate(XZ (lo(1):hi(1),nspec))
@@ -34,6 +36,15 @@ subroutine rns_estdt_diff(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
      do i=lo(1),hi(1)
         rhoInv = 1.d0/u(i,j,k,URHO)
         Yt = u(i,j,k,UFS:UFS+nspec-1)*rhoInv
+
+        vx = u(i,j,k,UMX)*rhoInv
+        vy = u(i,j,k,UMY)*rhoInv
+        vz = u(i,j,k,UMZ)*rhoInv
+        call eos_get_c(c,u(i,j,k,URHO),u(i,j,k,UTEMP),Yt)
+        dt = min(dt, dx(1)/(abs(vx)+c+1.d-50), &
+             &       dx(2)/(abs(vy)+c+1.d-50), &
+             &       dx(3)/(abs(vz)+c+1.d-50) )
+
         call ckytx(Yt, iwrk, rwrk, Xt)
         XZ(i,:) = Xt
      end do
@@ -49,7 +60,7 @@ subroutine rns_estdt_diff(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
         do n=1,nspec
            D = max(D, DZ(i,n)*Wbar*inv_mwt(n))
         end do
-        dt = min(dt, dx2/D*u(i,j,k,URHO))
+        dtdiff = min(dtdiff, dx2/D*u(i,j,k,URHO))
      end do
      
   end do
@@ -60,5 +71,5 @@ subroutine rns_estdt_diff(u,u_l1,u_l2,u_l3,u_h1,u_h2,u_h3,lo,hi,dx,dt)
   
   !$omp end parallel
   
-end subroutine rns_estdt_diff
+end subroutine rns_estdt_ad
 
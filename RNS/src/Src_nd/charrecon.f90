@@ -0,0 +1,287 @@
+module charrecon_module
+
+  ! Characteristic-based reconstruction on a pencil of cells.  Points (faces
+  ! or cells) are processed in blocks of nb: eigen matrices for a whole block
+  ! are built at once in SoA form, the stencils are projected onto and back
+  ! from characteristic space as batched matrix products, and the WENO/MDCD
+  ! weights are evaluated across the block.
+
+  implicit none
+
+  integer, parameter :: nb = 16
+
+  private
+
+  public :: char_recon_face, char_recon_gauss
+
+contains
+
+  ! L and R in UL and UR are relative to face
+  ! imom(1:3) are the momentum components in (normal, tangential, tangential)
+  ! order; a zero entry means that component is absent (e.g., z in 2d).
+  ! The face eigen matrices use Roe-averaged velocities, or Roe-averaged
+  ! momenta if mom_avg is present and true (as the 3d sweeps do).
+  !
+  ! Minimal ranges:
+  !   U         : lo-3:hi+3
+  !   UL  & UR  : lo  :hi+1
+  subroutine char_recon_face(lo, hi, U, Ulo, Uhi, imom, UL, UR, flo, fhi, mom_avg)
+    use meth_params_module, only : NVAR, URHO, UTEMP, NSPEC, NCHARV, do_mdcd
+    use renorm_module, only : floor_species
+    use eigen_module, only : get_eigen_matrices_soa
+    use mdcd_module, only : vmdcd
+    use weno_module, only : vweno5_face
+
+    integer, intent(in) :: lo, hi, Ulo, Uhi, imom(3), flo, fhi
+    double precision, intent(in) :: U(Ulo:Uhi,NVAR)
+    double precision, intent(out), dimension(flo:fhi,NVAR) :: UL, UR
+    logical, intent(in), optional :: mom_avg
+
+    integer :: i, i0, ib, np, n, m, is, d
+    double precision :: fac
+    double precision, allocatable :: Uch(:,:), Y(:,:), v(:,:), RoeW(:)
+    double precision, allocatable :: lv(:,:,:), rv(:,:,:), charv(:,:), cvl(:,:), cvr(:,:)
+    double precision :: rho0(nb), Y0(nspec,nb), T0(nb), v0(nb,3)
+
+    allocate(Uch (lo-3:hi+3,NCHARV))
+    allocate(Y   (nspec,lo-3:hi+3))
+    allocate(v   (lo-3:hi+3,3))
+    allocate(RoeW(lo-3:hi+3))
+    allocate(lv(nb,NCHARV,NCHARV), rv(nb,NCHARV,NCHARV))
+    allocate(charv(nb,-3:2), cvl(nb,NCHARV), cvr(nb,NCHARV))
+
+    call gather_char(lo-3, hi+3, U, Ulo, Uhi, imom, Uch, Y, v)
+
+    if (present(mom_avg)) then
+       if (mom_avg) then
+          do d=1,3
+             do i=lo-3,hi+3
+                v(i,d) = Uch(i,d)
+             end do
+          end do
+       end if
+    end if
+
+    do i=lo-3,hi+3
+       RoeW(i) = sqrt(U(i,URHO))
+    end do
+
+    do i0=lo,hi+1,nb
+       np = min(nb, hi+2-i0)
+
+       do ib=1,np
+          i = i0+ib-1
+          rho0(ib) = RoeW(i-1)*RoeW(i)
+          fac = 1.d0/(RoeW(i-1)+RoeW(i))
+          do n=1,nspec
+             Y0(n,ib) = (Y(n,i-1)*RoeW(i-1)+Y(n,i)*RoeW(i))*fac
+          end do
+          T0(ib) = (U(i-1,UTEMP)*RoeW(i-1)+U(i,UTEMP)*RoeW(i))*fac
+          v0(ib,1) = (v(i-1,1)*RoeW(i-1)+v(i,1)*RoeW(i))*fac
+          v0(ib,2) = (v(i-1,2)*RoeW(i-1)+v(i,2)*RoeW(i))*fac
+          v0(ib,3) = (v(i-1,3)*RoeW(i-1)+v(i,3)*RoeW(i))*fac
+          call floor_species(nspec, Y0(:,ib))
+       end do
+
+       ! lv: left matrix;  rv: right matrix
+       call get_eigen_matrices_soa(np, nb, rho0, Y0, T0, v0, lv, rv)
+
+       do n=1,NCHARV
+          charv = 0.d0
+          do is=-3,2
+             do m=1,NCHARV
+                !DEC$ SIMD
+                do ib=1,np
+                   charv(ib,is) = charv(ib,is) + lv(ib,m,n)*Uch(i0+ib-1+is,m)
+                end do
+             end do
+          end do
+
+          if (do_mdcd) then
+             call vmdcd(np, nb, charv, cvl(:,n), cvr(:,n))
+          else
+             call vweno5_face(np, nb, charv, cvl(:,n), cvr(:,n))
+          end if
+       end do
+
+       call scatter_char(np, nb, i0, cvl, rv, imom, UL, flo, fhi)
+       call scatter_char(np, nb, i0, cvr, rv, imom, UR, flo, fhi)
+
+       do ib=1,np
+          UL(i0+ib-1,UTEMP) = T0(ib)
+          UR(i0+ib-1,UTEMP) = T0(ib)
+       end do
+    end do
+
+    deallocate(Uch, Y, v, RoeW, lv, rv, charv, cvl, cvr)
+
+  end subroutine char_recon_face
+
+
+  ! UG1 and UG2 are at two Gauss points of cell i in the direction of
+  ! imom(1), using cell-centered eigen matrices.
+  !
+  ! Minimal ranges:
+  !   U         : lo-2:hi+2
+  !   UG1 & UG2 : lo  :hi
+  subroutine char_recon_gauss(lo, hi, U, Ulo, Uhi, imom, UG1, UG2, glo, ghi)
+    use meth_params_module, only : NVAR, URHO, UTEMP, NSPEC, NCHARV
+    use eigen_module, only : get_eigen_matrices_soa
+    use weno_module, only : vweno4_gauss
+
+    integer, intent(in) :: lo, hi, Ulo, Uhi, imom(3), glo, ghi
+    double precision, intent(in) :: U(Ulo:Uhi,NVAR)
+    double precision, intent(out), dimension(glo:ghi,NVAR) :: UG1, UG2
+
+    integer :: i, i0, ib, np, n, m, is
+    double precision, allocatable :: Uch(:,:), Y(:,:), v(:,:)
+    double precision, allocatable :: lv(:,:,:), rv(:,:,:), charv(:,:), cvl(:,:), cvr(:,:)
+    double precision :: rho0(nb), Y0(nspec,nb), T0(nb), v0(nb,3)
+
+    allocate(Uch (lo-2:hi+2,NCHARV))
+    allocate(Y   (nspec,lo-2:hi+2))
+    allocate(v   (lo-2:hi+2,3))
+    allocate(lv(nb,NCHARV,NCHARV), rv(nb,NCHARV,NCHARV))
+    allocate(charv(nb,-2:2), cvl(nb,NCHARV), cvr(nb,NCHARV))
+
+    call gather_char(lo-2, hi+2, U, Ulo, Uhi, imom, Uch, Y, v)
+
+    do i0=lo,hi,nb
+       np = min(nb, hi+1-i0)
+
+       do ib=1,np
+          i = i0+ib-1
+          rho0(ib) = U(i,URHO)
+          do n=1,nspec
+             Y0(n,ib) = Y(n,i)
+          end do
+          T0(ib) = U(i,UTEMP)
+          v0(ib,:) = v(i,:)
+       end do
+
+       ! lv: left matrix;  rv: right matrix
+       call get_eigen_matrices_soa(np, nb, rho0, Y0, T0, v0, lv, rv)
+
+       do n=1,NCHARV
+          charv = 0.d0
+          do is=-2,2
+             do m=1,NCHARV
+                !DEC$ SIMD
+                do ib=1,np
+                   charv(ib,is) = charv(ib,is) + lv(ib,m,n)*Uch(i0+ib-1+is,m)
+                end do
+             end do
+          end do
+
+          call vweno4_gauss(np, nb, charv, cvl(:,n), cvr(:,n))
+       end do
+
+       call scatter_char(np, nb, i0, cvl, rv, imom, UG1, glo, ghi)
+       call scatter_char(np, nb, i0, cvr, rv, imom, UG2, glo, ghi)
+
+       do ib=1,np
+          UG1(i0+ib-1,UTEMP) = T0(ib)
+          UG2(i0+ib-1,UTEMP) = T0(ib)
+       end do
+    end do
+
+    deallocate(Uch, Y, v, lv, rv, charv, cvl, cvr)
+
+  end subroutine char_recon_gauss
+
+
+  ! Conserved variables in characteristic ordering: momentum (normal first),
+  ! rhoE minus the reference energy, rhoY.  Also returns Y and velocity.
+  subroutine gather_char(lo, hi, U, Ulo, Uhi, imom, Uch, Y, v)
+    use meth_params_module, only : NVAR, URHO, UEDEN, UFS, NSPEC, NCHARV, CFS
+    use eos_module, only : eos_get_eref
+
+    integer, intent(in) :: lo, hi, Ulo, Uhi, imom(3)
+    double precision, intent(in) :: U(Ulo:Uhi,NVAR)
+    double precision, intent(out) :: Uch(lo:hi,NCHARV), Y(nspec,lo:hi), v(lo:hi,3)
+
+    integer :: i, n, d
+    double precision :: rhoInv
+
+    do d=1,3
+       if (imom(d) .gt. 0) then
+          do i=lo,hi
+             Uch(i,d) = U(i,imom(d))
+             v(i,d) = U(i,imom(d))/U(i,URHO)
+          end do
+       else
+          do i=lo,hi
+             Uch(i,d) = 0.d0
+             v(i,d) = 0.d0
+          end do
+       end if
+    end do
+
+    do n=1,nspec
+       do i=lo,hi
+          Uch(i,CFS+n-1) = U(i,UFS+n-1)
+       end do
+    end do
+
+    do i=lo,hi
+       rhoInv = 1.d0/U(i,URHO)
+       do n=1,nspec
+          Y(n,i) = U(i,UFS+n-1)*rhoInv
+       end do
+       Uch(i,4) = U(i,UEDEN) - U(i,URHO)*eos_get_eref(Y(:,i))
+    end do
+
+  end subroutine gather_char
+
+
+  ! W(i0:i0+np-1,:) = back projection of cv with the right matrices, then
+  ! rho = sum(rhoY), with floored species and the reference energy added back.
+  subroutine scatter_char(np, ld, i0, cv, rv, imom, W, wlo, whi)
+    use meth_params_module, only : NVAR, URHO, UEDEN, UFS, NSPEC, NCHARV, CFS
+    use renorm_module, only : floor_species
+    use eos_module, only : eos_get_eref
+
+    integer, intent(in) :: np, ld, i0, imom(3), wlo, whi
+    double precision, intent(in) :: cv(ld,NCHARV), rv(ld,NCHARV,NCHARV)
+    double precision, intent(inout) :: W(wlo:whi,NVAR)
+
+    integer :: i, ib, m, n, d
+    double precision :: Wch(np,NCHARV), rho, rhoInv, Y0(nspec)
+
+    Wch = 0.d0
+    do n=1,NCHARV
+       do m=1,NCHARV
+          !DEC$ SIMD
+          do ib=1,np
+             Wch(ib,m) = Wch(ib,m) + cv(ib,n)*rv(ib,m,n)
+          end do
+       end do
+    end do
+
+    do ib=1,np
+       i = i0+ib-1
+
+       do d=1,3
+          if (imom(d) .gt. 0) W(i,imom(d)) = Wch(ib,d)
+       end do
+
+       rho = 0.d0
+       do n=1,nspec
+          rho = rho + Wch(ib,CFS+n-1)
+       end do
+       W(i,URHO) = rho
+
+       rhoInv = 1.d0/rho
+       do n=1,nspec
+          Y0(n) = Wch(ib,CFS+n-1) * rhoInv
+       end do
+       call floor_species(nspec, Y0)
+       W(i,UEDEN) = Wch(ib,4) + rho * eos_get_eref(Y0)
+       do n=1,nspec
+          W(i,UFS+n-1) = rho*Y0(n)
+       end do
+    end do
+
+  end subroutine scatter_char
+
+end module charrecon_module
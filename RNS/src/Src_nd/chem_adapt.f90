@@ -0,0 +1,83 @@
+module chem_adapt_module
+
+  ! Adaptive burning for the Gauss-point chemistry solvers.  Burning at
+  ! every Gauss point only pays off where the state varies within the cell.
+  ! A cell whose Gauss-point states all lie within chem_adapt_tol of their
+  ! average (relative change in T, absolute change in Y) is burned once at
+  ! that average instead.
+
+  use meth_params_module, only : NSPEC, chem_adapt_tol
+  use passinfo_module, only : level
+
+  implicit none
+
+  integer, parameter :: max_lev = 32
+
+  ! cells burned at the Gauss points and at the average on each level
+  integer, save :: ngauss  (0:max_lev-1) = 0
+  integer, save :: naverage(0:max_lev-1) = 0
+
+  private
+
+  public :: chem_adapt_select, chem_adapt_counts
+
+contains
+
+  ! On entry, rho(1:np) and YT(:,1:np) are the Gauss-point states of a cell.
+  ! If the cell is smooth, they are replaced by their average in rho(1) and
+  ! YT(:,1), and ng = 1; otherwise ng = np and nothing is changed.  Y is
+  ! averaged with weight rho so that rho(1)*YT(1:nspec,1) is the average of
+  ! rho*Y.
+  subroutine chem_adapt_select(np, rho, YT, ng)
+    integer, intent(in) :: np
+    double precision, intent(inout) :: rho(np), YT(nspec+1,np)
+    integer, intent(out) :: ng
+
+    integer :: g, n
+    double precision :: rho0, YT0(nspec+1), dmax
+
+    ng = np
+
+    rho0 = 0.d0
+    YT0 = 0.d0
+    do g=1,np
+       rho0 = rho0 + rho(g)
+       do n=1,nspec
+          YT0(n) = YT0(n) + rho(g)*YT(n,g)
+       end do
+       YT0(nspec+1) = YT0(nspec+1) + YT(nspec+1,g)
+    end do
+    YT0(1:nspec) = YT0(1:nspec) / rho0
+    YT0(nspec+1) = YT0(nspec+1) / np
+    rho0 = rho0 / np
+
+    dmax = 0.d0
+    do g=1,np
+       dmax = max(dmax, abs(YT(nspec+1,g)-YT0(nspec+1))/YT0(nspec+1))
+       do n=1,nspec
+          dmax = max(dmax, abs(YT(n,g)-YT0(n)))
+       end do
+    end do
+
+    if (dmax .le. chem_adapt_tol) then
+       ng = 1
+       rho(1) = rho0
+       YT(:,1) = YT0
+       !$omp atomic
+       naverage(min(level,max_lev-1)) = naverage(min(level,max_lev-1)) + 1
+    else
+       !$omp atomic
+       ngauss(min(level,max_lev-1)) = ngauss(min(level,max_lev-1)) + 1
+    end if
+
+  end subroutine chem_adapt_select
+
+
+  subroutine chem_adapt_counts(lev, ngp, navg)
+    integer, intent(in) :: lev
+    integer, intent(out) :: ngp, navg
+    ngp  = ngauss  (min(lev,max_lev-1))
+    navg = naverage(min(lev,max_lev-1))
+  end subroutine chem_adapt_counts
+
+end module chem_adapt_module
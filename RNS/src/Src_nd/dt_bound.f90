@@ -0,0 +1,14 @@
+module dt_bound_module
+
+  ! Time step bounds gathered on the side of an advection-diffusion
+  ! evaluation, so that estTimeStep does not need a sweep of its own.  While
+  ! dt_bound_on, rns_dudt_ad lowers dt_bound_adv and difterm lowers
+  ! dt_bound_diff.  Neither includes the CFL factor.
+
+  implicit none
+
+  logical, save :: dt_bound_on = .false.
+  double precision, save :: dt_bound_adv  = 1.d50
+  double precision, save :: dt_bound_diff = 1.d50
+
+end module dt_bound_module
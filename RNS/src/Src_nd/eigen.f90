@@ -3,7 +3,7 @@ module eigen_module
 
   private
 
-  public :: get_eigen_matrices
+  public :: get_eigen_matrices, get_eigen_matrices_soa
 
 contains
 
@@ -128,4 +128,153 @@ contains
 
   end subroutine get_eigen_matrices
 
+  ! Same as get_eigen_matrices, but for np points at once.  The point index
+  ! runs fastest in lv and rv so that the assembly and the projections done
+  ! with them vectorize across points.
+  subroutine get_eigen_matrices_soa(np, ld, rho, Y, T, vel, lv, rv)
+    use meth_params_module, only : NSPEC, NCHARV, CFS
+    use eos_module, only : eos_given_RTY, eos_get_eref
+
+    integer, intent(in) :: np, ld
+    double precision, intent(in) :: rho(ld), Y(NSPEC,ld), T(ld), vel(ld,3)
+    double precision, intent(out), dimension(ld,NCHARV,NCHARV) :: lv, rv
+
+    integer :: i, m, n
+    double precision, dimension(np) :: p, c, gamc, dpde, e, ek, H, b, cinv, gtinv
+    double precision :: dpdr(np,NSPEC), d(np,NSPEC), dpdr1(NSPEC)
+
+    do i=1,np
+       call eos_given_RTY(e(i), p(i), c(i), gamc(i), dpdr1, dpde(i), rho(i), T(i), Y(:,i))
+       e(i) = e(i) - eos_get_eref(Y(:,i))
+       do n=1,nspec
+          dpdr(i,n) = dpdr1(n)
+       end do
+    end do
+
+    !DEC$ SIMD
+    do i=1,np
+       ek(i) = 0.5d0*(vel(i,1)**2 + vel(i,2)**2 + vel(i,3)**2)
+       H(i) = e(i) + p(i)/rho(i) + ek(i)
+       cinv(i) = 1.d0/c(i)
+       b(i) = dpde(i)/rho(i)*cinv(i)*cinv(i)
+       gtinv(i) = rho(i)/dpde(i)
+    end do
+
+    do n=1,nspec
+       !DEC$ SIMD
+       do i=1,np
+          d(i,n) = b(i)*(ek(i) - e(i) + dpdr(i,n)*gtinv(i))
+       end do
+    end do
+
+    ! assemble left vectors
+    !DEC$ SIMD
+    do i=1,np
+       lv(i,1,1) = -0.5d0*(cinv(i) + b(i)*vel(i,1))
+       lv(i,2,1) = -0.5d0*b(i)*vel(i,2)
+       lv(i,3,1) = -0.5d0*b(i)*vel(i,3)
+       lv(i,4,1) =  0.5d0*b(i)
+
+       lv(i,1,2) =  0.5d0*(cinv(i) - b(i)*vel(i,1))
+       lv(i,2,2) = -0.5d0*b(i)*vel(i,2)
+       lv(i,3,2) = -0.5d0*b(i)*vel(i,3)
+       lv(i,4,2) =  0.5d0*b(i)
+
+       lv(i,1,3) = 0.d0
+       lv(i,2,3) = 1.d0
+       lv(i,3,3) = 0.d0
+       lv(i,4,3) = 0.d0
+
+       lv(i,1,4) = 0.d0
+       lv(i,2,4) = 0.d0
+       lv(i,3,4) = 1.d0
+       lv(i,4,4) = 0.d0
+    end do
+
+    do n=1,nspec
+       !DEC$ SIMD
+       do i=1,np
+          lv(i,CFS+n-1,1) = 0.5d0*( vel(i,1)*cinv(i) + d(i,n))
+          lv(i,CFS+n-1,2) = 0.5d0*(-vel(i,1)*cinv(i) + d(i,n))
+          lv(i,CFS+n-1,3) = -vel(i,2)
+          lv(i,CFS+n-1,4) = -vel(i,3)
+       end do
+    end do
+
+    do m=1,nspec
+       !DEC$ SIMD
+       do i=1,np
+          lv(i,1,CFS+m-1) =  Y(m,i)*b(i)*vel(i,1)
+          lv(i,2,CFS+m-1) =  Y(m,i)*b(i)*vel(i,2)
+          lv(i,3,CFS+m-1) =  Y(m,i)*b(i)*vel(i,3)
+          lv(i,4,CFS+m-1) = -Y(m,i)*b(i)
+       end do
+       do n=1,nspec
+          !DEC$ SIMD
+          do i=1,np
+             lv(i,CFS+n-1,CFS+m-1) = -Y(m,i)*d(i,n)
+          end do
+       end do
+       !DEC$ SIMD
+       do i=1,np
+          lv(i,CFS+m-1,CFS+m-1) = lv(i,CFS+m-1,CFS+m-1) + 1.d0
+       end do
+    end do
+
+    ! assemble right vectors
+    !DEC$ SIMD
+    do i=1,np
+       rv(i,1,1) = vel(i,1) - c(i)
+       rv(i,2,1) = vel(i,2)
+       rv(i,3,1) = vel(i,3)
+       rv(i,4,1) = H(i) - vel(i,1)*c(i)
+
+       rv(i,1,2) = vel(i,1) + c(i)
+       rv(i,2,2) = vel(i,2)
+       rv(i,3,2) = vel(i,3)
+       rv(i,4,2) = H(i) + vel(i,1)*c(i)
+
+       rv(i,1,3) = 0.d0
+       rv(i,2,3) = 1.d0
+       rv(i,3,3) = 0.d0
+       rv(i,4,3) = vel(i,2)
+
+       rv(i,1,4) = 0.d0
+       rv(i,2,4) = 0.d0
+       rv(i,3,4) = 1.d0
+       rv(i,4,4) = vel(i,3)
+    end do
+
+    do n=1,nspec
+       !DEC$ SIMD
+       do i=1,np
+          rv(i,CFS+n-1,1) = Y(n,i)
+          rv(i,CFS+n-1,2) = Y(n,i)
+          rv(i,CFS+n-1,3) = 0.d0
+          rv(i,CFS+n-1,4) = 0.d0
+       end do
+    end do
+
+    do n=1,nspec
+       !DEC$ SIMD
+       do i=1,np
+          rv(i,1,CFS+n-1) = vel(i,1)
+          rv(i,2,CFS+n-1) = vel(i,2)
+          rv(i,3,CFS+n-1) = vel(i,3)
+          rv(i,4,CFS+n-1) = e(i) + ek(i) - dpdr(i,n)*gtinv(i)
+       end do
+       do m=1,nspec
+          !DEC$ SIMD
+          do i=1,np
+             rv(i,CFS+m-1,CFS+n-1) = 0.d0
+          end do
+       end do
+       !DEC$ SIMD
+       do i=1,np
+          rv(i,CFS+n-1,CFS+n-1) = 1.d0
+       end do
+    end do
+
+  end subroutine get_eigen_matrices_soa
+
 end module eigen_module
@@ -20,7 +20,7 @@ module mdcd_module
 
   private
 
-  public :: init_mdcd, mdcd
+  public :: init_mdcd, mdcd, vmdcd
 
 contains
 
@@ -69,4 +69,50 @@ contains
 
   end subroutine mdcd
 
+
+  ! mdcd for np independent stencils; v(i,:) is the stencil of point i.
+  subroutine vmdcd(np, ld, v, vl, vr)
+    integer, intent(in) :: np, ld
+    double precision, intent(in) :: v(ld,-2:3)
+    double precision, intent(out) :: vl(ld), vr(ld)
+
+    integer :: i
+    double precision :: vk0, vk1, vk2, vk3, wk0, wk1, wk2, wk3, IS0, IS1, IS2, IS3
+
+    !DEC$ SIMD
+    do i=1,np
+       IS0 = eps + b1*(v(i,-2)-2.d0*v(i,-1)+v(i,0))**2 + 0.25d0*(v(i,-2)-4.d0*v(i,-1)+3.d0*v(i,0))**2
+       IS1 = eps + b1*(v(i,-1)-2.d0*v(i, 0)+v(i,1))**2 + 0.25d0*(v(i,-1)-v(i,1))**2
+       IS2 = eps + b1*(v(i, 0)-2.d0*v(i, 1)+v(i,2))**2 + 0.25d0*(3.d0*v(i,0)-4.d0*v(i,1)+v(i,2))**2
+       IS3 = eps + b1*(v(i, 1)-2.d0*v(i, 2)+v(i,3))**2 + 0.25d0*(5.d0*v(i,1)-8.d0*v(i,2)+3.d0*v(i,3))**2
+       IS3 = max(IS0, IS1, IS2, IS3)
+
+       wk0 = Ck(0) / IS0**wenop
+       wk1 = Ck(1) / IS1**wenop
+       wk2 = Ck(2) / IS2**wenop
+       wk3 = Ck(3) / IS3**wenop
+
+       vk0 = ( 2.d0*v(i,-2) - 7.d0*v(i,-1) + 11.d0*v(i,0))*oneSixth
+       vk1 = (     -v(i,-1) + 5.d0*v(i, 0) +  2.d0*v(i,1))*oneSixth
+       vk2 = ( 2.d0*v(i, 0) + 5.d0*v(i, 1) -       v(i,2))*oneSixth
+       vk3 = (11.d0*v(i, 1) - 7.d0*v(i, 2) +  2.d0*v(i,3))*oneSixth
+
+       vl(i) = (wk0*vk0 + wk1*vk1 + wk2*vk2 + wk3*vk3) / (wk0 + wk1 + wk2 + wk3)
+
+       IS0 = eps + b1*(v(i,3)-2.d0*v(i, 2)+v(i, 1))**2 + 0.25d0*(v(i,3)-4.d0*v(i,2)+3.d0*v(i,1))**2
+       IS1 = eps + b1*(v(i,2)-2.d0*v(i, 1)+v(i, 0))**2 + 0.25d0*(v(i,2)-v(i,0))**2
+       IS2 = eps + b1*(v(i,1)-2.d0*v(i, 0)+v(i,-1))**2 + 0.25d0*(3.d0*v(i,1)-4.d0*v(i,0)+v(i,-1))**2
+       IS3 = eps + b1*(v(i,0)-2.d0*v(i,-1)+v(i,-2))**2 + 0.25d0*(5.d0*v(i,0)-8.d0*v(i,-1)+3.d0*v(i,-2))**2
+       IS3 = max(IS0, IS1, IS2, IS3)
+
+       wk0 = Ck(0) / IS0**wenop
+       wk1 = Ck(1) / IS1**wenop
+       wk2 = Ck(2) / IS2**wenop
+       wk3 = Ck(3) / IS3**wenop
+
+       vr(i) = (wk0*vk3 + wk1*vk2 + wk2*vk1 + wk3*vk0) / (wk0 + wk1 + wk2 + wk3)
+    end do
+
+  end subroutine vmdcd
+
 end module mdcd_module
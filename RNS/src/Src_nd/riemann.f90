@@ -1,5 +1,12 @@
 module riemann_module
 
+  ! Riemann solvers on a pencil of faces.  Faces are processed in blocks of
+  ! nb: the left and right states of a block are evaluated once (one EOS call
+  ! per face) into SoA arrays, and the solver and flux loops then run across
+  ! the faces of the block without calls or per-face branches.  The state
+  ! evaluation is shared with the HLL flux, so HLL_factor blending costs one
+  ! more pass over the block instead of a second Riemann solve.
+
   use meth_params_module, only : ndim, NVAR, URHO, UMX, UMY, UMZ, UEDEN, UTEMP, UFS, NSPEC, &
        riemann_solver, HLL_solver, JBB_solver, HLLC_solver, HLL_factor
   use renorm_module, only : floor_species
@@ -7,6 +14,14 @@ module riemann_module
 
   implicit none
 
+  integer, parameter :: nb = 64
+
+  ! Primitive state on the faces of a block; velocity is in
+  ! (normal, tangential, tangential) order.
+  type face_state
+     double precision :: r(nb), rinv(nb), v(nb,3), p(nb), c(nb), gamc(nb), re(nb)
+  end type face_state
+
   private
 
   public riemann
@@ -20,237 +35,199 @@ contains
     double precision, intent(in ) ::  UR(Ulo:Uhi,NVAR)
     double precision              :: flx(flo:fhi,NVAR)
 
-    double precision, allocatable :: flxHLL(:,:)
+    integer :: i0, np, ivel(3)
+    logical :: hll, zlo, zhi
+    double precision :: vflag(3)
+    type(face_state) :: ql, qr
 
-    select case (riemann_solver)
-    case (HLL_solver)
-       call riemann_HLL(lo, hi, UL(lo:hi+1,:), UR(lo:hi+1,:), flx(lo:hi+1,:), dir)
-    case (JBB_solver)
-       call riemann_JBB(lo, hi, UL(lo:hi+1,:), UR(lo:hi+1,:), flx(lo:hi+1,:), dir,bc_flag)
-    case (HLLC_solver)
-       call riemann_HLLC(lo, hi, UL(lo:hi+1,:), UR(lo:hi+1,:), flx(lo:hi+1,:), dir)
-    case default
+    if (riemann_solver.ne.HLL_solver .and. riemann_solver.ne.JBB_solver &
+         .and. riemann_solver.ne.HLLC_solver) then
        print *, 'unknown riemann solver'
        stop
-    end select
-
-    if (HLL_factor .gt. 0.d0) then
-       allocate(flxHLL(lo:hi+1,NVAR))
-       call riemann_HLL(lo, hi, UL(lo:hi+1,:), UR(lo:hi+1,:), flxHLL, dir)
-       flx(lo:hi+1,:) = (1.d0-HLL_factor)*flx(lo:hi+1,:) + HLL_factor*flxHLL
-       deallocate(flxHLL)
     end if
 
-  end subroutine riemann
+    call set_vel(dir, ivel, vflag)
 
-  subroutine riemann_HLL(lo, hi, UL, UR, flx, dir)
-    integer, intent(in) :: lo, hi
-    integer, intent(in) :: dir
-    double precision, intent(in ) ::  UL(lo:hi+1,NVAR)
-    double precision, intent(in ) ::  UR(lo:hi+1,NVAR)
-    double precision, intent(out) :: flx(lo:hi+1,NVAR)
-
-    integer :: i, n
-    double precision :: aainv
-    double precision, allocatable :: fl(:,:),fr(:,:),alpha_plus(:),alpha_mins(:),alpha_pm(:)
-
-    allocate(fl(lo:hi+1,NVAR))
-    allocate(fr(lo:hi+1,NVAR))
-    allocate(alpha_plus(lo:hi+1))
-    allocate(alpha_mins(lo:hi+1))
-    allocate(alpha_pm  (lo:hi+1))
-
-    do i = lo, hi+1
-       alpha_plus(i) = 0.d0
-       alpha_mins(i) = 0.d0
-    end do
+    hll = riemann_solver .eq. HLL_solver
 
-    call compute_flux_and_alpha(lo, hi, UL, fl, alpha_plus, alpha_mins, dir)
-    call compute_flux_and_alpha(lo, hi, UR, fr, alpha_plus, alpha_mins, dir)
+    do i0=lo,hi+1,nb
+       np = min(nb, hi+2-i0)
 
-    do i = lo, hi+1
-       aainv = 1.d0 / (alpha_plus(i) + alpha_mins(i))
-       alpha_pm(i) = alpha_plus(i) * alpha_mins(i) * aainv
-       alpha_plus(i) = alpha_plus(i) * aainv
-       alpha_mins(i) = 1.d0 - alpha_plus(i)
-    end do
+       call face_states(np, i0, UL, Ulo, Uhi, ivel, vflag, hll, ql)
+       call face_states(np, i0, UR, Ulo, Uhi, ivel, vflag, hll, qr)
 
-    do n=1,NVAR
-       if (n.eq.UTEMP) then
-          do i = lo, hi+1
-             flx(i,n) = 0.d0
-          end do
-       else
-          do i = lo, hi+1
-             flx(i,n) = alpha_plus(i) * fl(i,n) + alpha_mins(i) * fr(i,n) &
-                  - alpha_pm(i) * (UR(i,n) - UL(i,n))
-          end do
+       select case (riemann_solver)
+       case (HLL_solver)
+          call flux_HLL(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel(1), 1.d0, flx, flo, fhi)
+       case (JBB_solver)
+          ! special boundary: zero normal velocity on the first or last face
+          zlo = i0 .eq. lo .and. bc_flag(1).eq.0
+          zhi = i0+np-1 .eq. hi+1 .and. bc_flag(2).eq.0
+          call flux_JBB(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel, zlo, zhi, flx, flo, fhi)
+       case (HLLC_solver)
+          call flux_HLLC(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel, flx, flo, fhi)
+       end select
+
+       if (HLL_factor .gt. 0.d0 .and. .not.hll) then
+          call flux_HLL(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel(1), HLL_factor, flx, flo, fhi)
        end if
     end do
 
-    deallocate(fl,fr,alpha_plus,alpha_mins,alpha_pm)
-  end subroutine riemann_HLL
-
-
-  subroutine compute_flux_and_alpha(lo, hi, U, F, ap, am, dir)
-    use eos_module, only : eos_given_ReY, eos_given_RTY, allow_negative_energy
-    integer, intent(in) :: lo, hi
-    integer, intent(in) :: dir
-    double precision, intent(in   ) ::  U(lo:hi+1,NVAR)
-    double precision, intent(out  ) ::  F(lo:hi+1,NVAR)
-    double precision, intent(inout) :: ap(lo:hi+1)
-    double precision, intent(inout) :: am(lo:hi+1)
+  end subroutine riemann
 
-    integer :: i, n, ierr
-    double precision :: rho, m(3), rhoE, v(3), vn
-    double precision :: rhoInv, p, c, gamc, dpdr(NSPEC), dpde, T, e, ek, Y(NSPEC)
 
-    do i=lo,hi+1
+  ! Evaluate the states U(i0:i0+np-1,:).  With hll, density is not floored and
+  ! species are floored before the EOS call, which is also allowed to fail.
+  subroutine face_states(np, i0, U, Ulo, Uhi, ivel, vflag, hll, s)
+    use eos_module, only : smalld, eos_given_ReY, eos_given_RTY, allow_negative_energy
+    integer, intent(in) :: np, i0, Ulo, Uhi, ivel(3)
+    double precision, intent(in) :: U(Ulo:Uhi,NVAR), vflag(3)
+    logical, intent(in) :: hll
+    type(face_state), intent(out) :: s
 
-       rho  = U(i,URHO)
-       m(1) = U(i,UMX)
-       if (ndim .ge. 2) then
-          m(2) = U(i,UMY)
-       else
-          m(2) = 0.d0
-       end if
-       if (ndim .eq. 3) then
-          m(3) = U(i,UMZ)
-       else
-          m(3) = 0.d0
-       end if
-       rhoE = U(i,UEDEN)
-       
-       rhoInv = 1.0d0/rho
-       v      = m*rhoInv
-       T      = U(i,UTEMP)
-       
-       ek = 0.5d0*(v(1)*v(1) + v(2)*v(2) + v(3)*v(3))
-       e  = rhoE*rhoInv - ek
+    integer :: i, ib, n, ierr
+    double precision :: T, e, Y(NSPEC), dpdr(NSPEC), dpde
 
-       Y = U(i,UFS:UFS+NSPEC-1)*rhoInv
+    if (hll) then
+       do ib=1,np
+          s%r(ib) = U(i0+ib-1,URHO)
+       end do
+    else
+       do ib=1,np
+          s%r(ib) = max(U(i0+ib-1,URHO), smalld)
+       end do
+    end if
 
-       call floor_species(nspec, Y)
+    do ib=1,np
+       i = i0+ib-1
+       s%rinv(ib) = 1.d0/s%r(ib)
+       s%v(ib,1) = U(i,ivel(1)) * vflag(1) * s%rinv(ib)
+       s%v(ib,2) = U(i,ivel(2)) * vflag(2) * s%rinv(ib)
+       s%v(ib,3) = U(i,ivel(3)) * vflag(3) * s%rinv(ib)
+       s%re(ib) = U(i,UEDEN) - 0.5d0*s%r(ib)*(s%v(ib,1)**2+s%v(ib,2)**2+s%v(ib,3)**2)
+    end do
 
+    do ib=1,np
+       i = i0+ib-1
+       T = U(i,UTEMP)
+       e = s%re(ib) * s%rinv(ib)
+       do n=1,NSPEC
+          Y(n) = U(i,UFS+n-1) * s%rinv(ib)
+       end do
+       if (hll) call floor_species(nspec, Y)
        if ((e .le. 0.d0) .and. (allow_negative_energy .eqv. .false.)) then
-          call eos_given_RTY(e,p,c,gamc,dpdr,dpde,rho,T,Y)
+          call eos_given_RTY(e, s%p(ib), s%c(ib), s%gamc(ib), dpdr, dpde, s%r(ib), T, Y)
+       else if (hll) then
+          call eos_given_ReY(s%p(ib), s%c(ib), s%gamc(ib), T, dpdr, dpde, s%r(ib), e, Y, ierr=ierr)
        else
-          call eos_given_ReY(p,c,gamc,T,dpdr,dpde,rho,e,Y,ierr=ierr)
+          call eos_given_ReY(s%p(ib), s%c(ib), s%gamc(ib), T, dpdr, dpde, s%r(ib), e, Y)
        end if
+    end do
 
-       vn = v(dir)
-
-       ap(i) = max(ap(i), c+vn)
-       am(i) = max(am(i), c-vn)
+  end subroutine face_states
+
+
+  ! flx = (1-wt)*flx + wt*F_HLL on faces i0:i0+np-1.  With wt = 1, flx is
+  ! only written.  inorm is the normal momentum component.
+  subroutine flux_HLL(np, i0, UL, UR, Ulo, Uhi, ql, qr, inorm, wt, flx, flo, fhi)
+    integer, intent(in) :: np, i0, Ulo, Uhi, inorm, flo, fhi
+    double precision, intent(in) :: UL(Ulo:Uhi,NVAR), UR(Ulo:Uhi,NVAR), wt
+    type(face_state), intent(in) :: ql, qr
+    double precision, intent(inout) :: flx(flo:fhi,NVAR)
+
+    integer :: i, ib, n
+    double precision :: ap, am, aainv, f
+    double precision :: apl(nb), amr(nb), apm(nb), pfl(nb), pfr(nb)
+
+    !DEC$ SIMD
+    do ib=1,np
+       ap = max(0.d0, ql%c(ib)+ql%v(ib,1), qr%c(ib)+qr%v(ib,1))
+       am = max(0.d0, ql%c(ib)-ql%v(ib,1), qr%c(ib)-qr%v(ib,1))
+       aainv = 1.d0 / (ap + am)
+       apm(ib) = ap * am * aainv
+       apl(ib) = ap * aainv
+       amr(ib) = 1.d0 - apl(ib)
+       ! left and right fluxes are U*vn, plus p in the normal momentum
+       ! and p*vn in the energy
+       pfl(ib) = apl(ib) * ql%v(ib,1)
+       pfr(ib) = amr(ib) * qr%v(ib,1)
+    end do
 
-       F(i,URHO ) = rho*vn
-       F(i,UMX  ) = m(1)*vn
-       if (ndim .ge. 2) then
-          F(i,UMY  ) = m(2)*vn
+    do n=1,NVAR
+       if (n.eq.UTEMP) then
+          do ib=1,np
+             flx(i0+ib-1,n) = 0.d0
+          end do
+          cycle
        end if
-       if (ndim .eq. 3) then
-          F(i,UMZ  ) = m(3)*vn
+       if (wt .eq. 1.d0) then
+          !DEC$ SIMD
+          do ib=1,np
+             i = i0+ib-1
+             flx(i,n) = pfl(ib)*UL(i,n) + pfr(ib)*UR(i,n) - apm(ib)*(UR(i,n)-UL(i,n))
+          end do
+       else
+          !DEC$ SIMD
+          do ib=1,np
+             i = i0+ib-1
+             f = pfl(ib)*UL(i,n) + pfr(ib)*UR(i,n) - apm(ib)*(UR(i,n)-UL(i,n))
+             flx(i,n) = (1.d0-wt)*flx(i,n) + wt*f
+          end do
        end if
-       F(i,UMX+dir-1) = F(i,UMX+dir-1) + p
-       F(i,UEDEN) = (rhoE + p) * vn
-       F(i,UTEMP) = 0.d0
-       do n=1,NSPEC
-          F(i,UFS+n-1) = U(i,UFS+n-1)*vn
-       end do
     end do
-  end subroutine compute_flux_and_alpha
 
+    ! pressure terms
+    !DEC$ SIMD
+    do ib=1,np
+       i = i0+ib-1
+       flx(i,inorm) = flx(i,inorm) + wt*(apl(ib)*ql%p(ib) + amr(ib)*qr%p(ib))
+       flx(i,UEDEN) = flx(i,UEDEN) + wt*(pfl(ib)*ql%p(ib) + pfr(ib)*qr%p(ib))
+    end do
 
-  subroutine riemann_JBB(lo, hi, UL, UR, flx, dir, bc_flag)
-    use eos_module, only : smalld, smallp, eos_given_ReY, eos_given_RTY, allow_negative_energy
-    integer, intent(in) :: lo, hi
-    integer, intent(in) :: dir, bc_flag(2)
-    double precision, intent(in ) ::  UL(lo:hi+1,NVAR)
-    double precision, intent(in ) ::  UR(lo:hi+1,NVAR)
-    double precision, intent(out) :: flx(lo:hi+1,NVAR)
-
-    integer :: i, n, ivel(3), idim
-    double precision :: vflag(3), dpdr(NSPEC), dpde
-    double precision :: rgdnv,regdnv, pgdnv, vgdnv(3), ekgdnv
-    double precision :: rl, retl, Tl, Yl(NSPEC), vl(3), el, pl, rel, rinvl
-    double precision :: rr, retr, Tr, Yr(NSPEC), vr(3), er, pr, rer, rinvr
-    double precision :: wl, cl, gamcl
-    double precision :: wr, cr, gamcr
-    double precision :: csmall, wsmall 
+  end subroutine flux_HLL
+
+
+  ! zlo and zhi zero the normal velocity on the first and last face.
+  subroutine flux_JBB(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel, zlo, zhi, flx, flo, fhi)
+    use eos_module, only : smalld, smallp
+    integer, intent(in) :: np, i0, Ulo, Uhi, ivel(3), flo, fhi
+    double precision, intent(in) :: UL(Ulo:Uhi,NVAR), UR(Ulo:Uhi,NVAR)
+    type(face_state), intent(in) :: ql, qr
+    logical, intent(in) :: zlo, zhi
+    double precision, intent(inout) :: flx(flo:fhi,NVAR)
+
+    integer :: i, ib, n, idim
+    double precision :: rgdnv(nb), regdnv(nb), pgdnv(nb), vgdnv(nb,3), wup(nb)
+    double precision :: wl, wr, csmall, wsmall
     double precision :: rstar, cstar, estar, pstar, ustar
     double precision :: ro, uo, po, reo, gamco, co, entho
     double precision :: sgnm, spout, spin, ushock, scr, frac
-    double precision :: wwinv, roinv, coinv2
-    
-    double precision, parameter :: small  = 1.d-8
-
-    call set_vel(dir, ivel, vflag)
-
-    do i=lo,hi+1
-       
-       rl    = max(UL(i,URHO), smalld)
-       rinvl = 1.d0/rl
-       vl(1) = UL(i,ivel(1)) * vflag(1) * rinvl
-       vl(2) = UL(i,ivel(2)) * vflag(2) * rinvl
-       vl(3) = UL(i,ivel(3)) * vflag(3) * rinvl
-       Tl    = UL(i,UTEMP)
-       retl  = UL(i,UEDEN)
-       Yl    = UL(i,UFS:UFS+nspec-1) * rinvl
-       rel   = retl - 0.5d0*rl*(vl(1)**2+vl(2)**2+vl(3)**2)
-       el    = rel * rinvl       
-       if ((el .le. 0.d0) .and. (allow_negative_energy .eqv. .false.)) then
-          call eos_given_RTY(el, pl, cl, gamcl, dpdr, dpde, rl, Tl, Yl)
-       else
-          call eos_given_ReY(pl, cl, gamcl, Tl, dpdr, dpde, rl, el, Yl)
-       end if
+    double precision :: wwinv, roinv, coinv2, ekgdnv
 
-       rr    = max(UR(i,URHO), smalld)
-       rinvr = 1.d0/rr
-       vr(1) = UR(i,ivel(1)) * vflag(1) * rinvr
-       vr(2) = UR(i,ivel(2)) * vflag(2) * rinvr
-       vr(3) = UR(i,ivel(3)) * vflag(3) * rinvr
-       Tr    = UR(i,UTEMP)
-       retr  = UR(i,UEDEN)
-       Yr    = UR(i,UFS:UFS+nspec-1) * rinvr
-       rer   = retr - 0.5d0*rr*(vr(1)**2+vr(2)**2+vr(3)**2)
-       er    = rer * rinvr       
-       if ((er .le. 0.d0) .and. (allow_negative_energy .eqv. .false.)) then
-          call eos_given_RTY(er, pr, cr, gamcr, dpdr, dpde, rr, Tr, Yr)
-       else
-          call eos_given_ReY(pr, cr, gamcr, Tr, dpdr, dpde, rr, er, Yr)
-       end if
+    double precision, parameter :: small  = 1.d-8
 
-       csmall = max(small, small*cl, small*cr)
+    !DEC$ SIMD
+    do ib=1,np
+       csmall = max(small, small*ql%c(ib), small*qr%c(ib))
        wsmall = smalld*csmall
-       wl = max(wsmall, cl*rl)
-       wr = max(wsmall, cr*rr)
+       wl = max(wsmall, ql%c(ib)*ql%r(ib))
+       wr = max(wsmall, qr%c(ib)*qr%r(ib))
 
        wwinv = 1.d0/(wl + wr)
-       pstar = ((wr*pl + wl*pr) + wl*wr*(vl(1) - vr(1)))*wwinv
-       ustar = ((wl*vl(1) + wr*vr(1)) + (pl - pr))*wwinv
+       pstar = ((wr*ql%p(ib) + wl*qr%p(ib)) + wl*wr*(ql%v(ib,1) - qr%v(ib,1)))*wwinv
+       ustar = ((wl*ql%v(ib,1) + wr*qr%v(ib,1)) + (ql%p(ib) - qr%p(ib)))*wwinv
        pstar = max(pstar,smallp)
 
-       if (ustar .gt. 0.d0) then
-          ro = rl
-          uo = vl(1)
-          po = pl
-          reo = rel
-          gamco = gamcl
-       else if (ustar .lt. 0.d0) then
-          ro = rr
-          uo = vr(1)
-          po = pr
-          reo = rer
-          gamco = gamcr
-       else
-          ro = 0.5d0*(rl+rr)
-          uo = 0.5d0*(vl(1)+vr(1))
-          po = 0.5d0*(pl+pr)
-          reo = 0.5d0*(rel+rer)
-          gamco = 0.5d0*(gamcl+gamcr)
-       endif
+       ! upwind weight: 1 for left, 0 for right and 1/2 if ustar = 0
+       wup(ib) = merge(1.d0, merge(0.d0, 0.5d0, ustar .lt. 0.d0), ustar .gt. 0.d0)
+
+       ro    = wup(ib)*ql%r(ib)    + (1.d0-wup(ib))*qr%r(ib)
+       uo    = wup(ib)*ql%v(ib,1)  + (1.d0-wup(ib))*qr%v(ib,1)
+       po    = wup(ib)*ql%p(ib)    + (1.d0-wup(ib))*qr%p(ib)
+       reo   = wup(ib)*ql%re(ib)   + (1.d0-wup(ib))*qr%re(ib)
+       gamco = wup(ib)*ql%gamc(ib) + (1.d0-wup(ib))*qr%gamc(ib)
        ro = max(smalld,ro)
-       
+
        roinv = 1.d0/ro
        co = sqrt(abs(gamco*po*roinv))
        co = max(csmall,co)
@@ -266,222 +243,142 @@ contains
        spout = co - sgnm*uo
        spin = cstar - sgnm*ustar
        ushock = 0.5d0*(spin + spout)
-       if (pstar-po .ge. 0.d0) then
-          spin = ushock
-          spout = ushock
-       endif
-       if (spout-spin .eq. 0.d0) then
-          scr = small*0.5d0*(cl+cr)
-       else
-          scr = spout-spin
-       endif
+       spin  = merge(ushock, spin , pstar-po .ge. 0.d0)
+       spout = merge(ushock, spout, pstar-po .ge. 0.d0)
+       scr = merge(small*0.5d0*(ql%c(ib)+qr%c(ib)), spout-spin, spout-spin .eq. 0.d0)
        frac = (1.d0 + (spout + spin)/scr)*0.5d0
        frac = max(0.d0,min(1.d0,frac))
 
-       if (ustar .gt. 0.d0) then
-          vgdnv(2:3) = vl(2:3)
-       else if (ustar .lt. 0.d0) then
-          vgdnv(2:3) = vr(2:3)
-       else
-          vgdnv(2:3) = 0.5d0*(vl(2:3)+vr(2:3))
-       endif
-       rgdnv = frac*rstar + (1.d0 - frac)*ro
-
-       vgdnv(1) = frac*ustar + (1.d0 - frac)*uo
-       pgdnv    = frac*pstar + (1.d0 - frac)*po
-
-       regdnv = frac*estar + (1.d0 - frac)*reo
-       if (spout .lt. 0.d0) then
-          rgdnv    = ro
-          vgdnv(1) = uo
-          pgdnv    = po
-          regdnv   = reo
-       endif
-       if (spin .ge. 0.d0) then
-          rgdnv    = rstar
-          vgdnv(1) = ustar
-          pgdnv    = pstar
-          regdnv   = estar
-       endif
-
-       pgdnv = max(pgdnv,smallp)
-
-       ! special boundary
-       if (i.eq.lo   .and. bc_flag(1).eq.0) vgdnv(1) = 0.d0
-       if (i.eq.hi+1 .and. bc_flag(2).eq.0) vgdnv(1) = 0.d0
-
-       flx(i,URHO) = rgdnv*vgdnv(1)
-
-       ekgdnv = 0.d0
-       do idim=1,ndim
-          flx(i,ivel(idim)) = flx(i,URHO)*vgdnv(idim)
-          ekgdnv = ekgdnv + 0.5d0*vgdnv(idim)**2
-       end do
-       flx(i,ivel(1)) = flx(i,ivel(1)) + pgdnv
+       ! spin >= 0 wins over spout < 0
+       frac = merge(0.d0, frac, spout .lt. 0.d0)
+       frac = merge(1.d0, frac, spin .ge. 0.d0)
 
-       flx(i,UEDEN) = vgdnv(1)*(regdnv + rgdnv*ekgdnv + pgdnv)
-       flx(i,UTEMP) = 0.d0
+       rgdnv(ib)   = frac*rstar + (1.d0 - frac)*ro
+       vgdnv(ib,1) = frac*ustar + (1.d0 - frac)*uo
+       pgdnv(ib)   = frac*pstar + (1.d0 - frac)*po
+       regdnv(ib)  = frac*estar + (1.d0 - frac)*reo
 
-       if (ustar .gt. 0.d0) then
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yl(n)
-          end do
-       else if (ustar .lt. 0.d0) then
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yr(n)
-          end do
-       else 
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * 0.5d0*(Yl(n)+Yr(n))
-          end do
-       end if
+       pgdnv(ib) = max(pgdnv(ib),smallp)
 
+       vgdnv(ib,2) = wup(ib)*ql%v(ib,2) + (1.d0-wup(ib))*qr%v(ib,2)
+       vgdnv(ib,3) = wup(ib)*ql%v(ib,3) + (1.d0-wup(ib))*qr%v(ib,3)
     end do
 
-  end subroutine riemann_JBB
-
-
-  subroutine riemann_HLLC(lo, hi, UL, UR, flx, dir)
-    use eos_module, only : smalld, smallp, eos_given_ReY, eos_given_RTY, allow_negative_energy
-    integer, intent(in) :: lo, hi
-    integer, intent(in) :: dir
-    double precision, intent(in ) ::  UL(lo:hi+1,NVAR)
-    double precision, intent(in ) ::  UR(lo:hi+1,NVAR)
-    double precision, intent(out) :: flx(lo:hi+1,NVAR)
-
-    integer :: i, n, ivel(3), idim
-    double precision :: vflag(3), dpdr(NSPEC), dpde
-    double precision :: rl, retl, Tl, Yl(NSPEC), vl(3), el, pl, rel, rinvl
-    double precision :: rr, retr, Tr, Yr(NSPEC), vr(3), er, pr, rer, rinvr
-    double precision :: cl, gamcl, Smul, Sl
-    double precision :: cr, gamcr, Smur, Sr
-    double precision :: Sstar, rstar, vstar(3), etstar
-
-    call set_vel(dir, ivel, vflag)
-
-    do i=lo,hi+1
-       
-       rl    = max(UL(i,URHO), smalld)
-       rinvl = 1.d0/rl
-       vl(1) = UL(i,ivel(1)) * vflag(1) * rinvl
-       vl(2) = UL(i,ivel(2)) * vflag(2) * rinvl
-       vl(3) = UL(i,ivel(3)) * vflag(3) * rinvl
-       Tl    = UL(i,UTEMP)
-       retl  = UL(i,UEDEN)
-       Yl    = UL(i,UFS:UFS+nspec-1) * rinvl
-       rel   = retl - 0.5d0*rl*(vl(1)**2+vl(2)**2+vl(3)**2)
-       el    = rel * rinvl       
-       if ((el .le. 0.d0) .and. (allow_negative_energy .eqv. .false.)) then
-          call eos_given_RTY(el, pl, cl, gamcl, dpdr, dpde, rl, Tl, Yl)
-       else
-          call eos_given_ReY(pl, cl, gamcl, Tl, dpdr, dpde, rl, el, Yl)
-       end if
-
-       rr    = max(UR(i,URHO), smalld)
-       rinvr = 1.d0/rr
-       vr(1) = UR(i,ivel(1)) * vflag(1) * rinvr
-       vr(2) = UR(i,ivel(2)) * vflag(2) * rinvr
-       vr(3) = UR(i,ivel(3)) * vflag(3) * rinvr
-       Tr    = UR(i,UTEMP)
-       retr  = UR(i,UEDEN)
-       Yr    = UR(i,UFS:UFS+nspec-1) * rinvr
-       rer   = retr - 0.5d0*rr*(vr(1)**2+vr(2)**2+vr(3)**2)
-       er    = rer * rinvr       
-       if ((er .le. 0.d0) .and. (allow_negative_energy .eqv. .false.)) then
-          call eos_given_RTY(er, pr, cr, gamcr, dpdr, dpde, rr, Tr, Yr)
-       else
-          call eos_given_ReY(pr, cr, gamcr, Tr, dpdr, dpde, rr, er, Yr)
-       end if
-
-       ! wave speed estimates
-       Sl = min(vl(1)-cl, vr(1)-cr)
-       Sr = max(vl(1)+cl, vr(1)+cr)
-       Smul = Sl - vl(1)
-       Smur = Sr - vr(1)
-       Sstar = (pr-pl+rl*vl(1)*Smul-rr*vr(1)*Smur)/(rl*Smul-rr*Smur)
-
-       ! HLLC flux
-       if (Sl .ge. 0.d0) then
-
-          flx(i,URHO) = rl*vl(1)
-
-          do idim=1,ndim
-             flx(i,ivel(idim)) = flx(i,URHO)*vl(idim)
-          end do
-          flx(i,ivel(1)) = flx(i,ivel(1)) + pl
-
-          flx(i,UEDEN) = vl(1)*(retl + pl)
-          flx(i,UTEMP) = 0.d0
-
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yl(n)
-          end do
-
-       else if (Sr .le. 0.d0) then
+    if (zlo) vgdnv( 1,1) = 0.d0
+    if (zhi) vgdnv(np,1) = 0.d0
 
-          flx(i,URHO) = rr*vr(1)
-
-          do idim=1,ndim
-             flx(i,ivel(idim)) = flx(i,URHO)*vr(idim)
-          end do
-          flx(i,ivel(1)) = flx(i,ivel(1)) + pr
-
-          flx(i,UEDEN) = vr(1)*(retr + pr)
-          flx(i,UTEMP) = 0.d0
-
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yr(n)
-          end do
-
-       else if (Sstar .ge. 0.d0) then
-
-          rstar = rl*Smul/(Sl-Sstar)
-          vstar(1) = Sstar
-          vstar(2) = vl(2)
-          vstar(3) = vl(3)
-          etstar = retl*rinvl+(Sstar-vl(1))*(Sstar+pl/(rl*Smul))
-
-          flx(i,URHO) = rl*vl(1) + Sl*(rstar-rl)
+    !DEC$ SIMD
+    do ib=1,np
+       i = i0+ib-1
+       flx(i,URHO) = rgdnv(ib)*vgdnv(ib,1)
+       ! tangential velocities are zero in the absent directions
+       ekgdnv = 0.5d0*(vgdnv(ib,1)**2 + vgdnv(ib,2)**2 + vgdnv(ib,3)**2)
+       flx(i,UEDEN) = vgdnv(ib,1)*(regdnv(ib) + rgdnv(ib)*ekgdnv + pgdnv(ib))
+       flx(i,UTEMP) = 0.d0
+    end do
 
-          do idim=1,ndim
-             flx(i,ivel(idim)) = rl*vl(1)*vl(idim) + Sl*(rstar*vstar(idim)-rl*vl(idim))
-          end do
-          flx(i,ivel(1)) = flx(i,ivel(1)) + pl
+    do idim=1,ndim
+       !DEC$ SIMD
+       do ib=1,np
+          i = i0+ib-1
+          flx(i,ivel(idim)) = flx(i,URHO)*vgdnv(ib,idim)
+       end do
+    end do
 
-          flx(i,UEDEN) = vl(1)*(retl + pl) + Sl*(rstar*etstar-retl)
-          flx(i,UTEMP) = 0.d0
+    !DEC$ SIMD
+    do ib=1,np
+       i = i0+ib-1
+       flx(i,ivel(1)) = flx(i,ivel(1)) + pgdnv(ib)
+    end do
 
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yl(n)
-          end do
+    do n=1,NSPEC
+       !DEC$ SIMD
+       do ib=1,np
+          i = i0+ib-1
+          flx(i,UFS+n-1) = flx(i,URHO) * (wup(ib)*UL(i,UFS+n-1)*ql%rinv(ib) &
+               &                   + (1.d0-wup(ib))*UR(i,UFS+n-1)*qr%rinv(ib))
+       end do
+    end do
 
-       else
+  end subroutine flux_JBB
 
-          rstar = rr*Smur/(Sr-Sstar)
-          vstar(1) = Sstar
-          vstar(2) = vr(2)
-          vstar(3) = vr(3)
-          etstar = retr*rinvr+(Sstar-vr(1))*(Sstar+pr/(rr*Smur))
 
-          flx(i,URHO) = rr*vr(1) + Sr*(rstar-rr)
+  subroutine flux_HLLC(np, i0, UL, UR, Ulo, Uhi, ql, qr, ivel, flx, flo, fhi)
+    integer, intent(in) :: np, i0, Ulo, Uhi, ivel(3), flo, fhi
+    double precision, intent(in) :: UL(Ulo:Uhi,NVAR), UR(Ulo:Uhi,NVAR)
+    type(face_state), intent(in) :: ql, qr
+    double precision, intent(inout) :: flx(flo:fhi,NVAR)
 
-          do idim=1,ndim
-             flx(i,ivel(idim)) = rr*vr(1)*vr(idim) + Sr*(rstar*vstar(idim)-rr*vr(idim))
-          end do
-          flx(i,ivel(1)) = flx(i,ivel(1)) + pr
+    integer :: i, ib, n, idim
+    logical :: left, star
+    double precision :: fm(nb,3), wup(nb)
+    double precision :: Sl, Sr, Smul, Smur, Sstar, SK, SmuK, ws
+    double precision :: rK, rinvK, vK(3), retK, pK
+    double precision :: rstar, vstar(3), etstar, rvK
 
-          flx(i,UEDEN) = vr(1)*(retr + pr) + Sr*(rstar*etstar-retr)
-          flx(i,UTEMP) = 0.d0
+    !DEC$ SIMD
+    do ib=1,np
+       i = i0+ib-1
 
-          do n=1,NSPEC
-             flx(i,UFS+n-1) = flx(i,URHO) * Yr(n)
-          end do
+       ! wave speed estimates
+       Sl = min(ql%v(ib,1)-ql%c(ib), qr%v(ib,1)-qr%c(ib))
+       Sr = max(ql%v(ib,1)+ql%c(ib), qr%v(ib,1)+qr%c(ib))
+       Smul = Sl - ql%v(ib,1)
+       Smur = Sr - qr%v(ib,1)
+       Sstar = (qr%p(ib)-ql%p(ib)+ql%r(ib)*ql%v(ib,1)*Smul-qr%r(ib)*qr%v(ib,1)*Smur) &
+            / (ql%r(ib)*Smul-qr%r(ib)*Smur)
+
+       ! The flux is F_K + ws*S_K*(U*_K - U_K) for the upwind side K; ws = 0
+       ! outside the star region.
+       star = .not.(Sl .ge. 0.d0) .and. .not.(Sr .le. 0.d0)
+       left = (Sl .ge. 0.d0) .or. (star .and. Sstar .ge. 0.d0)
+       ws   = merge(1.d0, 0.d0, star)
+
+       wup(ib) = merge(1.d0, 0.d0, left)
+       rK    = merge(ql%r   (ib),   qr%r   (ib),   left)
+       rinvK = merge(ql%rinv(ib),   qr%rinv(ib),   left)
+       vK(1) = merge(ql%v   (ib,1), qr%v   (ib,1), left)
+       vK(2) = merge(ql%v   (ib,2), qr%v   (ib,2), left)
+       vK(3) = merge(ql%v   (ib,3), qr%v   (ib,3), left)
+       pK    = merge(ql%p   (ib),   qr%p   (ib),   left)
+       retK  = merge(UL(i,UEDEN),   UR(i,UEDEN),   left)
+       SK    = merge(Sl,   Sr,   left)
+       SmuK  = merge(Smul, Smur, left)
+
+       ! keep the unused star state finite
+       SmuK  = merge(SmuK, 1.d0, star)
+       rstar = rK*SmuK/merge(SK-Sstar, 1.d0, star)
+       vstar(1) = Sstar
+       vstar(2) = vK(2)
+       vstar(3) = vK(3)
+       etstar = retK*rinvK+(Sstar-vK(1))*(Sstar+pK/(rK*SmuK))
+
+       rvK = rK*vK(1)
+       flx(i,URHO) = rvK + ws*SK*(rstar-rK)
+       fm(ib,1) = rvK*vK(1) + ws*SK*(rstar*vstar(1)-rK*vK(1)) + pK
+       fm(ib,2) = rvK*vK(2) + ws*SK*(rstar*vstar(2)-rK*vK(2))
+       fm(ib,3) = rvK*vK(3) + ws*SK*(rstar*vstar(3)-rK*vK(3))
+       flx(i,UEDEN) = vK(1)*(retK + pK) + ws*SK*(rstar*etstar-retK)
+       flx(i,UTEMP) = 0.d0
+    end do
 
-       end if
+    do idim=1,ndim
+       !DEC$ SIMD
+       do ib=1,np
+          flx(i0+ib-1,ivel(idim)) = fm(ib,idim)
+       end do
+    end do
 
+    do n=1,NSPEC
+       !DEC$ SIMD
+       do ib=1,np
+          i = i0+ib-1
+          flx(i,UFS+n-1) = flx(i,URHO) * (wup(ib)*UL(i,UFS+n-1)*ql%rinv(ib) &
+               &                   + (1.d0-wup(ib))*UR(i,UFS+n-1)*qr%rinv(ib))
+       end do
     end do
 
-  end subroutine riemann_HLLC
+  end subroutine flux_HLLC
 
 
   subroutine set_vel(dir, ivel, vflag)
@@ -498,7 +395,7 @@ contains
     else if (ndim .eq. 2) then
        vflag(1) = 1.d0
        vflag(2) = 1.d0
-       vflag(3) = 0.d0   
+       vflag(3) = 0.d0
        if (dir .eq. 1) then
           ivel(1) = UMX
           ivel(2) = UMY
@@ -511,7 +408,7 @@ contains
     else
        vflag(1) = 1.d0
        vflag(2) = 1.d0
-       vflag(3) = 1.d0 
+       vflag(3) = 1.d0
        if (dir .eq. 1) then
           ivel(1) = UMX
           ivel(2) = UMY
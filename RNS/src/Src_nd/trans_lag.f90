@@ -0,0 +1,212 @@
+module trans_lag_module
+
+  ! Lagged transport properties.  The coefficients computed on a region
+  ! (level, lo, hi) are kept together with the T and X they were computed
+  ! from.  A later evaluation on the same region reuses them as long as
+  ! neither T (relative change) nor X (absolute change) has moved by more
+  ! than trans_lag_tol since, and fewer than trans_lag_max evaluations in a
+  ! row have been skipped.  Regions are the blocks handed to
+  ! get_transport_properties, which are disjoint on a level, so each entry
+  ! is only ever touched by one thread at a time.
+
+  use meth_params_module, only : NSPEC, QTEMP, QFX, trans_lag_tol, trans_lag_max
+
+  implicit none
+
+  integer, parameter :: max_lev = 32
+
+  type trans_lag_t
+     integer :: level, lo(3), hi(3)
+     integer :: nskip = -1   ! < 0 : nothing saved yet
+     double precision, allocatable :: T(:,:,:), X(:,:,:,:)
+     double precision, allocatable :: mu(:,:,:), xi(:,:,:), lam(:,:,:), Ddiag(:,:,:,:)
+  end type trans_lag_t
+
+  type trans_lag_ptr
+     type(trans_lag_t), pointer :: p => null()
+  end type trans_lag_ptr
+
+  type(trans_lag_ptr), allocatable, save :: cache(:)
+  integer, save :: ncache = 0
+
+  ! evaluations done and skipped on each level since trans_lag_counts
+  integer(8), save :: nrefresh(0:max_lev-1) = 0
+  integer(8), save :: nreuse  (0:max_lev-1) = 0
+
+  private
+
+  public :: trans_lag_t, trans_lag_find, trans_lag_reuse, trans_lag_save, &
+       trans_lag_reset, trans_lag_counts
+
+contains
+
+  ! Entry for the region, created empty if there is none.
+  function trans_lag_find(level, lo, hi) result(e)
+    integer, intent(in) :: level, lo(3), hi(3)
+    type(trans_lag_t), pointer :: e
+
+    integer :: i
+    type(trans_lag_ptr), allocatable :: tmp(:)
+
+    nullify(e)
+
+    !$omp critical (trans_lag_cache)
+
+    do i=1,ncache
+       if (cache(i)%p%level .eq. level .and. &
+            all(cache(i)%p%lo .eq. lo) .and. all(cache(i)%p%hi .eq. hi)) then
+          e => cache(i)%p
+          exit
+       end if
+    end do
+
+    if (.not.associated(e)) then
+       if (.not.allocated(cache)) then
+          allocate(cache(64))
+       else if (ncache .eq. size(cache)) then
+          allocate(tmp(2*ncache))
+          tmp(1:ncache) = cache(1:ncache)
+          call move_alloc(tmp, cache)
+       end if
+
+       allocate(e)
+       e%level = level
+       e%lo = lo
+       e%hi = hi
+       allocate(e%T    (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)))
+       allocate(e%X    (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),NSPEC))
+       allocate(e%mu   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)))
+       allocate(e%xi   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)))
+       allocate(e%lam  (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)))
+       allocate(e%Ddiag(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),NSPEC))
+
+       ncache = ncache + 1
+       cache(ncache)%p => e
+    end if
+
+    !$omp end critical (trans_lag_cache)
+
+  end function trans_lag_find
+
+
+  ! If the saved coefficients are still good for Q, copy them out and
+  ! return .true.
+  function trans_lag_reuse(e, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi) result(r)
+    type(trans_lag_t), intent(inout) :: e
+    integer, intent(in) :: qlo(3), qhi(3), clo(3), chi(3), QVAR
+    double precision, intent(in) ::     Q(qlo(1):qhi(1),qlo(2):qhi(2),qlo(3):qhi(3),QVAR)
+    double precision             ::    mu(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision             ::    xi(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision             ::   lam(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision             :: Ddiag(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3),NSPEC)
+    logical :: r
+
+    integer :: i, j, k, n, lo(3), hi(3)
+    double precision :: dmax
+
+    r = .false.
+
+    if (e%nskip .lt. 0) return
+    if (trans_lag_max .gt. 0 .and. e%nskip .ge. trans_lag_max) return
+
+    lo = e%lo
+    hi = e%hi
+
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+          dmax = 0.d0
+          do i=lo(1),hi(1)
+             dmax = max(dmax, abs(Q(i,j,k,QTEMP)-e%T(i,j,k))/e%T(i,j,k))
+          end do
+          do n=1,NSPEC
+             do i=lo(1),hi(1)
+                dmax = max(dmax, abs(Q(i,j,k,QFX+n-1)-e%X(i,j,k,n)))
+             end do
+          end do
+          if (dmax .gt. trans_lag_tol) return
+       end do
+    end do
+
+    mu   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)) = e%mu
+    xi   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)) = e%xi
+    lam  (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)) = e%lam
+    Ddiag(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),:) = e%Ddiag
+
+    e%nskip = e%nskip + 1
+
+    !$omp atomic
+    nreuse(min(e%level,max_lev-1)) = nreuse(min(e%level,max_lev-1)) + 1_8
+
+    r = .true.
+
+  end function trans_lag_reuse
+
+
+  ! Keep freshly computed coefficients and the state they came from.
+  subroutine trans_lag_save(e, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)
+    type(trans_lag_t), intent(inout) :: e
+    integer, intent(in) :: qlo(3), qhi(3), clo(3), chi(3), QVAR
+    double precision, intent(in) ::     Q(qlo(1):qhi(1),qlo(2):qhi(2),qlo(3):qhi(3),QVAR)
+    double precision, intent(in) ::    mu(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision, intent(in) ::    xi(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision, intent(in) ::   lam(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
+    double precision, intent(in) :: Ddiag(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3),NSPEC)
+
+    integer :: lo(3), hi(3)
+
+    lo = e%lo
+    hi = e%hi
+
+    e%T     = Q    (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),QTEMP)
+    e%X     = Q    (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),QFX:QFX+NSPEC-1)
+    e%mu    = mu   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3))
+    e%xi    = xi   (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3))
+    e%lam   = lam  (lo(1):hi(1),lo(2):hi(2),lo(3):hi(3))
+    e%Ddiag = Ddiag(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),:)
+
+    e%nskip = 0
+
+    !$omp atomic
+    nrefresh(min(e%level,max_lev-1)) = nrefresh(min(e%level,max_lev-1)) + 1_8
+
+  end subroutine trans_lag_save
+
+
+  ! Drop the entries of a level (all levels if level < 0), e.g. after the
+  ! level's grids have changed.
+  subroutine trans_lag_reset(level)
+    integer, intent(in) :: level
+    integer :: i, n
+
+    !$omp critical (trans_lag_cache)
+    n = 0
+    do i=1,ncache
+       if (level .lt. 0 .or. cache(i)%p%level .eq. level) then
+          deallocate(cache(i)%p)
+       else
+          n = n + 1
+          cache(n)%p => cache(i)%p
+       end if
+    end do
+    do i=n+1,ncache
+       nullify(cache(i)%p)
+    end do
+    ncache = n
+    !$omp end critical (trans_lag_cache)
+
+  end subroutine trans_lag_reset
+
+
+  ! Evaluations done and skipped on the level since the last call.
+  subroutine trans_lag_counts(level, nref, nskip)
+    integer, intent(in) :: level
+    integer(8), intent(out) :: nref, nskip
+    integer :: l
+    l = min(level,max_lev-1)
+    nref  = nrefresh(l)
+    nskip = nreuse  (l)
+    nrefresh(l) = 0
+    nreuse  (l) = 0
+  end subroutine trans_lag_counts
+
+end module trans_lag_module
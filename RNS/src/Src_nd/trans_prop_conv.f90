@@ -4,16 +4,18 @@ module transport_properties
 
   use meth_params_module
   use egz_module
+  use trans_lag_module
 
   implicit none
 
   private
 
-  public :: get_transport_properties
+  public :: get_transport_properties, get_mc_diff_flux
 
 contains
 
   subroutine get_transport_properties(lo, hi, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)
+    use passinfo_module, only : level
     integer, intent(in) :: lo(3), hi(3), qlo(3), qhi(3), clo(3), chi(3), QVAR
     double precision, intent(in) ::     Q(qlo(1):qhi(1),qlo(2):qhi(2),qlo(3):qhi(3),QVAR)
     double precision             ::    mu(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
@@ -25,6 +27,13 @@ contains
     double precision :: rwrk, Cpt(nspec)
     double precision, allocatable :: L1Z(:), L2Z(:), DZ(:,:), XZ(:,:), CPZ(:,:), &
          E1Z(:), E2Z(:)
+    type(trans_lag_t), pointer :: lag
+
+    nullify(lag)
+    if (trans_lag_tol .gt. 0.d0) then
+       lag => trans_lag_find(level, lo, hi)
+       if (trans_lag_reuse(lag, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)) return
+    end if
 
     np = hi(1)-lo(1)+1
 
@@ -82,6 +91,24 @@ contains
 
     deallocate(L1Z, L2Z, DZ, XZ, CPZ, E1Z, E2Z)
 
+    if (associated(lag)) then
+       call trans_lag_save(lag, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)
+    end if
+
   end subroutine get_transport_properties
 
+
+  ! Multicomponent species diffusion fluxes at a row of n faces, as in
+  ! transport_properties.f90.
+  subroutine get_mc_diff_flux(n, T, X, dk, F)
+    integer, intent(in) :: n
+    double precision, intent(in) :: T(n), X(n,NSPEC), dk(n,NSPEC)
+    double precision, intent(inout) :: F(n,NSPEC)
+
+    call egzini(n)
+    call egzpar(T, X)
+    call egzsm(T, dk, F, mc_diff_iters)
+
+  end subroutine get_mc_diff_flux
+
 end module transport_properties
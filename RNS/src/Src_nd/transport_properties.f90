@@ -2,16 +2,18 @@ module transport_properties
 
   use meth_params_module
   use egz_module
+  use trans_lag_module
 
   implicit none
 
   private
 
-  public :: get_transport_properties
+  public :: get_transport_properties, get_mc_diff_flux
 
 contains
 
   subroutine get_transport_properties(lo, hi, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)
+    use passinfo_module, only : level
     integer, intent(in) :: lo(3), hi(3), qlo(3), qhi(3), clo(3), chi(3), QVAR
     double precision, intent(in) ::     Q(qlo(1):qhi(1),qlo(2):qhi(2),qlo(3):qhi(3),QVAR)
     double precision             ::    mu(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
@@ -19,61 +21,109 @@ contains
     double precision             ::   lam(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3))
     double precision             :: Ddiag(clo(1):chi(1),clo(2):chi(2),clo(3):chi(3),NSPEC)
 
-    integer :: iwrk, i, j, k, n, np
+    integer :: iwrk, i, j, k, n, p, m, nb, nx, ny, npts, b0
     double precision :: rwrk, Cpt(nspec)
-    double precision, allocatable :: L1Z(:), L2Z(:), DZ(:,:), XZ(:,:), CPZ(:,:)
+    double precision, allocatable :: TZ(:), MUZ(:), XIZ(:), L1Z(:), L2Z(:), &
+         DZ(:,:), XZ(:,:), CPZ(:,:)
+    integer, allocatable :: idx(:,:)
+    type(trans_lag_t), pointer :: lag
+
+    nullify(lag)
+    if (trans_lag_tol .gt. 0.d0) then
+       lag => trans_lag_find(level, lo, hi)
+       if (trans_lag_reuse(lag, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)) return
+    end if
+
+    ! The tile is done in batches of nb cells in i-j-k order; a short last
+    ! batch is padded with copies of its last cell.
+
+    nx = hi(1)-lo(1)+1
+    ny = hi(2)-lo(2)+1
+    npts = nx*ny*(hi(3)-lo(3)+1)
+    nb = min(egz_nbatch, npts)
+
+    allocate(TZ(nb), MUZ(nb), XIZ(nb), L1Z(nb), L2Z(nb))
+    allocate(DZ(nb,nspec), XZ(nb,nspec), CPZ(nb,nspec))
+    allocate(idx(3,nb))
+
+    call egzini(nb)
+
+    do b0 = 0, npts-1, nb
+
+       do p = 1, nb
+          m = min(b0+p-1, npts-1)
+          i = lo(1) + mod(m, nx)
+          j = lo(2) + mod(m/nx, ny)
+          k = lo(3) + m/(nx*ny)
+          idx(:,p) = (/ i, j, k /)
+          TZ(p) = Q(i,j,k,QTEMP)
+       end do
+
+       do n=1,nspec
+          do p = 1, nb
+             XZ(p,n) = Q(idx(1,p),idx(2,p),idx(3,p),QFX+n-1)
+          end do
+       end do
 
-    np = hi(1)-lo(1)+1
+       if (iflag > 3) then
+          do p = 1, nb
+             call ckcpms(TZ(p), iwrk, rwrk, Cpt)
+             CPZ(p,:) = Cpt
+          end do
+       else
+          CPZ = 0.d0
+       end if
 
-    allocate(L1Z(lo(1):hi(1)))
-    allocate(L2Z(lo(1):hi(1)))
-    
-    allocate(DZ (lo(1):hi(1),nspec))
-    allocate(XZ (lo(1):hi(1),nspec))
-    allocate(CPZ(lo(1):hi(1),nspec))
+       call egzpar(TZ, XZ, CPZ)
 
-    call egzini(np)
+       call egze3(TZ, MUZ)
 
-    do    k = lo(3),hi(3)
-       do j = lo(2),hi(2)
+       call egzk3(TZ, XIZ)
 
-          do n=1,nspec
-             do i=lo(1),hi(1)
-                XZ(i,n) = Q(i,j,k,QFX+n-1)
-             end do
-          end do
-          
-          if (iflag > 3) then
-             do i=lo(1),hi(1)
-                call ckcpms(Q(i,j,k,QTEMP), iwrk, rwrk, Cpt)
-                CPZ(i,:) = Cpt
-             end do
-          else
-             CPZ = 0.d0
-          end if
-
-          call egzpar(Q(lo(1):hi(1),j,k,QTEMP), XZ, CPZ)
-          
-          call egze3(Q(lo(1):hi(1),j,k,QTEMP), mu(lo(1):hi(1),j,k))
-
-          call egzk3(Q(lo(1):hi(1),j,k,QTEMP), xi(lo(1):hi(1),j,k))
-
-          call egzl1( 1.d0, XZ, L1Z)
-          call egzl1(-1.d0, XZ, L2Z)
-          lam(lo(1):hi(1),j,k) = 0.5d0*(L1Z+L2Z)
-
-          call EGZVR1(Q(lo(1):hi(1),j,k,QTEMP), DZ)
-          do n=1,nspec
-             do i=lo(1),hi(1)
-                Ddiag(i,j,k,n) = DZ(i,n)
-             end do
-          end do
+       call egzl1( 1.d0, XZ, L1Z)
+       call egzl1(-1.d0, XZ, L2Z)
+
+       call EGZVR1(TZ, DZ)
 
+       do p = 1, min(nb, npts-b0)
+          i = idx(1,p)
+          j = idx(2,p)
+          k = idx(3,p)
+          mu (i,j,k) = MUZ(p)
+          xi (i,j,k) = XIZ(p)
+          lam(i,j,k) = 0.5d0*(L1Z(p)+L2Z(p))
        end do
+       do n=1,nspec
+          do p = 1, min(nb, npts-b0)
+             Ddiag(idx(1,p),idx(2,p),idx(3,p),n) = DZ(p,n)
+          end do
+       end do
+
     end do
 
-    deallocate(L1Z, L2Z, DZ, XZ, CPZ)
+    deallocate(TZ, MUZ, XIZ, L1Z, L2Z, DZ, XZ, CPZ, idx)
+
+    if (associated(lag)) then
+       call trans_lag_save(lag, Q, qlo, qhi, QVAR, mu, xi, lam, Ddiag, clo, chi)
+    end if
 
   end subroutine get_transport_properties
 
+
+  ! Multicomponent species diffusion fluxes at a row of n faces with
+  ! temperatures T and mole fractions X.  dk are the diffusion driving
+  ! forces grad X + (X - Y) grad(ln p), and F holds the mixture-averaged
+  ! fluxes -Ddiag*dk on entry; mc_diff_iters Stefan-Maxwell sweeps
+  ! (EGZSM) are done from there.
+  subroutine get_mc_diff_flux(n, T, X, dk, F)
+    integer, intent(in) :: n
+    double precision, intent(in) :: T(n), X(n,NSPEC), dk(n,NSPEC)
+    double precision, intent(inout) :: F(n,NSPEC)
+
+    call egzini(n)
+    call egzpar(T, X)
+    call egzsm(T, dk, F, mc_diff_iters)
+
+  end subroutine get_mc_diff_flux
+
 end module transport_properties
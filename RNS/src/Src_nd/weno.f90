@@ -84,6 +84,7 @@ module weno_module
   private
 
   public :: init_weno, weno4_gauss, weno5_gauss, weno5_face, vweno5, weno5_center,  &
+       vweno4_gauss, vweno5_face, &
        cellavg2gausspt_1d, cellavg2gausspt_2d, cellavg2gausspt_2d_v1, &
        cellavg2gausspt_2d_v2, cellavg2gausspt_3d, &
        cellavg2dergausspt_1d, cellavg2dergausspt_2d, cellavg2face_1d
@@ -150,6 +151,51 @@ contains
   end subroutine weno4_gauss
 
 
+  ! weno4_gauss for np independent stencils; v(i,:) is the stencil of point i.
+  subroutine vweno4_gauss(np, ld, v, vg1, vg2)
+    integer, intent(in) :: np, ld
+    double precision, intent(in)  :: v(ld,-2:2)
+    double precision, intent(out) :: vg1(ld), vg2(ld)  ! at two Gauss points
+
+    integer :: i
+    double precision :: vr_2, vr_1, vr_0
+    double precision :: beta_2, beta_1, beta_0
+    double precision :: alpha_2, alpha_1, alpha_0
+
+    !DEC$ SIMD
+    do i=1,np
+       beta_2 = b1*(v(i,-2)-2.d0*v(i,-1)+v(i,0))**2 + 0.25d0*(v(i,-2)-4.d0*v(i,-1)+3.d0*v(i,0))**2
+       beta_1 = b1*(v(i,-1)-2.d0*v(i, 0)+v(i,1))**2 + 0.25d0*(v(i,-1)-v(i,1))**2
+       beta_0 = b1*(v(i, 0)-2.d0*v(i, 1)+v(i,2))**2 + 0.25d0*(3.d0*v(i,0)-4.d0*v(i,1)+v(i,2))**2
+
+       beta_2 = 1.d0/(eps+beta_2)**wenop
+       beta_1 = 1.d0/(eps+beta_1)**wenop
+       beta_0 = 1.d0/(eps+beta_0)**wenop
+
+       alpha_2 = weno4_d_g1(-2)*beta_2
+       alpha_1 = weno4_d_g1(-1)*beta_1
+       alpha_0 = weno4_d_g1( 0)*beta_0
+
+       vr_2 = L3_cg1(-2)*v(i,-2) + L3_cg1(-1)*v(i,-1) + L3_cg1(0)*v(i,0)
+       vr_1 = C3_cg1(-1)*v(i,-1) + C3_cg1( 0)*v(i, 0) + C3_cg1(1)*v(i,1)
+       vr_0 = R3_cg1( 0)*v(i, 0) + R3_cg1( 1)*v(i, 1) + R3_cg1(2)*v(i,2)
+
+       vg1(i) = (alpha_2*vr_2 + alpha_1*vr_1 + alpha_0*vr_0) / (alpha_2 + alpha_1 + alpha_0)
+
+       alpha_2 = weno4_d_g2(-2)*beta_2
+       alpha_1 = weno4_d_g2(-1)*beta_1
+       alpha_0 = weno4_d_g2( 0)*beta_0
+
+       vr_2 = L3_cg2(-2)*v(i,-2) + L3_cg2(-1)*v(i,-1) + L3_cg2(0)*v(i,0)
+       vr_1 = C3_cg2(-1)*v(i,-1) + C3_cg2( 0)*v(i, 0) + C3_cg2(1)*v(i,1)
+       vr_0 = R3_cg2( 0)*v(i, 0) + R3_cg2( 1)*v(i, 1) + R3_cg2(2)*v(i,2)
+
+       vg2(i) = (alpha_2*vr_2 + alpha_1*vr_1 + alpha_0*vr_0) / (alpha_2 + alpha_1 + alpha_0)
+    end do
+
+  end subroutine vweno4_gauss
+
+
   subroutine weno5_gauss(v, vg1, vg2)
     double precision, intent(in)  :: v(-2:2)
     double precision, intent(out) :: vg1, vg2  ! at two Gauss points
@@ -246,6 +292,49 @@ contains
   end subroutine weno5_face
 
 
+  ! weno5_face for np independent stencils; v(i,:) is the stencil of point i.
+  subroutine vweno5_face(np, ld, v, vl, vr)
+    integer, intent(in) :: np, ld
+    double precision, intent(in)  :: v(ld,-2:3)
+    double precision, intent(out) :: vl(ld), vr(ld)  ! left and right at i+1/2
+
+    integer :: i
+    double precision :: vr_2, vl_2, vl_1, vl_0
+    double precision :: beta_2, beta_1, beta_0
+    double precision :: alpha_2, alpha_1, alpha_0
+
+    !DEC$ SIMD
+    do i=1,np
+       beta_2 = b1*(v(i,-2)-2.d0*v(i,-1)+v(i,0))**2 + 0.25d0*(v(i,-2)-4.d0*v(i,-1)+3.d0*v(i,0))**2
+       beta_1 = b1*(v(i,-1)-2.d0*v(i, 0)+v(i,1))**2 + 0.25d0*(v(i,-1)-v(i,1))**2
+       beta_0 = b1*(v(i, 0)-2.d0*v(i, 1)+v(i,2))**2 + 0.25d0*(3.d0*v(i,0)-4.d0*v(i,1)+v(i,2))**2
+
+       alpha_2 =      1.d0/(eps+beta_2)**wenop
+       alpha_1 = 6.d0/(eps+beta_1)**wenop
+       alpha_0 = 3.d0/(eps+beta_0)**wenop
+
+       vl_2 = 2.d0*v(i,-2) - 7.d0*v(i,-1) + 11.d0*v(i,0)
+       vl_1 =     -v(i,-1) + 5.d0*v(i, 0) +  2.d0*v(i,1)
+       vl_0 = 2.d0*v(i, 0) + 5.d0*v(i, 1) -       v(i,2)
+
+       vl(i) = oneSixth*(alpha_2*vl_2 + alpha_1*vl_1 + alpha_0*vl_0) / (alpha_2 + alpha_1 + alpha_0)
+
+       beta_2 = b1*(v(i,3)-2.d0*v(i,2)+v(i, 1))**2 + 0.25d0*(v(i,3)-4.d0*v(i,2)+3.d0*v(i,1))**2
+       beta_1 = b1*(v(i,2)-2.d0*v(i,1)+v(i, 0))**2 + 0.25d0*(v(i,2)-v(i,0))**2
+       beta_0 = b1*(v(i,1)-2.d0*v(i,0)+v(i,-1))**2 + 0.25d0*(3.d0*v(i,1)-4.d0*v(i,0)+v(i,-1))**2
+
+       alpha_2 =      1.d0/(eps+beta_2)**wenop
+       alpha_1 = 6.d0/(eps+beta_1)**wenop
+       alpha_0 = 3.d0/(eps+beta_0)**wenop
+
+       vr_2 = 11.d0*v(i,1) - 7.d0*v(i,2) + 2.d0*v(i,3)
+
+       vr(i) = oneSixth*(alpha_2*vr_2 + alpha_1*vl_0 + alpha_0*vl_1) / (alpha_2 + alpha_1 + alpha_0)
+    end do
+
+  end subroutine vweno5_face
+
+
   subroutine vweno5(lo, hi, v, vlo, vhi, glo, ghi, vp, vm, vg1, vg2)
     integer, intent(in) :: lo, hi, vlo, vhi, glo, ghi
     double precision, intent(in)  :: v(vlo:vhi)
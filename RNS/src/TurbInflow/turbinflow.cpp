@@ -1,65 +1,107 @@
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <REAL.H>
 #include <Utility.H>
 #include <FArrayBox.H>
+#include <FabConv.H>
 #include <ParallelDescriptor.H>
-#include <PArray.H>
 
-#ifdef _OPENM
+#ifdef _OPENMP
 #include <omp.h>
 #endif
 
 #  if defined(BL_FORT_USE_UPPERCASE)
-#    define FORT_GETPLANE    GETPLANE
+#    define FORT_GETPLANE       GETPLANE
+#    define FORT_GETPLANEPTR    GETPLANEPTR
 #  elif defined(BL_FORT_USE_LOWERCASE)
-#    define FORT_GETPLANE    getplane
+#    define FORT_GETPLANE       getplane
+#    define FORT_GETPLANEPTR    getplaneptr
 #  elif defined(BL_FORT_USE_UNDERSCORE)
-#    define FORT_GETPLANE    getplane_
+#    define FORT_GETPLANE       getplane_
+#    define FORT_GETPLANEPTR    getplaneptr_
 #  endif
 
 extern "C" void FORT_GETPLANE(int* filename, int* len, Real* data, int* plane, int* ncomp, int* isswirltype);
 
-void
-FORT_GETPLANE (int* filename, int* len, Real* data, int* plane, int* ncomp, int* isswirltype)
+extern "C" void FORT_GETPLANEPTR(int* filename, int* len, const Real** data, int* plane, int* ncomp,
+                                 int* isswirltype, int* nprefetch);
+
+namespace
 {
-#ifdef _OPENMP
-    int nthreads = omp_get_max_threads();
-    int tid = omp_get_thread_num();
-#else
-    int nthreads = 1;
-    int tid = 0;
-#endif
+    //
+    // Read-only view of the inflow DAT file.  The file is mapped once and
+    // each plane is resolved lazily to a pointer into the mapping.  If the
+    // file was not written in the native real format a converted copy of
+    // the plane is kept instead, so callers always get a plane of native Reals.
+    //
+    class TurbInflowFile
+    {
+    public:
 
-    static int         kmax;
-    static bool        first = true;
-    static PArray< Array<long> > offset(nthreads, PArrayManage);
-    std::string        flctfile;
+        TurbInflowFile (const std::string& flctfile, int isswirltype);
 
-#ifdef _OPENMP
-#pragma omp threadprivate (kmax, first)
-#endif
+        ~TurbInflowFile ();
 
+        int numPlanes () const { return kmax; }
+        //
+        // Pointer to plane k of component n (both 0-based).
+        //
+        const Real* plane (int k, int n);
+        //
+        // Number of Reals in plane k of component n.
+        //
+        long planeSize (int k, int n) { plane(k,n); return planes[k+n*kmax].npts; }
+        //
+        // Ask the kernel to start reading the next np planes of component n
+        // after plane k (wrapping around periodically).  Does not block.
+        //
+        void prefetch (int k, int n, int np);
 
-    for (int i = 0; i < *len; i++)
-    {
-        char c = filename[i];
+    private:
 
-        flctfile += c;
-    }
+        struct Plane
+        {
+            Plane () : data(0), npts(0), extent(0) {}
+            const Real*  data;
+            long         npts;
+            long         extent;    // Bytes of header plus data on disk.
+            Array<Real>  converted;
+        };
 
-    if (first)
+        void resolve (int i);
+
+        int          kmax;
+        Array<long>  offset;
+        Array<Plane> planes;
+        char*        base;
+        size_t       length;
+
+        TurbInflowFile (const TurbInflowFile&);
+        TurbInflowFile& operator= (const TurbInflowFile&);
+    };
+
+    TurbInflowFile::TurbInflowFile (const std::string& flctfile, int isswirltype)
+        :
+        kmax(0),
+        base(0),
+        length(0)
     {
         //
         // Read and save all the seekp() offsets in the inflow header file.
         //
-        first = false;
-
         std::string hdr = flctfile; hdr += "/HDR";
 
         std::ifstream ifs;
@@ -80,7 +122,7 @@ FORT_GETPLANE (int* filename, int* len, Real* data, int* plane, int* ncomp, int*
         ifs >> rdummy >> rdummy >> rdummy;
         ifs >> idummy >> idummy >> idummy;
 
-        if (*isswirltype)
+        if (isswirltype)
         {
             //
             // Skip over fluct_times array.
@@ -89,37 +131,211 @@ FORT_GETPLANE (int* filename, int* len, Real* data, int* plane, int* ncomp, int*
                 ifs >> rdummy;
         }
 
-	offset.set(tid, new Array<long>(kmax*BL_SPACEDIM, 0));
+        offset.resize(kmax*BL_SPACEDIM, 0);
+
+        for (int i = 0; i < offset.size(); i++)
+            ifs >> offset[i];
+
+        planes.resize(offset.size());
+
+        std::string dat = flctfile; dat += "/DAT";
+
+        const int fd = ::open(dat.c_str(), O_RDONLY);
+
+        if (fd < 0)
+            BoxLib::FileOpenFailed(dat);
+
+        struct stat sb;
+
+        if (::fstat(fd, &sb) != 0)
+            BoxLib::Abort("TurbInflowFile: fstat() failed");
+
+        length = sb.st_size;
+        //
+        // The extent of a plane runs up to the next plane in the file.
+        //
+        std::vector<long> sorted(offset.begin(), offset.end());
+
+        std::sort(sorted.begin(), sorted.end());
+
+        for (int i = 0; i < offset.size(); i++)
+        {
+            std::vector<long>::const_iterator it = std::upper_bound(sorted.begin(), sorted.end(), offset[i]);
+
+            planes[i].extent = ((it == sorted.end()) ? long(length) : *it) - offset[i];
+        }
+
+        void* p = ::mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+        //
+        // The mapping stays valid after the descriptor is closed.
+        //
+        ::close(fd);
+
+        if (p == MAP_FAILED)
+            BoxLib::Abort("TurbInflowFile: mmap() failed");
+
+        base = static_cast<char*>(p);
+        //
+        // Planes are consumed in time order, not streamed front to back.
+        //
+        ::madvise(base, length, MADV_RANDOM);
+    }
+
+    TurbInflowFile::~TurbInflowFile ()
+    {
+        if (base)
+            ::munmap(base, length);
+    }
+
+    void
+    TurbInflowFile::resolve (int i)
+    {
+        Plane& pl = planes[i];
+
+        const long start = offset[i];
+
+        if (start < 0 || size_t(start) >= length)
+            BoxLib::Abort("TurbInflowFile: plane offset outside of DAT");
+        //
+        // The FAB header is a single line of text: "FAB <RealDescriptor><Box> <ncomp>\n".
+        //
+        const char* hbeg = base + start;
+        const char* hend = static_cast<const char*>(memchr(hbeg, '\n', length - start));
+
+        if (hend == 0)
+            BoxLib::Abort("TurbInflowFile: bad FAB header");
+
+        std::istringstream is(std::string(hbeg, hend));
+
+        char c1 = 0, c2 = 0, c3 = 0;
+
+        is >> c1 >> c2 >> c3;
+
+        if (c1 != 'F' || c2 != 'A' || c3 != 'B')
+            BoxLib::Abort("TurbInflowFile: bad FAB header");
+
+        RealDescriptor rd;
+        Box            bx;
+        int            nvar;
+
+        is >> rd;
+        is >> bx;
+        is >> nvar;
+
+        if (is.fail())
+            BoxLib::Abort("TurbInflowFile: bad FAB header");
+
+        const long  npts  = bx.numPts() * nvar;
+        const char* fdata = hend + 1;
+
+        if (size_t(fdata - base) + size_t(npts * rd.numBytes()) > length)
+            BoxLib::Abort("TurbInflowFile: truncated DAT file");
+
+        pl.npts = npts;
+
+        if (rd == FPC::NativeRealDescriptor() && (fdata - base) % sizeof(Real) == 0)
+        {
+            pl.data = reinterpret_cast<const Real*>(fdata);
+        }
+        else
+        {
+            pl.converted.resize(npts);
+            RealDescriptor::convertToNativeFormat(pl.converted.dataPtr(), npts,
+                                                  const_cast<char*>(fdata), rd);
+            pl.data = pl.converted.dataPtr();
+        }
+    }
+
+    const Real*
+    TurbInflowFile::plane (int k, int n)
+    {
+        //
+        // There are BL_SPACEDIM * kmax planes of FABs.
+        // The first component are in the first kmax planes,
+        // the second component in the next kmax planes, ....
+        //
+        const int i = k + n * kmax;
+
+        if (planes[i].data == 0)
+            resolve(i);
+
+        return planes[i].data;
+    }
+
+    void
+    TurbInflowFile::prefetch (int k, int n, int np)
+    {
+        static const long pagesize = ::sysconf(_SC_PAGESIZE);
+
+        for (int m = 1; m <= np; m++)
+        {
+            const int i = (k + m) % kmax + n * kmax;
+            //
+            // Converted planes are already in memory.
+            //
+            if (planes[i].converted.size() > 0)
+                continue;
+
+            const long start  = offset[i];
+            const long pstart = (start / pagesize) * pagesize;
+
+            ::madvise(base + pstart, start + planes[i].extent - pstart, MADV_WILLNEED);
+        }
+    }
+
+    std::string
+    to_string (const int* filename, int len)
+    {
+        std::string s;
+
+        for (int i = 0; i < len; i++)
+            s += char(filename[i]);
 
-        for (int i = 0; i < offset[tid].size(); i++)
-            ifs >> offset[tid][i];
+        return s;
     }
+    //
+    // One reader per thread, like the HDR offsets were before.
+    // The page cache backing the mapping is shared by all of them.
+    //
+    TurbInflowFile*
+    get_file (const int* filename, int len, int isswirltype)
+    {
+        static TurbInflowFile* tif = 0;
 
-    std::string dat = flctfile; dat += "/DAT";
+#ifdef _OPENMP
+#pragma omp threadprivate (tif)
+#endif
 
-    std::ifstream ifs;
+        if (tif == 0)
+            tif = new TurbInflowFile(to_string(filename, len), isswirltype);
 
-    ifs.open(dat.c_str(), std::ios::in);
+        return tif;
+    }
+}
 
-    if (!ifs.good())
-        BoxLib::FileOpenFailed(dat);
+void
+FORT_GETPLANEPTR (int* filename, int* len, const Real** data, int* plane, int* ncomp,
+                  int* isswirltype, int* nprefetch)
+{
+    TurbInflowFile* tif = get_file(filename, *len, *isswirltype);
     //
-    // There are BL_SPACEDIM * kmax planes of FABs.
-    // The first component are in the first kmax planes,
-    // the second component in the next kmax planes, ....
     // Note also that both (*plane) and (*ncomp) start from
     // 1 not 0 since they're passed from Fortran.
     //
-    const long start = offset[tid][((*plane) - 1) + (((*ncomp) - 1) * kmax)] ;
-
-    ifs.seekg(start, std::ios::beg);
+    *data = tif->plane((*plane) - 1, (*ncomp) - 1);
 
-    if (!ifs.good())
-        BoxLib::Abort("getplane(): seekg() failed");
+    if (*nprefetch > 0)
+        tif->prefetch((*plane) - 1, (*ncomp) - 1, *nprefetch);
+}
 
-    FArrayBox fab;
+void
+FORT_GETPLANE (int* filename, int* len, Real* data, int* plane, int* ncomp, int* isswirltype)
+{
+    TurbInflowFile* tif = get_file(filename, *len, *isswirltype);
 
-    fab.readFrom(ifs);
+    const int   k = (*plane) - 1;
+    const int   n = (*ncomp) - 1;
+    const Real* p = tif->plane(k, n);
 
-    memcpy(data, fab.dataPtr(), fab.box().numPts()*sizeof(Real));
+    memcpy(data, p, tif->planeSize(k, n)*sizeof(Real));
 }
@@ -1,5 +1,7 @@
 module turbinflow_module
 
+  use iso_c_binding, only : c_ptr, c_f_pointer
+
   implicit none
 
   logical, save :: turbinflow_initialized = .false.
@@ -11,7 +13,16 @@ module turbinflow_module
   double precision, save :: pboxlo(3), dx(3), dxinv(3)
 
   integer, parameter :: nplane = 32
-  double precision, allocatable, save :: sdata(:,:,:,:)
+  ! number of planes ahead in time to ask the OS to read in
+  integer, parameter :: nprefetch = nplane
+
+  ! planes point directly into the memory-mapped DAT file (see turbinflow.cpp)
+  type plane_t
+     double precision, pointer :: p(:,:) => null()
+  end type plane_t
+
+  integer, save :: nptsxy(2)
+  type(plane_t), save :: splane(nplane,3)
   double precision, save :: szlo=0.d0, szhi=0.d0
 
   integer, parameter :: isswirltype = 0  ! periodic
@@ -22,7 +33,7 @@ module turbinflow_module
   public :: turbinflow_initialized, init_turbinflow, get_turbvelocity
 
 !$omp threadprivate(turbinflow_initialized,lenfname,iturbfile,npboxcells,pboxlo,dx,dxinv)
-!$omp threadprivate(sdata,szlo,szhi,units_conversion)
+!$omp threadprivate(nptsxy,splane,szlo,szhi,units_conversion)
 
 contains
 
@@ -77,7 +88,7 @@ contains
     pboxlo(1:2) = -0.5d0*pboxsize(1:2)
     pboxlo(3) = 0.d0
 
-    allocate(sdata(npts(1),npts(2),nplane,3))
+    nptsxy = npts(1:2)
 
     turbinflow_initialized = .true.
 
@@ -129,9 +140,9 @@ contains
              
              do jj=0,2
                 do ii=0,2
-                   zdata(ii,jj) = cz(0)*sdata(i0+ii,j0+jj,k0  ,n) &
-                        +         cz(1)*sdata(i0+ii,j0+jj,k0+1,n) &
-                        +         cz(2)*sdata(i0+ii,j0+jj,k0+2,n)
+                   zdata(ii,jj) = cz(0)*splane(k0  ,n)%p(i0+ii,j0+jj) &
+                        +         cz(1)*splane(k0+1,n)%p(i0+ii,j0+jj) &
+                        +         cz(2)*splane(k0+2,n)%p(i0+ii,j0+jj)
                 end do
              end do
 
@@ -139,7 +150,7 @@ contains
                 ydata(ii) = cy(0)*zdata(ii,0) + cy(1)*zdata(ii,1) + cy(2)*zdata(ii,2)
              end do
 
-             v(i,j,n) = cx(0)*ydata(0) + cx(1)*ydata(1) + cx(2)*ydata(2)
+             v(i,j,n) = (cx(0)*ydata(0) + cx(1)*ydata(1) + cx(2)*ydata(2)) * units_conversion
 
           end do
        end do
@@ -149,15 +160,19 @@ contains
 
   subroutine store_planes(z)
     double precision, intent(in) :: z
-    integer :: izlo, iplane, k, n
+    integer :: izlo, iplane, k, n, np
+    type(c_ptr) :: cp
     izlo = nint(z*dxinv(3)) - 1
     szlo = izlo*dx(3)
     szhi = szlo + dble(nplane-1)*dx(3)
     do n=1,3
        do iplane=1,nplane
           k = modulo(izlo+iplane-1, npboxcells(3)) + 1
-          call getplane(iturbfile, lenfname, sdata(:,:,iplane,n), k, n, isswirltype)
-          sdata(:,:,iplane,n) = sdata(:,:,iplane,n)*units_conversion
+          ! only the last plane of the window starts readahead of the next window
+          np = 0
+          if (iplane .eq. nplane) np = nprefetch
+          call getplaneptr(iturbfile, lenfname, cp, k, n, isswirltype, np)
+          call c_f_pointer(cp, splane(iplane,n)%p, nptsxy)
        end do
     end do
   end subroutine store_planes
@@ -50,5 +50,14 @@ module meth_params_module
   integer, parameter :: BEGp_burning = 4
   integer, parameter :: nchemsolver = 5
   logical, save :: chem_do_weno
+  ! burn smooth cells once at the average of their Gauss points; off if <= 0
+  double precision, save :: chem_adapt_tol = 0.d0
+
+  ! lagged transport properties; off if trans_lag_tol <= 0
+  double precision, save :: trans_lag_tol = 0.d0
+  integer, save :: trans_lag_max = 0
+
+  ! Stefan-Maxwell sweeps for multicomponent diffusion; mixture-averaged if 0
+  integer, save :: mc_diff_iters = 0
 
 end module meth_params_module
@@ -45,6 +45,7 @@ f90sources += smc_bc.f90
 f90sources += smcdata.f90
 f90sources += smc_threadbox.f90
 f90sources += time.f90
+f90sources += trans_lag.f90
 
 ifdef CONVERGENCE
   f90sources += trans_prop_conv.f90
@@ -858,7 +858,7 @@ contains
        !
        if (update_trans) then
           call build(bpt_gettrans, "gettrans")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
-          call get_transport_properties(Q, mu, xi, lam, Ddiag, ng_gettrans)
+          call get_transport_properties(Q, mu, xi, lam, Ddiag, ng_gettrans, lagged=.true.)
           trans_called = .true.
           call destroy(bpt_gettrans)               !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
        end if
@@ -874,7 +874,8 @@ contains
 
           if (ng_gettrans .eq. 0 .and. update_trans) then
              call build(bpt_gettrans, "gettrans")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
-             call get_transport_properties(Q, mu, xi, lam, Ddiag, ghostcells_only=.true.)
+             call get_transport_properties(Q, mu, xi, lam, Ddiag, ghostcells_only=.true., &
+                  lagged=.true.)
              call destroy(bpt_gettrans)                !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
           end if
 
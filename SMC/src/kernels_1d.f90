@@ -1968,6 +1968,7 @@ contains
     use probin_module, only : use_vode, vode_always_new_j
     use vode_module, only : verbose, itol, rtol, atol, vode_MF=>MF, &
          voderwork, vodeiwork, lvoderwork, lvodeiwork, voderpar, vodeipar
+    use chem_capture_module, only : chem_capture_cell, chem_capture_flush, cap_conv
 
     double precision, intent(in) :: dt
     integer,         intent(in):: lo(1),hi(1),qlo(1),qhi(1),uplo(1),uphi(1),upclo(1),upchi(1)
@@ -2033,6 +2034,9 @@ contains
              end if
           end if
           
+          call chem_capture_cell(cap_conv, min(istate,0), dt, dble(vodeiwork(12)), &
+               q(i,qtemp), q(i,qrho), q(i,qy1:qy1+nspecies-1))
+
           if (istate < 0) then
              print *, 'chemsolv: VODE failed'
              print *, 'istate = ', istate, ' time =', time
@@ -2053,6 +2057,8 @@ contains
           end do
        end do
 
+       call chem_capture_flush()
+
     else
 
        np = hi(1) - lo(1) + 1
@@ -4940,6 +4940,7 @@ contains
     use probin_module, only : use_vode, vode_always_new_j
     use vode_module, only : verbose, itol, rtol, atol, vode_MF=>MF, &
          voderwork, vodeiwork, lvoderwork, lvodeiwork, voderpar, vodeipar
+    use chem_capture_module, only : chem_capture_cell, chem_capture_flush, cap_conv
 
     double precision, intent(in) :: dt
     integer,         intent(in):: lo(2),hi(2),qlo(2),qhi(2),uplo(2),uphi(2),upclo(2),upchi(2)
@@ -5006,6 +5007,9 @@ contains
                 end if
              end if
 
+             call chem_capture_cell(cap_conv, min(istate,0), dt, dble(vodeiwork(12)), &
+                  q(i,j,qtemp), q(i,j,qrho), q(i,j,qy1:qy1+nspecies-1))
+
              if (istate < 0) then
                 print *, 'chemsolv: VODE failed'
                 print *, 'istate = ', istate, ' time =', time
@@ -5029,6 +5033,8 @@ contains
           end do
        end do
 
+       call chem_capture_flush()
+
     else
 
        np = hi(1) - lo(1) + 1
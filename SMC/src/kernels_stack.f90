@@ -4418,6 +4418,7 @@ contains
     use probin_module, only : use_vode, vode_always_new_j
     use vode_module, only : verbose, itol, rtol, atol, vode_MF=>MF, &
          voderwork, vodeiwork, lvoderwork, lvodeiwork, voderpar, vodeipar
+    use chem_capture_module, only : chem_capture_cell, chem_capture_flush, cap_conv
 
     double precision, intent(in) :: dt
     integer,         intent(in):: lo(3),hi(3),qlo(3),qhi(3),uplo(3),uphi(3),upclo(3),upchi(3)
@@ -4485,6 +4486,9 @@ contains
                    end if
                 end if
                 
+                call chem_capture_cell(cap_conv, min(istate,0), dt, dble(vodeiwork(12)), &
+                     q(i,j,k,qtemp), q(i,j,k,qrho), q(i,j,k,qy1:qy1+nspecies-1))
+
                 if (istate < 0) then
                    print *, 'chemsolv: VODE failed'
                    print *, 'istate = ', istate, ' time =', time
@@ -4511,6 +4515,8 @@ contains
           end do
        end do
 
+       call chem_capture_flush()
+
     else
 
        np = hi(1) - lo(1) + 1
@@ -2,6 +2,7 @@ subroutine smc()
 
   use advance_module
   use checkpoint_module
+  use chem_capture_module, only : chem_capture_init, chem_capture_close
   use chemistry_module
   use derivative_stencil_module
   use egz_module
@@ -19,7 +20,9 @@ subroutine smc()
   use smcdata_module
   use smc_threadbox_module
   use time_module
+  use tinv_module, only : tinv_init
   use tranlib_module
+  use trans_lag_module, only : trans_lag_counts, trans_lag_close
   use variables_module
   use vode_module, only : vode_init, vode_close
 
@@ -34,12 +37,14 @@ subroutine smc()
   real(dp_t) :: dx(3)
 
   real(dp_t) :: wt0, wt1, wt2, wt_init, wt_advance, wtw, dwt
+  integer(kind=ll_t) :: ntrans(2), ntrans_l(2)
 
   integer :: last_plt_written,last_chk_written
   character(len=5)               :: plot_index, check_index
   character(len=6)               :: plot_index6, check_index6
   character(len=256)             :: plot_file_name, check_file_name
   character(len=20), allocatable :: plot_names(:)
+  character(len=16)              :: rank_str
 
   logical :: dump_plotfile, dump_checkpoint, abort_smc, walltime_limit_reached
   real(dp_t) :: write_pf_time
@@ -66,14 +71,20 @@ subroutine smc()
   call runtime_init()
   call stencil_init()
   call chemistry_init()
+  call tinv_init()
   if (use_vode) then
      call vode_init(nspecies+1,vode_verbose,vode_itol,vode_rtol,vode_atol,vode_order,&
           vode_maxstep,vode_use_ajac,vode_save_ajac,vode_always_new_j,vode_stiff)
+     if (chem_capture_file .ne. "") then
+        write(rank_str,'(i0)') parallel_myproc()
+        call chem_capture_init(trim(chem_capture_file)//'.'//trim(rank_str), &
+             nspecies, chem_capture_ntop)
+     end if
   end if
   if (use_tranlib) then
-     call tranlib_init(nspecies)
+     call tranlib_init(nspecies, transport_tab_tol, transport_tab_tmin, transport_tab_tmax)
   end if
-  call egz_init(use_bulk_viscosity)
+  call egz_init(use_bulk_viscosity, transport_tab_tol, transport_tab_tmin, transport_tab_tmax)
 
   if (verbose .ge. 1) then
      if (parallel_IOProcessor()) then
@@ -465,6 +476,9 @@ subroutine smc()
   call destroy(U)
   call destroy(la)
 
+  call trans_lag_counts(ntrans_l(1), ntrans_l(2))
+  call trans_lag_close()
+
   call chemistry_close()
   if (use_tranlib) then
      call tranlib_close()
@@ -472,6 +486,7 @@ subroutine smc()
      call egz_close()
   end if
   call vode_close()
+  call chem_capture_close()
 
   call runtime_close()
 
@@ -479,6 +494,7 @@ subroutine smc()
 
   call parallel_reduce(wt_init, wt1-wt0, MPI_MAX, proc = parallel_IOProcessorNode())
   call parallel_reduce(wt_advance, wt2-wt1, MPI_MAX, proc = parallel_IOProcessorNode())
+  call parallel_reduce(ntrans, ntrans_l, MPI_SUM, proc = parallel_IOProcessorNode())
 
   if (parallel_IOProcessor()) then
      print*, ' '
@@ -487,6 +503,10 @@ subroutine smc()
      print*, ' '
      print*, 'AD fevals = ', count_ad
      print*, 'R  fevals = ', count_r
+     if (trans_lag_tol > 0.d0) then
+        print*, 'transport FAB evaluations = ', ntrans(1)
+        print*, 'transport FAB reuses      = ', ntrans(2)
+     end if
   end if
 
 end subroutine smc
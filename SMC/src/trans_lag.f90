@@ -0,0 +1,186 @@
+module trans_lag_module
+
+  ! Lagged transport coefficients.  For every FAB we keep the temperature and
+  ! mole fractions that its coefficients were last computed from.  The FAB's
+  ! coefficients are kept if no cell has moved by more than trans_lag_tol
+  ! since (relative change in T, absolute change in X), unless trans_lag_max
+  ! evaluations in a row have been skipped already.  Interior and ghost-cell
+  ! only evaluations are tracked separately.
+
+  use bl_types
+  use multifab_module
+  use chemistry_module, only : nspecies
+  use variables_module, only : qtemp, qx1
+
+  implicit none
+
+  type(multifab), save :: Qlag   ! T and X
+  integer, allocatable, save :: nskip(:,:)
+  logical, save :: lag_built = .false.
+
+  ! FAB evaluations done and skipped since trans_lag_counts
+  integer(kind=ll_t), save :: nrefresh = 0, nreuse = 0
+
+  private
+
+  public :: trans_lag_skip, trans_lag_save, trans_lag_counts, trans_lag_close
+
+contains
+
+  ! Can the coefficients of FAB n in wlo:whi (only its ghost cells if gco)
+  ! be kept?
+  function trans_lag_skip(Q, n, wlo, whi, gco) result(r)
+    use probin_module, only : trans_lag_tol, trans_lag_max
+    use smc_threadbox_module, only : tb_multifab_setval
+    type(multifab), intent(in) :: Q
+    integer, intent(in) :: n, wlo(:), whi(:)
+    logical, intent(in) :: gco
+    logical :: r
+
+    integer :: ig, lo(3), hi(3), blo(3), bhi(3)
+    double precision :: dmax
+    double precision, pointer :: qp(:,:,:,:), lp(:,:,:,:)
+
+    if (.not. lag_built) then
+       call multifab_build(Qlag, get_layout(Q), nspecies+1, nghost(Q))
+       ! T = 0 never passes the test in max_change
+       call tb_multifab_setval(Qlag, 0.d0, .true.)
+       allocate(nskip(nfabs(Q),2))
+       nskip = 0
+       lag_built = .true.
+    end if
+
+    ig = 1
+    if (gco) ig = 2
+
+    r = .false.
+
+    if (trans_lag_max .gt. 0 .and. nskip(n,ig) .ge. trans_lag_max) return
+
+    qp => dataptr(Q,n)
+    lp => dataptr(Qlag,n)
+
+    call get_boxes(Q, n, wlo, whi, lo, hi, blo, bhi)
+
+    dmax = max_change(lo, hi, blo, bhi, gco, qp, lp)
+
+    if (dmax .le. trans_lag_tol) then
+       r = .true.
+       nskip(n,ig) = nskip(n,ig) + 1
+       nreuse = nreuse + 1_ll_t
+    end if
+
+  end function trans_lag_skip
+
+
+  ! Coefficients of FAB n have been computed in wlo:whi (only its ghost cells
+  ! if gco) from Q.
+  subroutine trans_lag_save(Q, n, wlo, whi, gco)
+    type(multifab), intent(in) :: Q
+    integer, intent(in) :: n, wlo(:), whi(:)
+    logical, intent(in) :: gco
+
+    integer :: i, j, k, m, ig, lo(3), hi(3), blo(3), bhi(3)
+    double precision, pointer :: qp(:,:,:,:), lp(:,:,:,:)
+
+    ig = 1
+    if (gco) ig = 2
+
+    qp => dataptr(Q,n)
+    lp => dataptr(Qlag,n)
+
+    call get_boxes(Q, n, wlo, whi, lo, hi, blo, bhi)
+
+    !$omp parallel do private(i,j,k,m) collapse(2)
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+          do i=lo(1),hi(1)
+             if (gco .and. inside(i,j,k,blo,bhi)) cycle
+             lp(i,j,k,1) = qp(i,j,k,qtemp)
+             do m=1,nspecies
+                lp(i,j,k,m+1) = qp(i,j,k,qx1+m-1)
+             end do
+          end do
+       end do
+    end do
+    !$omp end parallel do
+
+    nskip(n,ig) = 0
+    nrefresh = nrefresh + 1_ll_t
+
+  end subroutine trans_lag_save
+
+
+  ! FAB evaluations done and skipped since the last call.
+  subroutine trans_lag_counts(nref, nskp)
+    integer(kind=ll_t), intent(out) :: nref, nskp
+    nref = nrefresh
+    nskp = nreuse
+    nrefresh = 0
+    nreuse = 0
+  end subroutine trans_lag_counts
+
+
+  subroutine trans_lag_close()
+    if (lag_built) then
+       call destroy(Qlag)
+       deallocate(nskip)
+       lag_built = .false.
+    end if
+  end subroutine trans_lag_close
+
+
+  ! Work region (lo:hi) and valid box (blo:bhi), padded to 3D.
+  subroutine get_boxes(Q, n, wlo, whi, lo, hi, blo, bhi)
+    type(multifab), intent(in) :: Q
+    integer, intent(in) :: n, wlo(:), whi(:)
+    integer, intent(out) :: lo(3), hi(3), blo(3), bhi(3)
+    integer :: dm
+    dm = Q%dim
+    lo = 1;  hi = 1;  blo = 1;  bhi = 1
+    lo(1:dm) = wlo
+    hi(1:dm) = whi
+    blo(1:dm) = lwb(get_box(Q,n))
+    bhi(1:dm) = upb(get_box(Q,n))
+  end subroutine get_boxes
+
+
+  function max_change(lo, hi, blo, bhi, gco, qp, lp) result(dmax)
+    integer, intent(in) :: lo(3), hi(3), blo(3), bhi(3)
+    logical, intent(in) :: gco
+    double precision, pointer :: qp(:,:,:,:), lp(:,:,:,:)
+    double precision :: dmax
+
+    integer :: i, j, k, m
+
+    dmax = 0.d0
+
+    !$omp parallel do private(i,j,k,m) reduction(max:dmax) collapse(2)
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+          do i=lo(1),hi(1)
+             if (gco .and. inside(i,j,k,blo,bhi)) cycle
+             if (lp(i,j,k,1) .gt. 0.d0) then
+                dmax = max(dmax, abs(qp(i,j,k,qtemp)-lp(i,j,k,1))/lp(i,j,k,1))
+             else
+                dmax = huge(1.d0)
+             end if
+             do m=1,nspecies
+                dmax = max(dmax, abs(qp(i,j,k,qx1+m-1)-lp(i,j,k,m+1)))
+             end do
+          end do
+       end do
+    end do
+    !$omp end parallel do
+
+  end function max_change
+
+
+  pure logical function inside(i,j,k,blo,bhi)
+    integer, intent(in) :: i, j, k, blo(3), bhi(3)
+    inside = i.ge.blo(1) .and. i.le.bhi(1) .and. &
+         &   j.ge.blo(2) .and. j.le.bhi(2) .and. &
+         &   k.ge.blo(3) .and. k.le.bhi(3)
+  end function inside
+
+end module trans_lag_module
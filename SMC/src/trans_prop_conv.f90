@@ -7,6 +7,7 @@ module transport_properties
   use variables_module
 
   use egz_module
+  use trans_lag_module
 
   implicit none
 
@@ -16,18 +17,24 @@ module transport_properties
 
 contains
 
-  subroutine get_transport_properties(Q, mu, xi, lam, Ddiag, ng, ghostcells_only)
+  !
+  ! With lagged (and trans_lag_tol > 0), FABs whose T and X have hardly
+  ! changed since their coefficients were computed keep them, as in
+  ! transport_properties.f90.
+  !
+  subroutine get_transport_properties(Q, mu, xi, lam, Ddiag, ng, ghostcells_only, lagged)
 
-    use probin_module, only : use_bulk_viscosity
+    use probin_module, only : use_bulk_viscosity, trans_lag_tol
     use smc_bc_module, only : get_data_lo_hi
 
     type(multifab), intent(in   ) :: Q
     type(multifab), intent(inout) :: mu, xi, lam, Ddiag
     integer, intent(in), optional :: ng
     logical, intent(in), optional :: ghostcells_only
+    logical, intent(in), optional :: lagged
  
     integer :: ngwork, idim
-    logical :: lgco
+    logical :: lgco, llag
     integer :: ngq, n, dm, lo(Q%dim), hi(Q%dim), wlo(Q%dim), whi(Q%dim)
     double precision, pointer, dimension(:,:,:,:) :: qp, mup, xip, lamp, dp
 
@@ -44,6 +51,11 @@ contains
        lgco = ghostcells_only
     end if
 
+    llag = .false.
+    if (present(lagged)) then
+       llag = lagged .and. trans_lag_tol > 0.d0
+    end if
+
     do n=1,nfabs(Q)
        
        qp => dataptr(Q,n)
@@ -62,6 +74,10 @@ contains
           whi(idim) = min(whi(idim), hi(idim)+ngwork)
        end do
 
+       if (llag) then
+          if (trans_lag_skip(Q, n, wlo, whi, lgco)) cycle
+       end if
+
        if (dm .eq. 1) then
           call get_trans_prop_1d(lo,hi,ngq,qp,mup,xip,lamp,dp,wlo,whi,lgco)
        else if (dm .eq. 2) then
@@ -70,6 +86,8 @@ contains
           call get_trans_prop_3d(lo,hi,ngq,qp,mup,xip,lamp,dp,wlo,whi,lgco)
        end if
 
+       if (llag) call trans_lag_save(Q, n, wlo, whi, lgco)
+
     end do
 
   end subroutine get_transport_properties
@@ -6,6 +6,7 @@ module transport_properties
 
   use egz_module
   use tranlib_module
+  use trans_lag_module
 
   implicit none
 
@@ -15,18 +16,24 @@ module transport_properties
 
 contains
 
-  subroutine get_transport_properties(Q, mu, xi, lam, Ddiag, ng, ghostcells_only)
+  !
+  ! With lagged (and trans_lag_tol > 0), FABs whose T and X have hardly
+  ! changed since their coefficients were computed keep them.  Only pass
+  ! lagged for the mu, xi, lam and Ddiag that persist between calls.
+  !
+  subroutine get_transport_properties(Q, mu, xi, lam, Ddiag, ng, ghostcells_only, lagged)
 
-    use probin_module, only : use_tranlib
+    use probin_module, only : use_tranlib, trans_lag_tol
     use smc_bc_module, only : get_data_lo_hi
 
     type(multifab), intent(in   ) :: Q
     type(multifab), intent(inout) :: mu, xi, lam, Ddiag
     integer, intent(in), optional :: ng
     logical, intent(in), optional :: ghostcells_only
+    logical, intent(in), optional :: lagged
  
     integer :: ngwork, idim
-    logical :: lgco
+    logical :: lgco, llag
     integer :: ngq, n, dm, lo(Q%dim), hi(Q%dim), wlo(Q%dim), whi(Q%dim)
     double precision, pointer, dimension(:,:,:,:) :: qp, mup, xip, lamp, dp
 
@@ -43,6 +50,11 @@ contains
        lgco = ghostcells_only
     end if
 
+    llag = .false.
+    if (present(lagged)) then
+       llag = lagged .and. trans_lag_tol > 0.d0
+    end if
+
     do n=1,nfabs(Q)
        
        qp => dataptr(Q,n)
@@ -61,6 +73,10 @@ contains
           whi(idim) = min(whi(idim), hi(idim)+ngwork)
        end do
 
+       if (llag) then
+          if (trans_lag_skip(Q, n, wlo, whi, lgco)) cycle
+       end if
+
        if (dm .eq. 1) then
           if (use_tranlib) then
              call tranlib_1d(lo,hi,ngq,qp,mup,xip,lamp,dp,wlo,whi,lgco)
@@ -81,6 +97,8 @@ contains
           end if
        end if
 
+       if (llag) call trans_lag_save(Q, n, wlo, whi, lgco)
+
     end do
 
   end subroutine get_transport_properties
@@ -791,13 +809,13 @@ contains
           Xt(n) = q(i,qx1+n-1)
        end do
        
-       call mcavis(q(i,qtemp),Xt,mcwork,mu(i))
+       call tranlib_avis(q(i,qtemp),Xt,mu(i))
 
        xi(i) = 0.d0
 
-       call mcacon(q(i,qtemp),Xt,mcwork,lam(i))
+       call tranlib_acon(q(i,qtemp),Xt,lam(i))
        
-       call mcadif(q(i,qpres),q(i,qtemp),Xt,mcwork,Dt)
+       call tranlib_adif(q(i,qpres),q(i,qtemp),Xt,Dt)
        
        call ckmmwx(Xt, iwrk, rwrk, Wbar)
        rwrk = q(i,qrho) / Wbar
@@ -840,13 +858,13 @@ contains
              Xt(n) = q(i,j,qx1+n-1)
           end do
 
-          call mcavis(q(i,j,qtemp),Xt,mcwork,mu(i,j))
+          call tranlib_avis(q(i,j,qtemp),Xt,mu(i,j))
 
           xi(i,j) = 0.d0
 
-         call mcacon(q(i,j,qtemp),Xt,mcwork,lam(i,j))
+         call tranlib_acon(q(i,j,qtemp),Xt,lam(i,j))
           
-         call mcadif(q(i,j,qpres),q(i,j,qtemp),Xt,mcwork,Dt)
+         call tranlib_adif(q(i,j,qpres),q(i,j,qtemp),Xt,Dt)
 
          call ckmmwx(Xt, iwrk, rwrk, Wbar)
          rwrk = q(i,j,qrho) / Wbar
@@ -892,13 +910,13 @@ contains
              Xt(n) = q(i,j,k,qx1+n-1)
           end do
           
-          call mcavis(q(i,j,k,qtemp),Xt,mcwork,mu(i,j,k))
+          call tranlib_avis(q(i,j,k,qtemp),Xt,mu(i,j,k))
 
           xi(i,j,k) = 0.d0
 
-          call mcacon(q(i,j,k,qtemp),Xt,mcwork,lam(i,j,k))
+          call tranlib_acon(q(i,j,k,qtemp),Xt,lam(i,j,k))
           
-          call mcadif(q(i,j,k,qpres),q(i,j,k,qtemp),Xt,mcwork,Dt)
+          call tranlib_adif(q(i,j,k,qpres),q(i,j,k,qtemp),Xt,Dt)
 
           call ckmmwx(Xt, iwrk, rwrk, Wbar)
           rwrk = q(i,j,k,qrho) / Wbar
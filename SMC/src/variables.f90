@@ -305,15 +305,20 @@ contains
   end subroutine ctoprim_2d
 
   subroutine ctoprim_3d(lo, hi, u, q, ngu, ngq, ngto, dlo, dhi, gco, ryto)
+    use tinv_module, only : tinv_T_given_eY, tinv_ttol_eY, tinv_itmax_eY
     logical, intent(in) :: gco  ! ghost cells only?
     logical, intent(in) :: ryto ! compute rho, Y and T only?
     integer, intent(in) :: lo(3), hi(3), ngu, ngq, ngto, dlo(3), dhi(3)
     double precision, intent(in ) :: u(lo(1)-ngu:hi(1)+ngu,lo(2)-ngu:hi(2)+ngu,lo(3)-ngu:hi(3)+ngu,ncons)
     double precision, intent(out) :: q(lo(1)-ngq:hi(1)+ngq,lo(2)-ngq:hi(2)+ngq,lo(3)-ngq:hi(3)+ngq,nprim)
     
-    integer :: i, j, k, n, iwrk, ierr
-    double precision :: rho, rhoinv, rwrk, X(nspecies), Y(nspecies), h(nspecies), ei, Tt, Pt
+    integer :: i, j, k, n, iwrk, ierr, iseg, nseg, ia(2), ib(2)
+    double precision :: rho, rhoinv, rwrk, X(nspecies), Y(nspecies), h(nspecies), Tt, Pt
     integer :: llo(3), lhi(3)
+    ! a row of cells for the batched T solve
+    integer :: niter(lo(1)-ngto:hi(1)+ngto)
+    double precision :: erow(lo(1)-ngto:hi(1)+ngto), Trow(lo(1)-ngto:hi(1)+ngto)
+    double precision :: Yrow(lo(1)-ngto:hi(1)+ngto,nspecies)
 
     ! be safe
     do i=1,3
@@ -322,55 +327,77 @@ contains
     end do
 
     !$omp parallel private(i, j, k, n, iwrk, rho, rhoinv, rwrk) &
-    !$omp private(X, Y, h, ei, Tt, Pt, ierr)
+    !$omp private(X, Y, h, Tt, Pt, ierr, iseg, nseg, ia, ib, niter, erow, Trow, Yrow)
     !$omp do collapse(2)
     do k = llo(3),lhi(3)
        do j = llo(2),lhi(2)
-          do i = llo(1),lhi(1)
 
-             if (gco) then
-                if ( (i.ge.lo(1) .and. i.le.hi(1)) .and. &
-                     (j.ge.lo(2) .and. j.le.hi(2)) .and. &
-                     (k.ge.lo(3) .and. k.le.hi(3)) ) then
-                   cycle
-                end if
-             end if
+          ! the i-segments of the row to do
+          if (gco .and. (j.ge.lo(2) .and. j.le.hi(2)) .and. &
+               &        (k.ge.lo(3) .and. k.le.hi(3)) ) then
+             nseg = 2
+             ia(1) = llo(1);  ib(1) = lo(1)-1
+             ia(2) = hi(1)+1; ib(2) = lhi(1)
+          else
+             nseg = 1
+             ia(1) = llo(1);  ib(1) = lhi(1)
+          end if
 
-             rho = u(i,j,k,irho)
-             rhoinv = 1.d0/rho
-             q(i,j,k,qrho) = rho
-             q(i,j,k,qu) = u(i,j,k,imx) * rhoinv
-             q(i,j,k,qv) = u(i,j,k,imy) * rhoinv
-             q(i,j,k,qw) = u(i,j,k,imz) * rhoinv
+          do iseg = 1, nseg
 
-             do n=1,nspecies
-                Y(n) = u(i,j,k,iry1+n-1) * rhoinv
-                q(i,j,k,qy1+n-1) = Y(n)
-             end do
+             if (ia(iseg) .gt. ib(iseg)) cycle
 
-             ei = rhoinv*u(i,j,k,iene) - 0.5d0*(q(i,j,k,qu)**2+q(i,j,k,qv)**2+q(i,j,k,qw)**2)
-             q(i,j,k,qe) = ei
+             do i = ia(iseg),ib(iseg)
 
-             Tt = q(i,j,k,qtemp)
-             call get_t_given_ey(ei, Y, iwrk, rwrk, Tt, ierr)
-             q(i,j,k,qtemp) = Tt
+                rho = u(i,j,k,irho)
+                rhoinv = 1.d0/rho
+                q(i,j,k,qrho) = rho
+                q(i,j,k,qu) = u(i,j,k,imx) * rhoinv
+                q(i,j,k,qv) = u(i,j,k,imy) * rhoinv
+                q(i,j,k,qw) = u(i,j,k,imz) * rhoinv
 
-             if (ryto) cycle
+                do n=1,nspecies
+                   Yrow(i,n) = u(i,j,k,iry1+n-1) * rhoinv
+                   q(i,j,k,qy1+n-1) = Yrow(i,n)
+                end do
 
-             call ckytx(Y, iwrk, rwrk, X)
+                erow(i) = rhoinv*u(i,j,k,iene) - 0.5d0*(q(i,j,k,qu)**2+q(i,j,k,qv)**2+q(i,j,k,qw)**2)
+                q(i,j,k,qe) = erow(i)
 
-             do n=1,nspecies
-                q(i,j,k,qx1+n-1) = X(n)
+                Trow(i) = q(i,j,k,qtemp)
              end do
 
-             call CKPY(rho, Tt, Y, iwrk, rwrk, Pt)
-             q(i,j,k,qpres) = Pt
+             call tinv_T_given_eY(ib(iseg)-ia(iseg)+1, erow(ia(iseg):ib(iseg)), &
+                  Yrow(ia(iseg):ib(iseg),:), Trow(ia(iseg):ib(iseg)), 0.d0, tinv_ttol_eY, tinv_itmax_eY, &
+                  .false., niter(ia(iseg):ib(iseg)))
 
-             call ckhms(Tt, iwrk, rwrk, h)
+             do i = ia(iseg),ib(iseg)
 
-             do n=1,nspecies
-                q(i,j,k,qh1+n-1) = h(n)
-             end do
+                Y = Yrow(i,:)
+
+                Tt = Trow(i)
+                if (niter(i) .lt. 0) then
+                   call get_t_given_ey(erow(i), Y, iwrk, rwrk, Tt, ierr)
+                end if
+                q(i,j,k,qtemp) = Tt
+
+                if (ryto) cycle
+
+                call ckytx(Y, iwrk, rwrk, X)
+
+                do n=1,nspecies
+                   q(i,j,k,qx1+n-1) = X(n)
+                end do
+
+                call CKPY(q(i,j,k,qrho), Tt, Y, iwrk, rwrk, Pt)
+                q(i,j,k,qpres) = Pt
+
+                call ckhms(Tt, iwrk, rwrk, h)
+
+                do n=1,nspecies
+                   q(i,j,k,qh1+n-1) = h(n)
+                end do
+             enddo
           enddo
        enddo
     enddo
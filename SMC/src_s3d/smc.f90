@@ -71,9 +71,9 @@ subroutine smc()
           vode_maxstep,vode_use_ajac,vode_save_ajac,vode_always_new_j,vode_stiff)
   end if
   if (use_tranlib) then
-     call tranlib_init(nspecies)
+     call tranlib_init(nspecies, transport_tab_tol, transport_tab_tmin, transport_tab_tmax)
   end if
-  call egz_init(use_bulk_viscosity)
+  call egz_init(use_bulk_viscosity, transport_tab_tol, transport_tab_tmin, transport_tab_tmax)
 
   if (verbose .ge. 1) then
      if (parallel_IOProcessor()) then
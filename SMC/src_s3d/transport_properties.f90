@@ -704,13 +704,13 @@ contains
              Xt(n) = q(i,j,qx1+n-1)
           end do
 
-          call mcavis(q(i,j,qtemp),Xt,mcwork,mu(i,j))
+          call tranlib_avis(q(i,j,qtemp),Xt,mu(i,j))
 
           xi(i,j) = 0.d0
 
-         call mcacon(q(i,j,qtemp),Xt,mcwork,lam(i,j))
+         call tranlib_acon(q(i,j,qtemp),Xt,lam(i,j))
           
-         call mcadif(q(i,j,qpres),q(i,j,qtemp),Xt,mcwork,Dt)
+         call tranlib_adif(q(i,j,qpres),q(i,j,qtemp),Xt,Dt)
 
          call ckmmwx(Xt, iwrk, rwrk, Wbar)
          rwrk = q(i,j,qrho) / Wbar
@@ -756,13 +756,13 @@ contains
              Xt(n) = q(i,j,k,qx1+n-1)
           end do
           
-          call mcavis(q(i,j,k,qtemp),Xt,mcwork,mu(i,j,k))
+          call tranlib_avis(q(i,j,k,qtemp),Xt,mu(i,j,k))
 
           xi(i,j,k) = 0.d0
 
-          call mcacon(q(i,j,k,qtemp),Xt,mcwork,lam(i,j,k))
+          call tranlib_acon(q(i,j,k,qtemp),Xt,lam(i,j,k))
           
-          call mcadif(q(i,j,k,qpres),q(i,j,k,qtemp),Xt,mcwork,Dt)
+          call tranlib_adif(q(i,j,k,qpres),q(i,j,k,qtemp),Xt,Dt)
 
           call ckmmwx(Xt, iwrk, rwrk, Wbar)
           rwrk = q(i,j,k,qrho) / Wbar
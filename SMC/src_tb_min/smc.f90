@@ -56,7 +56,7 @@ subroutine smc()
   call stencil_init()
 
   call chemistry_init()
-  call egz_init(use_bulk_viscosity)
+  call egz_init(use_bulk_viscosity, transport_tab_tol, transport_tab_tmin, transport_tab_tmax)
 
   if (verbose .ge. 1) then
      if (parallel_IOProcessor()) then